@@ -0,0 +1,399 @@
+// AssignmentValidator.h
+// 派工结果约束校验：每条约束编译成一个检查器，按员工时间线并行检查，输出结构化违规报告
+#pragma once
+
+#include <vector>
+#include <string>
+#include <sstream>
+#include <algorithm>
+#include <thread>
+#include <chrono>
+#include <unordered_map>
+#include "Task.h"
+#include "Staff.h"
+#include "Shift.h"
+#include "TemporaryTask.h"
+#include "TravelTime.h"
+#include "DayModel.h"
+
+namespace AirportStaffScheduler {
+
+    // 违规类型
+    enum class ViolationType {
+        OVERLAP = 0,          // 任务重叠
+        TRAVEL_TIME = 1,      // 路程时间不足
+        SHIFT_WINDOW = 2,     // 超出班次时间
+        QUALIFICATION = 3,    // 资质不匹配
+        CONTINUOUS_WORK = 4,  // 连续工作超时（休息不足）
+        CONNECT_RULE = 5,     // 航班衔接间隔不足
+        COUNT = 6
+    };
+
+    inline const char* violationTypeName(ViolationType type) {
+        switch (type) {
+        case ViolationType::OVERLAP: return "任务重叠";
+        case ViolationType::TRAVEL_TIME: return "路程时间不足";
+        case ViolationType::SHIFT_WINDOW: return "超出班次时间";
+        case ViolationType::QUALIFICATION: return "资质不匹配";
+        case ViolationType::CONTINUOUS_WORK: return "连续工作超时";
+        case ViolationType::CONNECT_RULE: return "航班衔接间隔不足";
+        default: return "未知";
+        }
+    }
+
+    // 单条违规记录
+    struct Violation {
+        ViolationType type;
+        int staffIdx;        // 员工索引
+        int shiftIdx;        // 班次索引（-1 表示不涉及班次）
+        int taskIdx;         // 违规任务索引（-1 表示临时任务）
+        int otherTaskIdx;    // 关联的前一个任务索引（-1 表示无）
+        long amountSeconds;  // 违规量（超出/不足的秒数）
+        std::string detail;  // 说明
+
+        // 完整的违规说明（"类型: 说明"，与 detail 同为 UTF-8）
+        std::string message() const {
+            return std::string(violationTypeName(type)) + ": " + detail;
+        }
+    };
+
+    // 航班衔接规则：前一个任务（进/出港、机型）→ 后一个任务（进/出港）的最小间隔
+    struct ConnectIntervalRule {
+        std::string prevDirection;
+        std::string prevBodyType;   // 空表示任意机型
+        std::string nextDirection;
+        long minIntervalSeconds;    // 可为负（允许重叠）
+    };
+
+    // 校验规则（0 表示不检查对应约束）
+    struct ValidationRules {
+        long defaultTravelSeconds = 0;           // 任务间默认路程时间
+        bool allowOverlap = false;               // 是否允许任务重叠
+        long maxOverlapSeconds = 0;              // 允许重叠时的最大重叠时间
+        long maxOvertimeSeconds = 0;             // 最大加班时间（班次允许加班时生效）
+        long maxContinuousWorkSeconds = 0;       // 最大连续工作时长
+        long minContinuousRestSeconds = 0;       // 最小连续休息时长
+        std::vector<ConnectIntervalRule> connectRules;
+        std::unordered_map<std::string, long> travelSeconds;  // "任务一ID|任务二ID" → 路程时间
+
+        void addTravelTimes(const std::vector<TravelTime>& travelTimes) {
+            for (const auto& tt : travelTimes) {
+                travelSeconds[tt.getTaskOneId() + "|" + tt.getTaskTwoId()] = tt.getTravelMinutes() * 60L;
+            }
+        }
+
+        long getTravelSeconds(const std::string& fromTaskId, const std::string& toTaskId) const {
+            auto it = travelSeconds.find(fromTaskId + "|" + toTaskId);
+            return it != travelSeconds.end() ? it->second : defaultTravelSeconds;
+        }
+
+        // 匹配衔接规则，未匹配返回 nullptr
+        const ConnectIntervalRule* findConnectRule(const Task& prev, const Task& next) const {
+            for (const auto& rule : connectRules) {
+                if (rule.prevDirection == prev.getInOrOutPort() &&
+                    rule.nextDirection == next.getInOrOutPort() &&
+                    (rule.prevBodyType.empty() || rule.prevBodyType == prev.getAircraftType())) {
+                    return &rule;
+                }
+            }
+            return nullptr;
+        }
+
+        // 从 parameter.csv / connectRule.csv（单日模型规则表）读取，参数单位为分钟
+        static ValidationRules fromRuleTable(const Model::RuleTable& table, const Model::StringPool& strings) {
+            ValidationRules rules;
+            rules.defaultTravelSeconds = table.getLong("任务间默认路程时间", 0) * 60;
+            auto overlap = table.parameters.find("是否允许任务重叠");
+            if (overlap != table.parameters.end()) {
+                const std::string& flag = overlap->second;
+                rules.allowOverlap = flag == "Y" || flag == "y" || flag == "是" || flag == "1";
+            }
+            rules.maxOverlapSeconds = table.getLong("任务间默认最大重叠时间", 0) * 60;
+            rules.maxOvertimeSeconds = table.getLong("最大加班时间", 0) * 60;
+            rules.maxContinuousWorkSeconds = table.getLong("最大连续工作时长", 0) * 60;
+            rules.minContinuousRestSeconds = table.getLong("最小连续休息时长", 0) * 60;
+            for (const auto& cr : table.connect_rules) {
+                ConnectIntervalRule rule;
+                rule.prevDirection = strings.get(cr.prev_direction);
+                rule.prevBodyType = strings.get(cr.prev_body_type);
+                rule.nextDirection = strings.get(cr.next_direction);
+                rule.minIntervalSeconds = cr.min_interval;
+                rules.connectRules.push_back(rule);
+            }
+            return rules;
+        }
+    };
+
+    // 校验报告
+    struct ValidationReport {
+        std::vector<Violation> violations;   // 按员工索引排列
+        int countByType[static_cast<int>(ViolationType::COUNT)] = {};
+        int checkedStaffCount = 0;
+        int checkedTaskCount = 0;
+        double elapsedMs = 0.0;
+
+        bool ok() const { return violations.empty(); }
+        int count(ViolationType type) const { return countByType[static_cast<int>(type)]; }
+
+        std::string summary() const {
+            std::ostringstream oss;
+            oss << "约束校验：员工 " << checkedStaffCount << " 人，任务 " << checkedTaskCount
+                << " 个，违规 " << violations.size() << " 条（耗时 " << elapsedMs << " ms）";
+            for (int t = 0; t < static_cast<int>(ViolationType::COUNT); ++t) {
+                if (countByType[t] > 0) {
+                    oss << "\n  " << violationTypeName(static_cast<ViolationType>(t)) << ": " << countByType[t];
+                }
+            }
+            return oss.str();
+        }
+    };
+
+    class AssignmentValidator {
+    public:
+        AssignmentValidator(
+            const std::vector<Task>& tasks,
+            const std::vector<Staff>& staffList,
+            const std::vector<Shift>& shiftList,
+            const std::vector<TemporaryTask>& temporaryTasks,
+            const ValidationRules& rules
+        )
+            : tasks_(tasks)
+            , staffList_(staffList)
+            , shiftList_(shiftList)
+            , temporaryTasks_(temporaryTasks)
+            , rules_(rules)
+        {}
+
+        // 校验分配结果
+        // shiftToStaffIndex: 班次 → 员工索引；shiftToTaskIndices: 班次 → 任务索引列表
+        // threadCount 为 0 时按硬件线程数
+        ValidationReport validate(
+            const std::vector<int>& shiftToStaffIndex,
+            const std::vector<std::vector<int>>& shiftToTaskIndices,
+            unsigned threadCount = 0
+        ) const {
+            auto begin = std::chrono::steady_clock::now();
+            ValidationReport report;
+
+            // 步骤1: 班次编号 → 临时任务（占用时间段）
+            std::unordered_map<std::string, std::vector<int>> shiftIdToTempTasks;
+            for (int i = 0; i < static_cast<int>(temporaryTasks_.size()); ++i) {
+                shiftIdToTempTasks[temporaryTasks_[i].getShiftId()].push_back(i);
+            }
+
+            // 步骤2: 员工 → 班次列表（员工时间线的划分单位）
+            const int numStaff = static_cast<int>(staffList_.size());
+            std::vector<std::vector<int>> staffToShifts(numStaff);
+            const int numShift = std::min(static_cast<int>(shiftList_.size()), static_cast<int>(shiftToStaffIndex.size()));
+            for (int s = 0; s < numShift; ++s) {
+                int staffIdx = shiftToStaffIndex[s];
+                if (staffIdx >= 0 && staffIdx < numStaff) {
+                    staffToShifts[staffIdx].push_back(s);
+                }
+            }
+
+            // 步骤3: 按员工分片并行检查，每个线程写自己的结果，最后按员工顺序合并（结果与线程数无关）
+            unsigned hw = threadCount > 0 ? threadCount : std::thread::hardware_concurrency();
+            if (hw == 0) hw = 1;
+            const int minStaffPerThread = 16;
+            int numThreads = std::max(1, std::min(static_cast<int>(hw), numStaff / minStaffPerThread));
+            std::vector<std::vector<Violation>> perStaff(numStaff);
+
+            auto worker = [&](int first, int last) {
+                for (int staffIdx = first; staffIdx < last; ++staffIdx) {
+                    checkStaffTimeline(staffIdx, staffToShifts[staffIdx], shiftToTaskIndices,
+                        shiftIdToTempTasks, perStaff[staffIdx]);
+                }
+            };
+
+            if (numThreads == 1) {
+                worker(0, numStaff);
+            }
+            else {
+                std::vector<std::thread> threads;
+                int chunk = (numStaff + numThreads - 1) / numThreads;
+                for (int t = 0; t < numThreads; ++t) {
+                    int first = t * chunk;
+                    int last = std::min(numStaff, first + chunk);
+                    if (first >= last) break;
+                    threads.emplace_back(worker, first, last);
+                }
+                for (auto& th : threads) th.join();
+            }
+
+            for (int staffIdx = 0; staffIdx < numStaff; ++staffIdx) {
+                if (!staffToShifts[staffIdx].empty()) report.checkedStaffCount++;
+                for (auto& v : perStaff[staffIdx]) {
+                    report.countByType[static_cast<int>(v.type)]++;
+                    report.violations.push_back(std::move(v));
+                }
+            }
+            for (int s = 0; s < numShift && s < static_cast<int>(shiftToTaskIndices.size()); ++s) {
+                report.checkedTaskCount += static_cast<int>(shiftToTaskIndices[s].size());
+            }
+
+            report.elapsedMs = std::chrono::duration<double, std::milli>(
+                std::chrono::steady_clock::now() - begin).count();
+            return report;
+        }
+
+    private:
+        // 时间线上的一段占用
+        struct TimelineItem {
+            long start;
+            long end;
+            int shiftIdx;
+            int taskIdx;   // -1 表示临时任务
+            int tempIdx;
+        };
+
+        static long toSeconds(const DateTime& t) {
+            return static_cast<long>(std::chrono::duration_cast<std::chrono::seconds>(t.time_since_epoch()).count());
+        }
+
+        void addViolation(std::vector<Violation>& out, ViolationType type, int staffIdx, const TimelineItem& item,
+            int otherTaskIdx, long amount, const std::string& detail) const {
+            Violation v;
+            v.type = type;
+            v.staffIdx = staffIdx;
+            v.shiftIdx = item.shiftIdx;
+            v.taskIdx = item.taskIdx;
+            v.otherTaskIdx = otherTaskIdx;
+            v.amountSeconds = amount;
+            v.detail = detail;
+            out.push_back(std::move(v));
+        }
+
+        std::string itemName(const TimelineItem& item) const {
+            return item.taskIdx >= 0 ? tasks_[item.taskIdx].getTaskId()
+                                     : "临时任务:" + temporaryTasks_[item.tempIdx].getTaskName();
+        }
+
+        // 检查单个员工的时间线：排序 O(k log k)，其余检查线性扫描
+        void checkStaffTimeline(
+            int staffIdx,
+            const std::vector<int>& shifts,
+            const std::vector<std::vector<int>>& shiftToTaskIndices,
+            const std::unordered_map<std::string, std::vector<int>>& shiftIdToTempTasks,
+            std::vector<Violation>& out
+        ) const {
+            const Staff& staff = staffList_[staffIdx];
+            std::vector<TimelineItem> timeline;
+
+            for (int shiftIdx : shifts) {
+                const Shift& shift = shiftList_[shiftIdx];
+                long shiftStart = toSeconds(shift.getStartTime());
+                long shiftEnd = toSeconds(shift.getEndTime());
+                long allowedEnd = shiftEnd + (shift.isAllowOvertime() ? rules_.maxOvertimeSeconds : 0);
+
+                if (shiftIdx < static_cast<int>(shiftToTaskIndices.size())) {
+                    for (int taskIdx : shiftToTaskIndices[shiftIdx]) {
+                        if (taskIdx < 0 || taskIdx >= static_cast<int>(tasks_.size())) continue;
+                        const Task& task = tasks_[taskIdx];
+                        TimelineItem item{ toSeconds(task.getTaskStartTime()), toSeconds(task.getTaskEndTime()),
+                                           shiftIdx, taskIdx, -1 };
+
+                        // 资质检查
+                        if (!staff.hasAllQualifications(task.getRequiredQualifications())) {
+                            addViolation(out, ViolationType::QUALIFICATION, staffIdx, item, -1, 0,
+                                staff.getStaffId() + " 缺少任务 " + task.getTaskId() + " 所需资质");
+                        }
+
+                        // 班次时间窗检查
+                        long early = shiftStart - item.start;
+                        long late = item.end - allowedEnd;
+                        if (early > 0 || late > 0) {
+                            addViolation(out, ViolationType::SHIFT_WINDOW, staffIdx, item, -1, std::max(early, late),
+                                "任务 " + task.getTaskId() + " 超出班次 " + shift.getShiftId() + " 的时间范围");
+                        }
+                        timeline.push_back(item);
+                    }
+                }
+
+                auto tempIt = shiftIdToTempTasks.find(shift.getShiftId());
+                if (tempIt != shiftIdToTempTasks.end()) {
+                    for (int tempIdx : tempIt->second) {
+                        const TemporaryTask& temp = temporaryTasks_[tempIdx];
+                        timeline.push_back(TimelineItem{ toSeconds(temp.getStartTime()), toSeconds(temp.getEndTime()),
+                                                         shiftIdx, -1, tempIdx });
+                    }
+                }
+            }
+
+            if (timeline.size() < 2 && rules_.maxContinuousWorkSeconds <= 0) return;
+            std::sort(timeline.begin(), timeline.end(), [](const TimelineItem& a, const TimelineItem& b) {
+                return a.start != b.start ? a.start < b.start : a.end < b.end;
+            });
+
+            const long allowedOverlap = rules_.allowOverlap ? rules_.maxOverlapSeconds : 0;
+            int latestIdx = -1;     // 结束时间最晚的已扫描项
+            long blockStart = 0;    // 当前连续工作段
+            long blockEnd = 0;
+
+            for (int i = 0; i < static_cast<int>(timeline.size()); ++i) {
+                const TimelineItem& cur = timeline[i];
+
+                if (latestIdx >= 0) {
+                    const TimelineItem& prev = timeline[latestIdx];
+                    long gap = cur.start - prev.end;
+
+                    if (gap < -allowedOverlap) {
+                        // 重叠检查
+                        addViolation(out, ViolationType::OVERLAP, staffIdx, cur, prev.taskIdx, -gap,
+                            itemName(cur) + " 与 " + itemName(prev) + " 时间重叠");
+                    }
+                    else if (cur.taskIdx >= 0 && prev.taskIdx >= 0) {
+                        const Task& prevTask = tasks_[prev.taskIdx];
+                        const Task& curTask = tasks_[cur.taskIdx];
+
+                        // 路程时间检查
+                        long travel = rules_.getTravelSeconds(prevTask.getTaskId(), curTask.getTaskId());
+                        if (gap < travel) {
+                            addViolation(out, ViolationType::TRAVEL_TIME, staffIdx, cur, prev.taskIdx, travel - gap,
+                                prevTask.getTaskId() + " → " + curTask.getTaskId() + " 间隔小于路程时间");
+                        }
+
+                        // 航班衔接规则检查
+                        const ConnectIntervalRule* rule = rules_.findConnectRule(prevTask, curTask);
+                        if (rule && gap < rule->minIntervalSeconds) {
+                            addViolation(out, ViolationType::CONNECT_RULE, staffIdx, cur, prev.taskIdx,
+                                rule->minIntervalSeconds - gap,
+                                prevTask.getTaskId() + " → " + curTask.getTaskId() + " 间隔小于衔接规则");
+                        }
+                    }
+                }
+
+                // 连续工作/休息检查：间隔不足最小休息时长的任务合并为一个连续工作段
+                if (rules_.maxContinuousWorkSeconds > 0) {
+                    long before = 0;
+                    if (i == 0 || cur.start - blockEnd >= rules_.minContinuousRestSeconds) {
+                        blockStart = cur.start;
+                        blockEnd = cur.end;
+                    }
+                    else {
+                        before = blockEnd - blockStart;
+                        blockEnd = std::max(blockEnd, cur.end);
+                    }
+                    long length = blockEnd - blockStart;
+                    // 只在连续工作段首次超时时记录一次
+                    if (length > rules_.maxContinuousWorkSeconds && before <= rules_.maxContinuousWorkSeconds) {
+                        addViolation(out, ViolationType::CONTINUOUS_WORK, staffIdx, cur, -1,
+                            length - rules_.maxContinuousWorkSeconds,
+                            staff.getStaffId() + " 到 " + itemName(cur) + " 为止连续工作超过上限");
+                    }
+                }
+
+                if (latestIdx < 0 || cur.end > timeline[latestIdx].end) {
+                    latestIdx = i;
+                }
+            }
+        }
+
+        const std::vector<Task>& tasks_;
+        const std::vector<Staff>& staffList_;
+        const std::vector<Shift>& shiftList_;
+        const std::vector<TemporaryTask>& temporaryTasks_;
+        const ValidationRules& rules_;
+    };
+
+} // namespace AirportStaffScheduler
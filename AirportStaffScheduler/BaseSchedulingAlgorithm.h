@@ -5,7 +5,9 @@
 #include "Staff.h"
 #include "Shift.h"
 #include "TemporaryTask.h"
+#include "AssignmentValidator.h"
 #include <unordered_map>
+#include <iostream>
 
 namespace AirportStaffScheduler {
 
@@ -114,12 +116,25 @@ namespace AirportStaffScheduler {
         const std::vector<Task>& getTasks() const { return tasks_; }
         const std::vector<Staff>& getStaffList() const { return staffList_; }
         const std::vector<TemporaryTask>& getTemporaryTasks() const { return temporaryTasks_; }
+        const ValidationReport& getValidationReport() const { return validationReport_; }
+
+        // У򣨿 ValidationRules::fromRuleTable  parameter.csv / connectRule.csv ɣ
+        void setValidationRules(const ValidationRules& rules) { validationRules_ = rules; }
+        const ValidationRules& getValidationRules() const { return validationRules_; }
 
     protected:
         virtual void preprocessTasks() {}
         virtual void assignTasksToShiftImpl() = 0;
         virtual void validateAssignmentResult() {
-            // 
+            // 飺Աʱ߲мԼΥ handleValidationFailure
+            AssignmentValidator validator(tasks_, staffList_, shiftList_, temporaryTasks_, validationRules_);
+            validationReport_ = validator.validate(shiftToStaffIndex_, shiftToTaskIndices_);
+            for (const auto& v : validationReport_.violations) {
+                handleValidationFailure(v.taskIdx, v.staffIdx, v.message());
+            }
+            if (!validationReport_.ok()) {
+                std::cerr << validationReport_.summary() << std::endl;
+            }
         }
 
         virtual void handleValidationFailure(int taskIdx, int staffIdx, const std::string& reason) {
@@ -132,6 +147,10 @@ namespace AirportStaffScheduler {
         std::vector<Shift> shiftList_;
         std::vector<TemporaryTask> temporaryTasks_;
 
+        // === У ===
+        ValidationRules validationRules_;
+        ValidationReport validationReport_;
+
         // === ϵ ID ӳ䣩===
         std::vector<int> shiftToStaffIndex_;             //   Ա
         std::vector<std::vector<int>> staffToShiftIndices_; // Ա  б
@@ -0,0 +1,385 @@
+/**
+ * @file BreakTimeline.h
+ * @brief 休息/用餐时段（break.csv）作为人员时间线上的占用区间
+ *
+ * break.csv每行是一名员工的一次休息：
+ * - 锁定（是否锁定=Y）：固定占用[休息开始时间, 休息结束时间)，与之重叠的任务不能派给该员工；
+ * - 未锁定：时长为休息结束时间 - 休息开始时间，可在前后浮动窗口内移动（默认前后各1小时），
+ *   派工时只要求窗口内仍能找到一段不与任务、锁定休息和其他用餐重叠的空档，
+ *   任务占用当前位置时把用餐挪到离原定时间最近的空档，派工结束时的位置即输出的用餐时间。
+ *
+ * 时间线的所有者（owner）由调用方决定：装卸按小组（组员一起作业，任一组员的休息都占用小组），
+ * VIP/头等舱按员工。每个所有者的任务区间按开始时间有序保存，找空档时二分查找窗口内的
+ * 第一个任务再顺序扫描窗口内的少数几个区间，即O(log n + k)，k为窗口内的任务数。
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <climits>
+#include <cstdlib>
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace AirportStaffScheduler {
+namespace Breaks {
+
+/**
+ * @brief 员工的一次休息（break.csv的一行，时间为当天秒数）
+ */
+struct StaffBreak {
+    std::string staff_id;        ///< 员工编号
+    std::string name;            ///< 任务名（如"吃饭"）
+    long start = 0;              ///< 休息开始时间
+    long end = 0;                ///< 休息结束时间
+    bool locked = true;          ///< 是否锁定（未锁定的休息可在浮动窗口内移动）
+};
+
+/**
+ * @brief 一次休息的最终位置（按员工展开）
+ */
+struct BreakPlacement {
+    std::string staff_id;        ///< 员工编号
+    std::string name;            ///< 任务名
+    long start = 0;              ///< 开始时间
+    long end = 0;                ///< 结束时间
+    bool locked = true;          ///< 是否锁定
+    bool conflict = false;       ///< 是否仍与任务重叠（锁定任务或强制分配挤占、窗口内没有空档）
+};
+
+/**
+ * @brief 所有者（小组或员工）时间线上的休息
+ */
+class BreakTimeline {
+public:
+    static const long DEFAULT_MEAL_FLOAT = 3600;   ///< 未锁定休息默认前后浮动1小时
+
+    /**
+     * @brief 构造函数
+     * @param meal_float 未锁定休息可以提前或推后的最长时间（秒）
+     */
+    explicit BreakTimeline(long meal_float = DEFAULT_MEAL_FLOAT) : meal_float_(meal_float) {}
+
+    /**
+     * @brief 清空时间线
+     * @param owner_count 所有者个数（编号0 ~ owner_count-1）
+     */
+    void reset(size_t owner_count) {
+        owners_.assign(owner_count, Owner());
+        breaks_.clear();
+    }
+
+    /**
+     * @brief 加入一次休息
+     * @return 休息编号（用于查询最终位置）
+     */
+    int addBreak(int owner, long start, long end, bool locked) {
+        Break item;
+        item.owner = owner;
+        item.locked = locked;
+        item.duration = std::max(0L, end - start);
+        item.nominal = start;
+        item.start = start;
+        item.window_start = locked ? start : start - meal_float_;
+        item.window_end = locked ? end : end + meal_float_;
+        int id = static_cast<int>(breaks_.size());
+        breaks_.push_back(item);
+        Owner& state = owners_[owner];
+        std::vector<int>& list = locked ? state.locked : state.meals;
+        list.push_back(id);
+        return id;
+    }
+
+    /**
+     * @brief 按员工加入休息，同一所有者的相同休息（如小组成员各自的同一次用餐）只记一次
+     * @param breaks 员工休息列表
+     * @param owner_of 员工编号 -> 所有者编号（-1表示不参与，休息保持原位）
+     * @return 与breaks一一对应的休息编号（-1表示不参与）
+     */
+    template <typename OwnerOf>
+    std::vector<int> addStaffBreaks(const std::vector<StaffBreak>& breaks, OwnerOf owner_of) {
+        std::vector<int> ids(breaks.size(), -1);
+        std::map<std::tuple<int, long, long, bool>, int> added;
+        for (size_t i = 0; i < breaks.size(); ++i) {
+            const StaffBreak& item = breaks[i];
+            int owner = owner_of(item.staff_id);
+            if (owner < 0) {
+                continue;
+            }
+            auto key = std::make_tuple(owner, item.start, item.end, item.locked);
+            auto found = added.find(key);
+            if (found == added.end()) {
+                found = added.insert(std::make_pair(key, addBreak(owner, item.start, item.end, item.locked))).first;
+            }
+            ids[i] = found->second;
+        }
+        return ids;
+    }
+
+    /**
+     * @brief 按员工展开休息的当前位置
+     * @param breaks 员工休息列表（与addStaffBreaks相同）
+     * @param ids addStaffBreaks返回的休息编号
+     * @param placements 输出参数，与breaks一一对应
+     */
+    void getPlacements(const std::vector<StaffBreak>& breaks, const std::vector<int>& ids,
+                       std::vector<BreakPlacement>& placements) const {
+        placements.clear();
+        placements.reserve(breaks.size());
+        for (size_t i = 0; i < breaks.size(); ++i) {
+            BreakPlacement placement;
+            placement.staff_id = breaks[i].staff_id;
+            placement.name = breaks[i].name;
+            placement.start = breaks[i].start;
+            placement.end = breaks[i].end;
+            placement.locked = breaks[i].locked;
+            if (i < ids.size() && ids[i] >= 0) {
+                placement.start = breakStart(ids[i]);
+                placement.end = breakEnd(ids[i]);
+                placement.conflict = breakConflict(ids[i]);
+            }
+            placements.push_back(placement);
+        }
+    }
+
+    /**
+     * @brief 所有者是否有休息（没有时其余检查都可以跳过）
+     */
+    bool hasBreaks(int owner) const {
+        return !owners_[owner].locked.empty() || !owners_[owner].meals.empty();
+    }
+
+    /**
+     * @brief 所有者执行[start, end)是否不占用锁定休息，且所有用餐仍能找到位置
+     */
+    bool canWork(int owner, long start, long end) const {
+        const Owner& state = owners_[owner];
+        if (state.locked.empty() && state.meals.empty()) {
+            return true;
+        }
+        for (int id : state.locked) {
+            const Break& item = breaks_[id];
+            if (overlaps(item.start, item.start + item.duration, start, end)) {
+                return false;
+            }
+        }
+        std::vector<long> starts;
+        return relocateMeals(state, start, end, starts);
+    }
+
+    /**
+     * @brief [start, end)是否占用所有者的锁定休息（强制分配时只检查锁定休息，用餐允许被挤占）
+     */
+    bool hitsLockedBreak(int owner, long start, long end) const {
+        for (int id : owners_[owner].locked) {
+            const Break& item = breaks_[id];
+            if (overlaps(item.start, item.start + item.duration, start, end)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief 记录所有者执行[start, end)，与之重叠的用餐挪到空档
+     * @return 休息都不受影响返回true；占用了锁定休息或有用餐挪不开（留在原处并标记冲突）时返回false
+     */
+    bool addWork(int owner, long start, long end) {
+        Owner& state = owners_[owner];
+        Span span;
+        span.start = start;
+        span.end = end;
+        auto it = std::upper_bound(state.busy.begin(), state.busy.end(), start,
+                                   [](long value, const Span& item) { return value < item.start; });
+        state.busy.insert(it, span);
+        state.max_busy = std::max(state.max_busy, end - start);
+        bool placed = true;
+        for (int id : state.locked) {
+            Break& item = breaks_[id];
+            if (overlaps(item.start, item.start + item.duration, start, end)) {
+                item.conflict = true;
+                placed = false;
+            }
+        }
+        if (state.meals.empty()) {
+            return placed;
+        }
+        std::vector<long> starts;
+        placed = relocateMeals(state, start, end, starts) && placed;
+        for (size_t i = 0; i < state.meals.size(); ++i) {
+            Break& meal = breaks_[state.meals[i]];
+            if (starts[i] != NO_SLOT) {
+                meal.start = starts[i];
+            } else {
+                meal.conflict = true;
+            }
+        }
+        return placed;
+    }
+
+    /**
+     * @brief 清空所有者的任务区间，休息回到原定位置，供按员工已分配任务重建时间线
+     */
+    void clearWork(int owner) {
+        Owner& state = owners_[owner];
+        state.busy.clear();
+        state.max_busy = 0;
+        for (int id : state.locked) {
+            breaks_[id].conflict = false;
+        }
+        for (int id : state.meals) {
+            breaks_[id].start = breaks_[id].nominal;
+            breaks_[id].conflict = false;
+        }
+    }
+
+    /**
+     * @brief 休息的当前开始时间
+     */
+    long breakStart(int id) const { return breaks_[id].start; }
+
+    /**
+     * @brief 休息的当前结束时间
+     */
+    long breakEnd(int id) const { return breaks_[id].start + breaks_[id].duration; }
+
+    /**
+     * @brief 休息是否因挪不开而与任务重叠
+     */
+    bool breakConflict(int id) const { return breaks_[id].conflict; }
+
+    /**
+     * @brief 休息个数
+     */
+    size_t size() const { return breaks_.size(); }
+
+private:
+    static const long NO_SLOT = LONG_MIN;
+
+    struct Span {
+        long start;
+        long end;
+    };
+
+    struct Break {
+        int owner = 0;
+        bool locked = true;
+        bool conflict = false;
+        long duration = 0;
+        long nominal = 0;               ///< 原定开始时间
+        long start = 0;                 ///< 当前开始时间
+        long window_start = 0;          ///< 可放置窗口
+        long window_end = 0;
+    };
+
+    struct Owner {
+        std::vector<Span> busy;         ///< 按开始时间有序的任务区间（强制分配时可能重叠）
+        long max_busy = 0;              ///< 最长任务区间，用于二分查找窗口内的第一个任务
+        std::vector<int> locked;        ///< 锁定休息编号
+        std::vector<int> meals;         ///< 未锁定休息编号
+    };
+
+    static bool overlaps(long a_start, long a_end, long b_start, long b_end) {
+        return a_start < b_end && b_start < a_end;
+    }
+
+    /**
+     * @brief 加入[start, end)后给每个用餐确定位置（与之不重叠的保持原位，否则找离原定时间最近的空档）
+     * @param starts 输出参数，每个用餐的位置（NO_SLOT表示找不到空档，仍留在原处）
+     * @return 所有用餐都有位置返回true
+     */
+    bool relocateMeals(const Owner& state, long start, long end, std::vector<long>& starts) const {
+        starts.resize(state.meals.size());
+        for (size_t i = 0; i < state.meals.size(); ++i) {
+            starts[i] = breaks_[state.meals[i]].start;
+        }
+        bool placed = true;
+        for (size_t i = 0; i < state.meals.size(); ++i) {
+            const Break& meal = breaks_[state.meals[i]];
+            if (meal.duration == 0 || !overlaps(starts[i], starts[i] + meal.duration, start, end)) {
+                continue;
+            }
+            starts[i] = findSlot(state, i, starts, start, end);
+            if (starts[i] == NO_SLOT) {
+                placed = false;
+            }
+        }
+        return placed;
+    }
+
+    /**
+     * @brief 在用餐窗口内找离原定时间最近、不与任务/锁定休息/其他用餐/[extra_start, extra_end)重叠的位置
+     */
+    long findSlot(const Owner& state, size_t meal_index, const std::vector<long>& starts,
+                  long extra_start, long extra_end) const {
+        const Break& meal = breaks_[state.meals[meal_index]];
+        long window_start = meal.window_start;
+        long window_end = meal.window_end;
+
+        // 窗口内的占用区间：任务（二分查找起点）+ 锁定休息 + 其他用餐 + 新任务
+        std::vector<Span> obstacles;
+        auto it = std::lower_bound(state.busy.begin(), state.busy.end(), window_start - state.max_busy,
+                                   [](const Span& item, long value) { return item.start < value; });
+        for (; it != state.busy.end() && it->start < window_end; ++it) {
+            if (it->end > window_start) {
+                obstacles.push_back(*it);
+            }
+        }
+        size_t task_count = obstacles.size();
+        Span extra;
+        extra.start = extra_start;
+        extra.end = extra_end;
+        obstacles.push_back(extra);
+        for (int id : state.locked) {
+            Span span;
+            span.start = breaks_[id].start;
+            span.end = breaks_[id].start + breaks_[id].duration;
+            obstacles.push_back(span);
+        }
+        for (size_t i = 0; i < state.meals.size(); ++i) {
+            if (i != meal_index && starts[i] != NO_SLOT) {
+                Span span;
+                span.start = starts[i];
+                span.end = starts[i] + breaks_[state.meals[i]].duration;
+                obstacles.push_back(span);
+            }
+        }
+        // 任务区间已有序，只需把少数几个额外区间插入
+        auto by_start = [](const Span& a, const Span& b) { return a.start < b.start; };
+        std::sort(obstacles.begin() + task_count, obstacles.end(), by_start);
+        std::inplace_merge(obstacles.begin(), obstacles.begin() + task_count, obstacles.end(), by_start);
+
+        long best = NO_SLOT;
+        long cursor = window_start;
+        auto consider = [&](long gap_start, long gap_end) {
+            gap_end = std::min(gap_end, window_end);
+            if (gap_end - gap_start < meal.duration) {
+                return;
+            }
+            long candidate = std::min(std::max(meal.nominal, gap_start), gap_end - meal.duration);
+            if (best == NO_SLOT || std::labs(candidate - meal.nominal) < std::labs(best - meal.nominal)) {
+                best = candidate;
+            }
+        };
+        for (const Span& span : obstacles) {
+            if (span.start >= window_end) {
+                break;
+            }
+            if (span.start > cursor) {
+                consider(cursor, span.start);
+            }
+            cursor = std::max(cursor, span.end);
+        }
+        consider(cursor, window_end);
+        return best;
+    }
+
+    long meal_float_;                   ///< 未锁定休息的浮动范围
+    std::vector<Owner> owners_;         ///< 每个所有者的时间线
+    std::vector<Break> breaks_;         ///< 所有休息
+};
+
+}  // namespace Breaks
+}  // namespace AirportStaffScheduler
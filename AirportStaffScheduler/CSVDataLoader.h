@@ -8,11 +8,13 @@
 #pragma once
 
 #include "CSVReader.h"
+#include "Logger.h"
 #include "vip_first_class_algo/employee_info.h"
 #include "vip_first_class_algo/shift.h"
 #include "vip_first_class_algo/task_definition.h"
 #include "zhuangxie_class/load_employee_info.h"
 #include "zhuangxie_class/load_task.h"
+#include "zhuangxie_class/connect_rule_table.h"
 #include "CommonAdapterUtils.h"
 #include "Task.h"
 #include "DateTimeUtils.h"
@@ -60,11 +62,12 @@ inline int inferQualificationFromPosition(const std::string& position) {
  * @return 员工信息列表
  */
 inline std::vector<vip_first_class::EmployeeInfo> loadEmployeesFromCSV(const std::string& filename) {
+    PROFILE_SCOPE_DETAIL("csv.load.employees", filename);
     std::vector<vip_first_class::EmployeeInfo> employees;
     
     auto rows = CSVUtils::readCSV(filename, true);
     if (rows.empty()) {
-        std::cerr << "警告：CSV文件为空或无法读取: " << filename << std::endl;
+        LOG_WARN("警告：CSV文件为空或无法读取: " << filename);
         return employees;
     }
     
@@ -107,7 +110,7 @@ inline std::vector<vip_first_class::EmployeeInfo> loadEmployeesFromCSV(const std
         employees.push_back(emp);
     }
     
-    // std::cout << "从CSV加载了 " << employees.size() << " 个员工" << std::endl;  // 减少输出
+    LOG_DEBUG("从CSV加载了 " << employees.size() << " 个员工");
     return employees;
 }
 
@@ -117,19 +120,20 @@ inline std::vector<vip_first_class::EmployeeInfo> loadEmployeesFromCSV(const std
  * @return 装卸员工信息列表
  */
 inline std::vector<zhuangxie_class::LoadEmployeeInfo> loadLoadEmployeesFromCSV(const std::string& filename) {
+    PROFILE_SCOPE_DETAIL("csv.load.load_employees", filename);
     std::vector<zhuangxie_class::LoadEmployeeInfo> employees;
     
     // 检查文件是否存在
     std::ifstream test_file(filename);
     if (!test_file.is_open()) {
-        std::cerr << "ERROR: Cannot open CSV file: " << filename << std::endl;
+        LOG_ERROR("ERROR: Cannot open CSV file: " << filename);
         return employees;
     }
     test_file.close();
     
     auto rows = CSVUtils::readCSV(filename, true);
     if (rows.empty()) {
-        std::cerr << "WARNING: CSV file is empty or cannot be read: " << filename << std::endl;
+        LOG_WARN("WARNING: CSV file is empty or cannot be read: " << filename);
         return employees;
     }
     
@@ -149,9 +153,9 @@ inline std::vector<zhuangxie_class::LoadEmployeeInfo> loadLoadEmployeesFromCSV(c
     auto header = CSVUtils::parseCSVLine(header_line);
     
     // DEBUG: 输出原始表头
-    std::cerr << "DEBUG: Raw header size: " << header.size() << std::endl;
+    LOG_DEBUG("DEBUG: Raw header size: " << header.size());
     for (size_t i = 0; i < header.size(); ++i) {
-        std::cerr << "DEBUG: Raw header[" << i << "]: [" << header[i] << "]" << std::endl;
+        LOG_DEBUG("DEBUG: Raw header[" << i << "]: [" << header[i] << "]");
     }
     
     // 清理表头，去除引号和空格，并创建原始列名到清理后列名的映射
@@ -161,7 +165,7 @@ inline std::vector<zhuangxie_class::LoadEmployeeInfo> loadLoadEmployeesFromCSV(c
         std::string cleaned = CSVUtils::trimQuotes(h);
         cleaned_header.push_back(cleaned);
         header_to_cleaned[h] = cleaned;
-        std::cerr << "DEBUG: Header mapping: [" << h << "] -> [" << cleaned << "]" << std::endl;
+        LOG_DEBUG("DEBUG: Header mapping: [" << h << "] -> [" << cleaned << "]");
     }
     
     // 创建清理后列名到原始列名的反向映射（用于查找）
@@ -273,7 +277,7 @@ inline std::vector<zhuangxie_class::LoadEmployeeInfo> loadLoadEmployeesFromCSV(c
     }
     
     if (!has_emp_id) {
-        std::cerr << "ERROR: CSV file missing required column '员工编号' (employee ID)." << std::endl;
+        LOG_ERROR("ERROR: CSV file missing required column '员工编号' (employee ID).");
         return employees;
     }
     
@@ -363,10 +367,10 @@ inline std::vector<zhuangxie_class::LoadEmployeeInfo> loadLoadEmployeesFromCSV(c
     }
     
     if (employees.empty() && skipped_rows > 0) {
-        std::cerr << "WARNING: All " << skipped_rows << " rows were skipped due to empty employee ID" << std::endl;
+        LOG_WARN("WARNING: All " << skipped_rows << " rows were skipped due to empty employee ID");
     }
     
-    // std::cout << "从CSV加载了 " << employees.size() << " 个装卸员工" << std::endl;  // 减少输出
+    LOG_DEBUG("从CSV加载了 " << employees.size() << " 个装卸员工");
     return employees;
 }
 
@@ -376,11 +380,12 @@ inline std::vector<zhuangxie_class::LoadEmployeeInfo> loadLoadEmployeesFromCSV(c
  * @return 班次列表
  */
 inline std::vector<vip_first_class::Shift> loadShiftsFromCSV(const std::string& filename) {
+    PROFILE_SCOPE_DETAIL("csv.load.shifts", filename);
     std::vector<vip_first_class::Shift> shifts;
     
     auto rows = CSVUtils::readCSV(filename, true);
     if (rows.empty()) {
-        std::cerr << "警告：CSV文件为空或无法读取: " << filename << std::endl;
+        LOG_WARN("警告：CSV文件为空或无法读取: " << filename);
         return shifts;
     }
     
@@ -478,7 +483,7 @@ inline std::vector<vip_first_class::Shift> loadShiftsFromCSV(const std::string&
         }
     }
     
-    // std::cout << "从CSV加载了 " << shifts.size() << " 个班次" << std::endl;  // 减少输出
+    LOG_DEBUG("从CSV加载了 " << shifts.size() << " 个班次");
     return shifts;
 }
 
@@ -492,12 +497,13 @@ inline std::vector<vip_first_class::Shift> loadShiftsFromCSV(const std::string&
 inline bool loadEmployeesFromShiftCSV(const std::string& filename,
                                        std::vector<zhuangxie_class::LoadEmployeeInfo>& employees,
                                        std::map<std::string, std::vector<std::string>>& group_name_to_employees) {
+    PROFILE_SCOPE_DETAIL("csv.load.shift_employees", filename);
     employees.clear();
     group_name_to_employees.clear();
     
     auto rows = CSVUtils::readCSV(filename, true);
     if (rows.empty()) {
-        std::cerr << "警告：CSV文件为空或无法读取: " << filename << std::endl;
+        LOG_WARN("警告：CSV文件为空或无法读取: " << filename);
         return false;
     }
     
@@ -538,7 +544,7 @@ inline bool loadEmployeesFromShiftCSV(const std::string& filename,
             }
     
     if (emp_id_key.empty() || group_name_key.empty()) {
-        std::cerr << "ERROR: shift.csv missing required columns" << std::endl;
+        LOG_ERROR("ERROR: shift.csv missing required columns");
         return false;
     }
     
@@ -605,11 +611,12 @@ inline long dateTimeToSeconds(const DateTime& dt) {
  * @return 机位到是否远机位的映射（机位号字符串 -> 是否远机位）
  */
 inline std::map<std::string, bool> loadStandPositionsFromCSV(const std::string& filename) {
+    PROFILE_SCOPE_DETAIL("csv.load.stands", filename);
     std::map<std::string, bool> stand_map;
     
     auto rows = CSVUtils::readCSV(filename, true);
     if (rows.empty()) {
-        std::cerr << "WARNING: Stand position CSV file is empty or cannot be read: " << filename << std::endl;
+        LOG_WARN("WARNING: Stand position CSV file is empty or cannot be read: " << filename);
         return stand_map;
     }
     
@@ -653,6 +660,7 @@ inline bool loadLoadTasksFromCSV(
     const std::string& filename,
     std::vector<zhuangxie_class::LoadTask>& tasks,
     const std::string& stand_pos_file = "") {
+    PROFILE_SCOPE_DETAIL("csv.load.load_tasks", filename);
     
     tasks.clear();
     
@@ -664,7 +672,7 @@ inline bool loadLoadTasksFromCSV(
     
     auto rows = CSVUtils::readCSV(filename, true);
     if (rows.empty()) {
-        std::cerr << "WARNING: CSV file is empty or cannot be read: " << filename << std::endl;
+        LOG_WARN("WARNING: CSV file is empty or cannot be read: " << filename);
         return false;
     }
     
@@ -710,6 +718,7 @@ inline bool loadLoadTasksFromCSV(
         std::string arrival_estimated_time_key = findColumn({"到达航班预达时间"});
         std::string departure_estimated_time_key = findColumn({"出发航班预离时间"});
         std::string flight_type_key = findColumn({"航班类型"});
+        std::string body_type_key = findColumn({"机型类型"});
         std::string stand_key = findColumn({"机位"});
         std::string min_staff_key = findColumn({"任务对应的航班所需最少人数"});
         std::string cargo_weight_key = findColumn({"任务装卸货量"});
@@ -723,6 +732,7 @@ inline bool loadLoadTasksFromCSV(
         std::string arrival_estimated_time_str = arrival_estimated_time_key.empty() ? "" : CSVUtils::trimQuotes(row.count(arrival_estimated_time_key) ? row.at(arrival_estimated_time_key) : "");
         std::string departure_estimated_time_str = departure_estimated_time_key.empty() ? "" : CSVUtils::trimQuotes(row.count(departure_estimated_time_key) ? row.at(departure_estimated_time_key) : "");
         std::string flight_type_str = flight_type_key.empty() ? "" : CSVUtils::trimQuotes(row.count(flight_type_key) ? row.at(flight_type_key) : "");
+        std::string body_type_str = body_type_key.empty() ? "" : CSVUtils::trimQuotes(row.count(body_type_key) ? row.at(body_type_key) : "");
         std::string stand_str = stand_key.empty() ? "" : CSVUtils::trimQuotes(row.count(stand_key) ? row.at(stand_key) : "");
         std::string min_staff_str = min_staff_key.empty() ? "" : CSVUtils::trimQuotes(row.count(min_staff_key) ? row.at(min_staff_key) : "");
         std::string cargo_weight_str = cargo_weight_key.empty() ? "" : CSVUtils::trimQuotes(row.count(cargo_weight_key) ? row.at(cargo_weight_key) : "");
@@ -801,6 +811,7 @@ inline bool loadLoadTasksFromCSV(
             flight_type_enum = static_cast<int>(zhuangxie_class::FlightType::DOMESTIC_TRANSIT);
         }
         task.setFlightType(flight_type_enum);
+        task.setBodyType(zhuangxie_class::ConnectRuleTable::parseBodyType(body_type_str));
         
         // 设置机位
         int stand_num = 0;
@@ -893,6 +904,7 @@ inline bool loadLoadTasksFromReferscheduleCSV(
     const std::string& filename,
     std::vector<zhuangxie_class::LoadTask>& tasks,
     const std::string& stand_pos_file = "") {
+    PROFILE_SCOPE_DETAIL("csv.load.referschedule", filename);
     
     tasks.clear();
     
@@ -904,7 +916,7 @@ inline bool loadLoadTasksFromReferscheduleCSV(
     
     auto rows = CSVUtils::readCSV(filename, true);
     if (rows.empty()) {
-        std::cerr << "WARNING: CSV file is empty or cannot be read: " << filename << std::endl;
+        LOG_WARN("WARNING: CSV file is empty or cannot be read: " << filename);
         return false;
     }
     
@@ -1113,12 +1125,13 @@ inline bool loadLoadTasksFromReferscheduleCSV(
 inline bool loadVIPTasksFromCSV(
     const std::string& filename,
     std::vector<vip_first_class::TaskDefinition>& tasks) {
+    PROFILE_SCOPE_DETAIL("csv.load.vip_tasks", filename);
     
     tasks.clear();
     
     auto rows = CSVUtils::readCSV(filename, true);
     if (rows.empty()) {
-        std::cerr << "WARNING: CSV file is empty or cannot be read: " << filename << std::endl;
+        LOG_WARN("WARNING: CSV file is empty or cannot be read: " << filename);
         return false;
     }
     
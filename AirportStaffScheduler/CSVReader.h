@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include "Profiler.h"
 #include <string>
 #include <vector>
 #include <map>
@@ -14,6 +15,7 @@
 #include <sstream>
 #include <algorithm>
 #include <iostream>
+#include <thread>
 
 namespace AirportStaffScheduler {
 namespace CSVUtils {
@@ -51,51 +53,144 @@ inline std::vector<std::string> parseCSVLine(const std::string& line) {
     return fields;
 }
 
+/// 文件正文超过该大小时按行边界切块并行解析
+const size_t PARALLEL_PARSE_MIN_BYTES = 256 * 1024;
+
 /**
- * @brief 读取CSV文件
- * @param filename CSV文件路径
- * @param skip_header 是否跳过第一行（表头）
- * @return 行列表，每行是一个字段列表
+ * @brief 读取整个文件内容（文本模式，换行方式与逐行getline一致）
+ * @return 文件可打开返回true
  */
-inline std::vector<std::vector<std::string>> readCSV(const std::string& filename, bool skip_header = true) {
-    std::vector<std::vector<std::string>> rows;
+inline bool readFileContent(const std::string& filename, std::string& content) {
     std::ifstream file(filename);
-    
     if (!file.is_open()) {
-        std::cerr << "错误：无法打开CSV文件: " << filename << std::endl;
-        return rows;
+        return false;
     }
-    
+    std::ostringstream buffer;
+    buffer << file.rdbuf();
+    content = buffer.str();
+    return true;
+}
+
+// 辅助函数：跳过UTF-8 BOM，返回正文起始位置
+inline size_t skipBOM(const std::string& content) {
+    if (content.length() >= 3 &&
+        static_cast<unsigned char>(content[0]) == 0xEF &&
+        static_cast<unsigned char>(content[1]) == 0xBB &&
+        static_cast<unsigned char>(content[2]) == 0xBF) {
+        return 3;
+    }
+    return 0;
+}
+
+// 辅助函数：取出从pos开始的一行（去除行尾\r），返回下一行的起始位置
+inline size_t nextLine(const std::string& content, size_t pos, std::string& line) {
+    size_t eol = content.find('\n', pos);
+    size_t end = eol == std::string::npos ? content.length() : eol;
+    line.assign(content, pos, end - pos);
+    if (!line.empty() && line.back() == '\r') {
+        line.pop_back();
+    }
+    return eol == std::string::npos ? content.length() : eol + 1;
+}
+
+/**
+ * @brief 解析[begin, end)内的所有行（跳过空行）
+ */
+inline void parseCSVLines(const std::string& content, size_t begin, size_t end,
+                          std::vector<std::vector<std::string>>& rows) {
     std::string line;
-    bool first_line = true;
-    
-    while (std::getline(file, line)) {
-        // 跳过BOM（如果存在）
-        if (first_line && line.length() >= 3 && 
-            static_cast<unsigned char>(line[0]) == 0xEF &&
-            static_cast<unsigned char>(line[1]) == 0xBB &&
-            static_cast<unsigned char>(line[2]) == 0xBF) {
-            line = line.substr(3);
-        }
-        
-        // 去除行尾的\r（Windows换行符）
-        if (!line.empty() && line.back() == '\r') {
-            line.pop_back();
+    size_t pos = begin;
+    while (pos < end) {
+        pos = nextLine(content, pos, line);
+        if (!line.empty()) {
+            rows.push_back(parseCSVLine(line));
         }
-        
-        if (skip_header && first_line) {
-            first_line = false;
+    }
+}
+
+/**
+ * @brief 解析[begin, content末尾)内的所有行，正文较大时按行边界切块由多个线程并行解析，
+ *        结果按原文件顺序拼接（与逐行解析结果相同）
+ * @param max_threads 最大线程数（0表示按硬件线程数）
+ */
+inline void parseCSVLinesParallel(const std::string& content, size_t begin,
+                                  std::vector<std::vector<std::string>>& rows, unsigned max_threads = 0) {
+    size_t length = content.length() > begin ? content.length() - begin : 0;
+    unsigned thread_count = max_threads > 0 ? max_threads : std::thread::hardware_concurrency();
+    size_t max_chunks = length / PARALLEL_PARSE_MIN_BYTES + 1;
+    if (thread_count > max_chunks) {
+        thread_count = static_cast<unsigned>(max_chunks);
+    }
+    if (thread_count <= 1) {
+        parseCSVLines(content, begin, content.length(), rows);
+        return;
+    }
+
+    // 切块边界对齐到换行符之后
+    std::vector<size_t> bounds(1, begin);
+    for (unsigned i = 1; i < thread_count; ++i) {
+        size_t target = begin + length / thread_count * i;
+        if (target <= bounds.back()) {
             continue;
         }
-        
-        if (!line.empty()) {
-            rows.push_back(parseCSVLine(line));
+        size_t eol = content.find('\n', target);
+        if (eol == std::string::npos) {
+            break;
         }
-        
-        first_line = false;
+        bounds.push_back(eol + 1);
     }
-    
-    file.close();
+    bounds.push_back(content.length());
+
+    std::vector<std::vector<std::vector<std::string>>> chunks(bounds.size() - 1);
+    std::vector<std::thread> workers;
+    for (size_t i = 1; i < chunks.size(); ++i) {
+        workers.emplace_back([&content, &bounds, &chunks, i]() {
+            PROFILE_SCOPE("csv.parse_chunk");
+            parseCSVLines(content, bounds[i], bounds[i + 1], chunks[i]);
+        });
+    }
+    {
+        PROFILE_SCOPE("csv.parse_chunk");
+        parseCSVLines(content, bounds[0], bounds[1], chunks[0]);
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    size_t total = rows.size();
+    for (const auto& chunk : chunks) {
+        total += chunk.size();
+    }
+    rows.reserve(total);
+    for (auto& chunk : chunks) {
+        for (auto& row : chunk) {
+            rows.push_back(std::move(row));
+        }
+    }
+}
+
+/**
+ * @brief 读取CSV文件（整个文件一次读入，大文件按行边界并行解析）
+ * @param filename CSV文件路径
+ * @param skip_header 是否跳过第一行（表头）
+ * @return 行列表，每行是一个字段列表
+ */
+inline std::vector<std::vector<std::string>> readCSV(const std::string& filename, bool skip_header = true) {
+    PROFILE_SCOPE_DETAIL("csv.read", filename);
+    std::vector<std::vector<std::string>> rows;
+    std::string content;
+    if (!readFileContent(filename, content)) {
+        std::cerr << "错误：无法打开CSV文件: " << filename << std::endl;
+        return rows;
+    }
+
+    // 跳过BOM（如果存在）
+    size_t pos = skipBOM(content);
+    if (skip_header && !content.empty()) {
+        std::string header;
+        pos = nextLine(content, pos, header);
+    }
+    parseCSVLinesParallel(content, pos, rows);
     return rows;
 }
 
@@ -74,7 +74,7 @@ namespace AirportStaffScheduler {
     }
 
     void CheckInSchedulingAlgorithm::validateAssignmentResult() {
-        
+        BaseSchedulingAlgorithm::validateAssignmentResult();
     }
 
 } // namespace AirportStaffScheduler
\ No newline at end of file
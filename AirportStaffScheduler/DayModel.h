@@ -0,0 +1,934 @@
+/**
+ * @file DayModel.h
+ * @brief 统一的单日问题模型（列式存储）
+ *
+ * 将一天的任务、人员、班组、机位和规则按列保存在一处，各调度模块
+ * （值机、VIP/头等舱、装卸）通过轻量视图按行号读取，输入文件只读取一次，
+ * 模块之间串联时也不再经过公共类的整体拷贝转换。
+ */
+
+#pragma once
+
+#include "CSVReader.h"
+#include "LoadPipeline.h"
+#include <string>
+#include <vector>
+#include <map>
+#include <unordered_map>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+
+namespace AirportStaffScheduler {
+namespace Model {
+
+/**
+ * @brief 字符串池
+ *
+ * 把任务ID、人员ID、机位等字符串映射为连续的整数编号，0号固定为空字符串
+ */
+class StringPool {
+public:
+    StringPool() { clear(); }
+
+    /**
+     * @brief 获取字符串的编号，不存在时加入字符串池
+     * @param str 字符串
+     * @return 字符串编号
+     */
+    int intern(const std::string& str) {
+        auto it = index_.find(str);
+        if (it != index_.end()) {
+            return it->second;
+        }
+        int id = static_cast<int>(strings_.size());
+        strings_.push_back(str);
+        index_[str] = id;
+        return id;
+    }
+
+    /**
+     * @brief 查找字符串的编号（不插入）
+     * @param str 字符串
+     * @return 字符串编号，不存在返回-1
+     */
+    int find(const std::string& str) const {
+        auto it = index_.find(str);
+        return it == index_.end() ? -1 : it->second;
+    }
+
+    /**
+     * @brief 根据编号获取字符串
+     * @param id 字符串编号
+     * @return 字符串常量引用
+     */
+    const std::string& get(int id) const { return strings_[id]; }
+
+    /**
+     * @brief 获取字符串池大小
+     */
+    size_t size() const { return strings_.size(); }
+
+    /**
+     * @brief 清空字符串池（保留0号空字符串）
+     */
+    void clear() {
+        strings_.clear();
+        index_.clear();
+        strings_.push_back("");
+        index_[""] = 0;
+    }
+
+private:
+    std::vector<std::string> strings_;                ///< 编号 -> 字符串
+    std::unordered_map<std::string, int> index_;      ///< 字符串 -> 编号
+};
+
+/**
+ * @brief 任务列（task.csv，每行一个任务）
+ *
+ * 字符串字段保存字符串池编号，时间字段为当天秒数（与CSVUtils::parseDateTimeString一致）
+ */
+struct TaskColumns {
+    std::vector<int> task_id;                  ///< 任务ID
+    std::vector<int> task_name;                ///< 任务名称
+    std::vector<int> task_date;                ///< 任务日期
+    std::vector<long> start_time;              ///< 任务开始时间（秒）
+    std::vector<long> duration;                ///< 任务时长（秒）
+    std::vector<long> arrival_time;            ///< 到达航班预达时间（秒）
+    std::vector<long> departure_time;          ///< 出发航班预离时间（秒）
+    std::vector<int> in_out;                   ///< 进/出港
+    std::vector<int> flight_attribute;         ///< 航班类型（短过站、航后等）
+    std::vector<int> body_type;                ///< 机型类型（窄体、宽体）
+    std::vector<int> arrival_flight_id;        ///< 到达航班ID
+    std::vector<int> departure_flight_id;      ///< 出发航班ID
+    std::vector<int> arrival_flight_number;    ///< 到达航班号
+    std::vector<int> departure_flight_number;  ///< 出发航班号
+    std::vector<int> terminal;                 ///< 航站楼
+    std::vector<int> stand;                    ///< 机位
+    std::vector<int> required_qualification;   ///< 任务资质要求
+    std::vector<int> required_count;           ///< 航班所需最少人数（0表示未给出）
+    std::vector<double> cargo_weight;          ///< 任务装卸货量（吨，未给出为-1）
+    std::vector<int> service;                  ///< 服务项
+    std::vector<int> vehicle_type;             ///< 任务所需车辆类型（空表示不需要车辆）
+
+    // ===== 分配结果（由各模块视图回写） =====
+    std::vector<long> actual_start_time;                   ///< 实际开始时间（0表示未分配）
+    std::vector<std::vector<int>> assigned_staff;          ///< 已分配人员（人员行号）
+
+    size_t size() const { return task_id.size(); }
+};
+
+/**
+ * @brief 人员列（shift.csv + staff.csv，每个员工一行）
+ */
+struct StaffColumns {
+    std::vector<int> staff_id;                 ///< 员工编号
+    std::vector<int> staff_name;               ///< 人员姓名
+    std::vector<int> group;                    ///< 所属班组行号（-1表示无班组）
+    std::vector<int> shift_name;               ///< 班次名称
+    std::vector<long> shift_start;             ///< 班期开始时间（秒）
+    std::vector<long> shift_end;               ///< 班期结束时间（秒）
+    std::vector<char> allow_overtime;          ///< 是否允许加班
+    std::vector<char> is_backup;               ///< 是否备班
+    std::vector<int> qualification;            ///< 员工资质集合（staff.csv）
+    std::vector<int> position;                 ///< 岗位（staff.csv）
+
+    size_t size() const { return staff_id.size(); }
+};
+
+/**
+ * @brief 班组列（按shift.csv中首次出现的顺序编号）
+ *
+ * 组成员以CSR方式保存：第g组成员为members[member_begin[g], member_begin[g+1])
+ */
+struct GroupColumns {
+    std::vector<int> group_name;               ///< 班组名
+    std::vector<int> shift_type;               ///< 班次类型（0=休息，1=主班，2=副班）
+    std::vector<int> member_begin;             ///< 成员起始下标（长度为组数+1）
+    std::vector<int> members;                  ///< 成员人员行号
+
+    size_t size() const { return group_name.size(); }
+};
+
+/**
+ * @brief 机位列（stand_pos.csv）
+ */
+struct StandColumns {
+    std::vector<int> stand;                    ///< 机位
+    std::vector<char> is_remote;               ///< 是否为远机位
+    std::vector<std::vector<int>> adjacent;    ///< 相邻机位（字符串池编号）
+
+    size_t size() const { return stand.size(); }
+};
+
+/**
+ * @brief 车辆列（vehicle.csv，可选输入）
+ */
+struct VehicleColumns {
+    std::vector<int> plate;                    ///< 车牌号
+    std::vector<int> vehicle_type;             ///< 车辆类型
+    std::vector<char> available;               ///< 车辆状态（Y=可用）
+    std::vector<int> bound_staff;              ///< 绑定人员编号（空表示未绑定）
+
+    size_t size() const { return plate.size(); }
+};
+
+/**
+ * @brief 休息列（break.csv，可选输入，每行一名员工的一次休息）
+ */
+struct BreakColumns {
+    std::vector<int> staff_id;                 ///< 员工编号
+    std::vector<int> name;                     ///< 任务名（如"吃饭"）
+    std::vector<long> start_time;              ///< 休息开始时间（秒）
+    std::vector<long> end_time;                ///< 休息结束时间（秒）
+    std::vector<char> locked;                  ///< 是否锁定（未锁定的休息可在浮动窗口内移动）
+
+    size_t size() const { return staff_id.size(); }
+};
+
+/**
+ * @brief 熟练度列（qualLevel.csv，可选输入，每行一名员工的一项资质）
+ */
+struct ProficiencyColumns {
+    std::vector<int> qualification;            ///< 资质名称
+    std::vector<int> staff;                    ///< 人员行号
+    std::vector<int> level;                    ///< 熟练度
+
+    size_t size() const { return qualification.size(); }
+};
+
+/**
+ * @brief 资质双机优先级列（skill.csv，可选输入）
+ */
+struct SkillColumns {
+    std::vector<int> qualification;            ///< 资质名称
+    std::vector<int> double_priority;          ///< 双机优先级
+    std::vector<int> continuous_double_priority;  ///< 连续双机优先级
+
+    size_t size() const { return qualification.size(); }
+};
+
+/**
+ * @brief 航班衔接规则（connectRule.csv的一行）
+ */
+struct ConnectRule {
+    int prev_direction;                        ///< 前一个航班进/出港
+    int prev_body_type;                        ///< 前一个航班机型
+    int next_direction;                        ///< 后一个航班进/出港
+    long min_interval;                         ///< 最小时间间隔（秒，可为负）
+};
+
+/**
+ * @brief 规则表（parameter.csv + connectRule.csv）
+ */
+struct RuleTable {
+    std::map<std::string, std::string> parameters;  ///< 参数名 -> 参数值（parameter.csv第一行）
+    std::vector<ConnectRule> connect_rules;         ///< 航班衔接规则
+
+    /**
+     * @brief 读取整数参数（分钟等），缺失或无法解析时返回默认值
+     */
+    long getLong(const std::string& name, long default_value) const {
+        auto it = parameters.find(name);
+        if (it == parameters.end() || it->second.empty()) {
+            return default_value;
+        }
+        try {
+            return std::stol(it->second);
+        } catch (...) {
+            return default_value;
+        }
+    }
+};
+
+/**
+ * @brief 单日问题模型
+ */
+class DayModel {
+public:
+    StringPool strings;                        ///< 字符串池
+    TaskColumns tasks;                         ///< 任务
+    StaffColumns staff;                        ///< 人员
+    GroupColumns groups;                       ///< 班组
+    StandColumns stands;                       ///< 机位
+    VehicleColumns vehicles;                   ///< 车辆
+    BreakColumns breaks;                       ///< 休息
+    ProficiencyColumns proficiency;            ///< 人员资质熟练度
+    SkillColumns skills;                       ///< 资质双机优先级
+    RuleTable rules;                           ///< 规则
+
+    /**
+     * @brief 重建ID到行号的索引（加载完成后调用一次）
+     */
+    void buildIndexes() {
+        task_index_.clear();
+        staff_index_.clear();
+        stand_index_.clear();
+        for (size_t i = 0; i < tasks.size(); ++i) {
+            task_index_[tasks.task_id[i]] = static_cast<int>(i);
+        }
+        for (size_t i = 0; i < staff.size(); ++i) {
+            staff_index_[staff.staff_id[i]] = static_cast<int>(i);
+        }
+        for (size_t i = 0; i < stands.size(); ++i) {
+            stand_index_[stands.stand[i]] = static_cast<int>(i);
+        }
+    }
+
+    /**
+     * @brief 根据任务ID查找任务行号
+     * @return 行号，不存在返回-1
+     */
+    int findTaskRow(const std::string& task_id) const { return findRow(task_index_, task_id); }
+
+    /**
+     * @brief 根据员工编号查找人员行号
+     * @return 行号，不存在返回-1
+     */
+    int findStaffRow(const std::string& staff_id) const { return findRow(staff_index_, staff_id); }
+
+    /**
+     * @brief 根据机位查找机位行号
+     * @return 行号，不存在返回-1
+     */
+    int findStandRow(const std::string& stand) const { return findRow(stand_index_, stand); }
+
+    /**
+     * @brief 判断机位是否为远机位（未知机位按近机位处理）
+     */
+    bool isRemoteStand(int stand_id) const {
+        auto it = stand_index_.find(stand_id);
+        return it != stand_index_.end() && stands.is_remote[it->second] != 0;
+    }
+
+    /**
+     * @brief 清空所有分配结果
+     */
+    void clearAssignments() {
+        tasks.actual_start_time.assign(tasks.size(), 0);
+        tasks.assigned_staff.assign(tasks.size(), std::vector<int>());
+    }
+
+    /**
+     * @brief 清空模型
+     */
+    void clear() {
+        strings.clear();
+        tasks = TaskColumns();
+        staff = StaffColumns();
+        groups = GroupColumns();
+        stands = StandColumns();
+        vehicles = VehicleColumns();
+        breaks = BreakColumns();
+        proficiency = ProficiencyColumns();
+        skills = SkillColumns();
+        rules = RuleTable();
+        task_index_.clear();
+        staff_index_.clear();
+        stand_index_.clear();
+    }
+
+private:
+    int findRow(const std::unordered_map<int, int>& index, const std::string& key) const {
+        int id = strings.find(key);
+        if (id < 0) {
+            return -1;
+        }
+        auto it = index.find(id);
+        return it == index.end() ? -1 : it->second;
+    }
+
+    std::unordered_map<int, int> task_index_;   ///< 任务ID编号 -> 行号
+    std::unordered_map<int, int> staff_index_;  ///< 员工编号 -> 行号
+    std::unordered_map<int, int> stand_index_;  ///< 机位编号 -> 行号
+};
+
+/**
+ * @brief 任务行视图（只保存模型指针和行号）
+ */
+class TaskRow {
+public:
+    TaskRow(const DayModel& model, size_t row) : model_(&model), row_(row) {}
+
+    size_t getRow() const { return row_; }
+    const std::string& getTaskId() const { return str(model_->tasks.task_id[row_]); }
+    const std::string& getTaskName() const { return str(model_->tasks.task_name[row_]); }
+    const std::string& getTaskDate() const { return str(model_->tasks.task_date[row_]); }
+    long getStartTime() const { return model_->tasks.start_time[row_]; }
+    long getDuration() const { return model_->tasks.duration[row_]; }
+    long getEndTime() const { return getStartTime() + getDuration(); }
+    long getArrivalTime() const { return model_->tasks.arrival_time[row_]; }
+    long getDepartureTime() const { return model_->tasks.departure_time[row_]; }
+    const std::string& getInOut() const { return str(model_->tasks.in_out[row_]); }
+    const std::string& getFlightAttribute() const { return str(model_->tasks.flight_attribute[row_]); }
+    const std::string& getBodyType() const { return str(model_->tasks.body_type[row_]); }
+    const std::string& getStand() const { return str(model_->tasks.stand[row_]); }
+    bool isRemoteStand() const { return model_->isRemoteStand(model_->tasks.stand[row_]); }
+    int getRequiredCount() const { return model_->tasks.required_count[row_]; }
+    long getActualStartTime() const { return model_->tasks.actual_start_time[row_]; }
+    const std::vector<int>& getAssignedStaffRows() const { return model_->tasks.assigned_staff[row_]; }
+
+private:
+    const std::string& str(int id) const { return model_->strings.get(id); }
+
+    const DayModel* model_;                    ///< 所属模型
+    size_t row_;                               ///< 行号
+};
+
+/**
+ * @brief 人员行视图（只保存模型指针和行号）
+ */
+class StaffRow {
+public:
+    StaffRow(const DayModel& model, size_t row) : model_(&model), row_(row) {}
+
+    size_t getRow() const { return row_; }
+    const std::string& getStaffId() const { return str(model_->staff.staff_id[row_]); }
+    const std::string& getStaffName() const { return str(model_->staff.staff_name[row_]); }
+    int getGroup() const { return model_->staff.group[row_]; }
+    const std::string& getGroupName() const {
+        int group = getGroup();
+        return str(group < 0 ? 0 : model_->groups.group_name[group]);
+    }
+    long getShiftStart() const { return model_->staff.shift_start[row_]; }
+    long getShiftEnd() const { return model_->staff.shift_end[row_]; }
+    bool isAllowOvertime() const { return model_->staff.allow_overtime[row_] != 0; }
+    const std::string& getQualification() const { return str(model_->staff.qualification[row_]); }
+
+private:
+    const std::string& str(int id) const { return model_->strings.get(id); }
+
+    const DayModel* model_;                    ///< 所属模型
+    size_t row_;                               ///< 行号
+};
+
+/**
+ * @brief 模型输入文件名（相对于输入目录）
+ */
+struct DayModelFiles {
+    std::string task_file = "task.csv";
+    std::string shift_file = "shift.csv";
+    std::string staff_file = "staff.csv";
+    std::string stand_file = "stand_pos.csv";
+    std::string connect_rule_file = "connectRule.csv";
+    std::string parameter_file = "parameter.csv";
+    std::string vehicle_file = "vehicle.csv";
+    std::string break_file = "break.csv";
+    std::string qual_level_file = "qualLevel.csv";
+    std::string skill_file = "skill.csv";
+    std::string snapshot_file = "day_model.snapshot";   ///< 二进制快照（见DayModelSnapshot.h）
+};
+
+/**
+ * @brief 一次读入的CSV表（表头已去除BOM和引号）
+ */
+struct CSVTable {
+    std::vector<std::string> header;
+    std::vector<std::vector<std::string>> rows;
+
+    /**
+     * @brief 查找列下标（先精确匹配，再包含匹配）
+     * @return 列下标，找不到返回-1
+     */
+    int column(const std::string& name) const {
+        for (size_t i = 0; i < header.size(); ++i) {
+            if (header[i] == name) {
+                return static_cast<int>(i);
+            }
+        }
+        for (size_t i = 0; i < header.size(); ++i) {
+            if (header[i].find(name) != std::string::npos) {
+                return static_cast<int>(i);
+            }
+        }
+        return -1;
+    }
+
+    /**
+     * @brief 取某行某列的值（已去除引号），列不存在或越界返回空串
+     */
+    std::string value(size_t row, int col) const {
+        if (col < 0 || static_cast<size_t>(col) >= rows[row].size()) {
+            return "";
+        }
+        return CSVUtils::trimQuotes(rows[row][col]);
+    }
+};
+
+/**
+ * @brief 读取整个CSV文件（只打开一次，大文件按行边界并行解析）
+ * @param filename 文件路径
+ * @param table 输出参数
+ * @return 文件可读且包含表头返回true
+ */
+inline bool readCSVTable(const std::string& filename, CSVTable& table) {
+    PROFILE_SCOPE_DETAIL("csv.read", filename);
+    table.header.clear();
+    table.rows.clear();
+
+    std::string content;
+    if (!CSVUtils::readFileContent(filename, content) || content.empty()) {
+        return false;
+    }
+
+    std::string line;
+    size_t pos = CSVUtils::nextLine(content, CSVUtils::skipBOM(content), line);
+    for (const auto& h : CSVUtils::parseCSVLine(line)) {
+        table.header.push_back(CSVUtils::trimQuotes(h));
+    }
+    CSVUtils::parseCSVLinesParallel(content, pos, table.rows);
+    return !table.header.empty();
+}
+
+// 辅助函数：解析整数，失败返回默认值
+inline long parseLongOr(const std::string& str, long default_value) {
+    if (str.empty()) {
+        return default_value;
+    }
+    try {
+        return std::stol(str);
+    } catch (...) {
+        return default_value;
+    }
+}
+
+/**
+ * @brief 加载任务列
+ */
+inline bool loadTaskColumns(const CSVTable& table, DayModel& model) {
+    TaskColumns& t = model.tasks;
+    StringPool& pool = model.strings;
+
+    int c_id = table.column("任务ID");
+    int c_name = table.column("任务名称");
+    int c_date = table.column("任务日期");
+    int c_start = table.column("任务开始时间");
+    int c_duration = table.column("任务时长");
+    int c_arrival = table.column("到达航班预达时间");
+    int c_departure = table.column("出发航班预离时间");
+    int c_in_out = table.column("进/出港");
+    int c_attr = table.column("航班类型");
+    int c_body = table.column("机型类型");
+    int c_arr_id = table.column("到达航班ID");
+    int c_dep_id = table.column("出发航班ID");
+    int c_arr_no = table.column("到达航班号");
+    int c_dep_no = table.column("出发航班号");
+    int c_terminal = table.column("航站楼");
+    int c_stand = table.column("机位");
+    int c_qual = table.column("任务资质要求");
+    int c_count = table.column("任务对应的航班所需最少人数");
+    int c_cargo = table.column("任务装卸货量");
+    int c_service = table.column("服务项");
+    int c_vehicle = table.column("任务所需车辆类型");
+
+    for (size_t r = 0; r < table.rows.size(); ++r) {
+        std::string task_id = table.value(r, c_id);
+        std::string task_name = table.value(r, c_name);
+        if (task_id.empty() && task_name.empty()) {
+            continue;
+        }
+        if (task_id.empty()) {
+            task_id = "task_" + std::to_string(t.size() + 1);
+        }
+
+        long start_time = 0;
+        long arrival_time = 0;
+        long departure_time = 0;
+        try {
+            start_time = CSVUtils::parseDateTimeString(table.value(r, c_start));
+            arrival_time = CSVUtils::parseDateTimeString(table.value(r, c_arrival));
+            departure_time = CSVUtils::parseDateTimeString(table.value(r, c_departure));
+        } catch (...) {
+            std::cerr << "警告：任务时间无法解析，已跳过: " << task_id << std::endl;
+            continue;
+        }
+
+        double cargo_weight = -1.0;
+        std::string cargo_str = table.value(r, c_cargo);
+        if (!cargo_str.empty()) {
+            try {
+                cargo_weight = std::stod(cargo_str);
+            } catch (...) {
+                cargo_weight = -1.0;
+            }
+        }
+
+        t.task_id.push_back(pool.intern(task_id));
+        t.task_name.push_back(pool.intern(task_name));
+        t.task_date.push_back(pool.intern(table.value(r, c_date)));
+        t.start_time.push_back(start_time);
+        t.duration.push_back(parseLongOr(table.value(r, c_duration), 0) * 60);
+        t.arrival_time.push_back(arrival_time);
+        t.departure_time.push_back(departure_time);
+        t.in_out.push_back(pool.intern(table.value(r, c_in_out)));
+        t.flight_attribute.push_back(pool.intern(table.value(r, c_attr)));
+        t.body_type.push_back(pool.intern(table.value(r, c_body)));
+        t.arrival_flight_id.push_back(pool.intern(table.value(r, c_arr_id)));
+        t.departure_flight_id.push_back(pool.intern(table.value(r, c_dep_id)));
+        t.arrival_flight_number.push_back(pool.intern(table.value(r, c_arr_no)));
+        t.departure_flight_number.push_back(pool.intern(table.value(r, c_dep_no)));
+        t.terminal.push_back(pool.intern(table.value(r, c_terminal)));
+        t.stand.push_back(pool.intern(table.value(r, c_stand)));
+        t.required_qualification.push_back(pool.intern(table.value(r, c_qual)));
+        t.required_count.push_back(static_cast<int>(parseLongOr(table.value(r, c_count), 0)));
+        t.cargo_weight.push_back(cargo_weight);
+        t.service.push_back(pool.intern(table.value(r, c_service)));
+        t.vehicle_type.push_back(pool.intern(table.value(r, c_vehicle)));
+    }
+    return true;
+}
+
+/**
+ * @brief 加载人员列和班组列（shift.csv）
+ */
+inline bool loadShiftColumns(const CSVTable& table, DayModel& model) {
+    StaffColumns& s = model.staff;
+    GroupColumns& g = model.groups;
+    StringPool& pool = model.strings;
+
+    int c_id = table.column("员工编号");
+    int c_name = table.column("人员姓名");
+    int c_group = table.column("班组名");
+    int c_shift = table.column("班次名称");
+    int c_start = table.column("班期开始时间");
+    int c_end = table.column("班期结束时间");
+    int c_backup = table.column("是否备班");
+    int c_overtime = table.column("是否允许加班");
+    if (c_id < 0 || c_group < 0) {
+        std::cerr << "ERROR: shift.csv missing required columns" << std::endl;
+        return false;
+    }
+
+    std::map<int, int> group_row;                   // 班组名编号 -> 班组行号
+    std::vector<std::vector<int>> group_members;    // 班组行号 -> 成员人员行号
+    std::map<int, int> staff_row;                   // 员工编号 -> 人员行号
+
+    for (size_t r = 0; r < table.rows.size(); ++r) {
+        std::string staff_id = table.value(r, c_id);
+        std::string group_name = table.value(r, c_group);
+        if (staff_id.empty() || group_name.empty()) {
+            continue;
+        }
+        int id = pool.intern(staff_id);
+        if (staff_row.count(id)) {
+            continue;
+        }
+
+        int name_id = pool.intern(group_name);
+        auto git = group_row.find(name_id);
+        if (git == group_row.end()) {
+            std::string shift_name = table.value(r, c_shift);
+            int shift_type = 0;  // 0=休息, 1=主班, 2=副班
+            if (shift_name.find("主") != std::string::npos || shift_name.find("MAIN") != std::string::npos) {
+                shift_type = 1;
+            } else if (shift_name.find("副") != std::string::npos || shift_name.find("SUB") != std::string::npos) {
+                shift_type = 2;
+            }
+            git = group_row.insert(std::make_pair(name_id, static_cast<int>(g.group_name.size()))).first;
+            g.group_name.push_back(name_id);
+            g.shift_type.push_back(shift_type);
+            group_members.push_back(std::vector<int>());
+        }
+
+        int row = static_cast<int>(s.size());
+        staff_row[id] = row;
+        group_members[git->second].push_back(row);
+
+        std::string backup = table.value(r, c_backup);
+        std::string overtime = table.value(r, c_overtime);
+        s.staff_id.push_back(id);
+        s.staff_name.push_back(pool.intern(table.value(r, c_name)));
+        s.group.push_back(git->second);
+        s.shift_name.push_back(pool.intern(table.value(r, c_shift)));
+        s.shift_start.push_back(CSVUtils::parseDateTimeString(table.value(r, c_start)));
+        s.shift_end.push_back(CSVUtils::parseDateTimeString(table.value(r, c_end)));
+        s.allow_overtime.push_back(overtime == "Y" || overtime == "y");
+        s.is_backup.push_back(backup == "TRUE" || backup == "true" || backup == "Y");
+        s.qualification.push_back(0);
+        s.position.push_back(0);
+    }
+
+    g.member_begin.assign(1, 0);
+    g.members.clear();
+    for (const auto& members : group_members) {
+        g.members.insert(g.members.end(), members.begin(), members.end());
+        g.member_begin.push_back(static_cast<int>(g.members.size()));
+    }
+    return true;
+}
+
+/**
+ * @brief 补充人员资质和岗位（staff.csv，只更新shift.csv中出现的人员）
+ */
+inline void loadStaffColumns(const CSVTable& table, DayModel& model) {
+    int c_id = table.column("员工编号");
+    int c_qual = table.column("员工资质集合");
+    int c_position = table.column("岗位");
+    for (size_t r = 0; r < table.rows.size(); ++r) {
+        int row = model.findStaffRow(table.value(r, c_id));
+        if (row < 0) {
+            continue;
+        }
+        model.staff.qualification[row] = model.strings.intern(table.value(r, c_qual));
+        model.staff.position[row] = model.strings.intern(table.value(r, c_position));
+    }
+}
+
+/**
+ * @brief 加载机位列（stand_pos.csv）
+ */
+inline void loadStandColumns(const CSVTable& table, DayModel& model) {
+    int c_stand = table.column("机位");
+    int c_adjacent = table.column("相邻机位");
+    int c_remote = table.column("是否为远机位");
+    for (size_t r = 0; r < table.rows.size(); ++r) {
+        std::string stand = table.value(r, c_stand);
+        if (stand.empty()) {
+            continue;
+        }
+        std::string remote = table.value(r, c_remote);
+        std::vector<int> adjacent;
+        std::stringstream ss(table.value(r, c_adjacent));
+        std::string item;
+        while (std::getline(ss, item, ';')) {
+            if (!item.empty()) {
+                adjacent.push_back(model.strings.intern(item));
+            }
+        }
+        model.stands.stand.push_back(model.strings.intern(stand));
+        model.stands.is_remote.push_back(remote == "Y" || remote == "y");
+        model.stands.adjacent.push_back(adjacent);
+    }
+}
+
+/**
+ * @brief 加载车辆列（vehicle.csv，车牌号为空的行跳过）
+ */
+inline void loadVehicleColumns(const CSVTable& table, DayModel& model) {
+    int c_plate = table.column("车牌号");
+    int c_type = table.column("车辆类型");
+    int c_status = table.column("车辆状态");
+    int c_staff = table.column("绑定人员编号");
+    for (size_t r = 0; r < table.rows.size(); ++r) {
+        std::string plate = table.value(r, c_plate);
+        if (plate.empty()) {
+            continue;
+        }
+        std::string status = table.value(r, c_status);
+        model.vehicles.plate.push_back(model.strings.intern(plate));
+        model.vehicles.vehicle_type.push_back(model.strings.intern(table.value(r, c_type)));
+        model.vehicles.available.push_back(status.empty() || status == "Y" || status == "y");
+        model.vehicles.bound_staff.push_back(model.strings.intern(table.value(r, c_staff)));
+    }
+}
+
+/**
+ * @brief 加载休息列（break.csv，员工编号为空或时间无法解析的行跳过）
+ */
+inline void loadBreakColumns(const CSVTable& table, DayModel& model) {
+    int c_id = table.column("员工编号");
+    int c_name = table.column("任务名");
+    int c_start = table.column("休息开始时间");
+    int c_end = table.column("休息结束时间");
+    int c_locked = table.column("是否锁定");
+    for (size_t r = 0; r < table.rows.size(); ++r) {
+        std::string staff_id = table.value(r, c_id);
+        if (staff_id.empty()) {
+            continue;
+        }
+        long start_time = 0;
+        long end_time = 0;
+        try {
+            start_time = CSVUtils::parseDateTimeString(table.value(r, c_start));
+            end_time = CSVUtils::parseDateTimeString(table.value(r, c_end));
+        } catch (...) {
+            std::cerr << "警告：休息时间无法解析，已跳过: " << staff_id << std::endl;
+            continue;
+        }
+        if (end_time <= start_time) {
+            continue;
+        }
+        std::string locked = table.value(r, c_locked);
+        model.breaks.staff_id.push_back(model.strings.intern(staff_id));
+        model.breaks.name.push_back(model.strings.intern(table.value(r, c_name)));
+        model.breaks.start_time.push_back(start_time);
+        model.breaks.end_time.push_back(end_time);
+        model.breaks.locked.push_back(!(locked == "N" || locked == "n" || locked == "否"));
+    }
+}
+
+/**
+ * @brief 加载熟练度列（qualLevel.csv，只保留shift.csv中出现的人员，熟练度无法解析的行跳过）
+ */
+inline void loadProficiencyColumns(const CSVTable& table, DayModel& model) {
+    int c_qual = table.column("资质名称");
+    int c_id = table.column("人员ID");
+    int c_level = table.column("熟练度");
+    for (size_t r = 0; r < table.rows.size(); ++r) {
+        std::string qualification = table.value(r, c_qual);
+        int row = model.findStaffRow(table.value(r, c_id));
+        long level = parseLongOr(table.value(r, c_level), -1);
+        if (qualification.empty() || row < 0 || level < 0) {
+            continue;
+        }
+        model.proficiency.qualification.push_back(model.strings.intern(qualification));
+        model.proficiency.staff.push_back(row);
+        model.proficiency.level.push_back(static_cast<int>(level));
+    }
+}
+
+/**
+ * @brief 加载资质双机优先级列（skill.csv，资质名称为空的行跳过，优先级缺失按0）
+ */
+inline void loadSkillColumns(const CSVTable& table, DayModel& model) {
+    int c_qual = table.column("资质名称");
+    int c_double = table.column("双机优先级");
+    int c_continuous = table.column("连续双机优先级");
+    for (size_t r = 0; r < table.rows.size(); ++r) {
+        std::string qualification = table.value(r, c_qual);
+        if (qualification.empty()) {
+            continue;
+        }
+        model.skills.qualification.push_back(model.strings.intern(qualification));
+        model.skills.double_priority.push_back(static_cast<int>(parseLongOr(table.value(r, c_double), 0)));
+        model.skills.continuous_double_priority.push_back(
+            static_cast<int>(parseLongOr(table.value(r, c_continuous), 0)));
+    }
+}
+
+/**
+ * @brief 加载规则表（parameter.csv + connectRule.csv）
+ */
+inline void loadRuleTable(const CSVTable& parameter_table, const CSVTable& connect_table, DayModel& model) {
+    if (!parameter_table.rows.empty()) {
+        for (size_t i = 0; i < parameter_table.header.size(); ++i) {
+            model.rules.parameters[parameter_table.header[i]] = parameter_table.value(0, static_cast<int>(i));
+        }
+    }
+
+    int c_prev_dir = connect_table.column("前一个航班进/出港");
+    int c_prev_body = connect_table.column("前一个航班机型");
+    int c_next_dir = connect_table.column("后一个航班进/出港");
+    int c_interval = connect_table.column("最小时间间隔");
+    for (size_t r = 0; r < connect_table.rows.size(); ++r) {
+        ConnectRule rule;
+        rule.prev_direction = model.strings.intern(connect_table.value(r, c_prev_dir));
+        rule.prev_body_type = model.strings.intern(connect_table.value(r, c_prev_body));
+        rule.next_direction = model.strings.intern(connect_table.value(r, c_next_dir));
+        rule.min_interval = parseLongOr(connect_table.value(r, c_interval), 0) * 60;
+        model.rules.connect_rules.push_back(rule);
+    }
+}
+
+// 辅助函数：读取必需的输入文件，失败时输出警告
+inline bool readRequiredCSVTable(const std::string& filename, CSVTable& table) {
+    if (!readCSVTable(filename, table)) {
+        std::cerr << "警告：CSV文件为空或无法读取: " << filename << std::endl;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief 从输入目录加载单日模型，每个文件只读取一次
+ *
+ * 各文件的读取和解析互不依赖，在加载流水线上并发执行；建列阶段都要写字符串池，
+ * 按班次 → 任务 → 机位/索引 → 人员资质 → 规则 → 车辆 → 休息 → 熟练度 → 双机优先级的顺序串行执行
+ * （字符串编号与串行加载一致）。
+ * @param input_dir 输入目录（以/或\结尾）
+ * @param model 输出参数
+ * @param files 各输入文件名
+ * @param max_threads 最大线程数（0表示按硬件线程数，1表示串行加载）
+ * @return 任务和班次文件均加载成功返回true
+ */
+inline bool loadDayModel(const std::string& input_dir, DayModel& model,
+                         const DayModelFiles& files = DayModelFiles(), unsigned max_threads = 0) {
+    PROFILE_SCOPE("model.load_day");
+    model.clear();
+
+    CSVTable task_table, shift_table, staff_table, stand_table, parameter_table, connect_table, vehicle_table,
+        break_table, qual_level_table, skill_table;
+    Pipeline::LoadPipeline pipeline;
+    int read_shift = pipeline.addStage("model.read_shift", [&]() {
+        return readRequiredCSVTable(input_dir + files.shift_file, shift_table);
+    });
+    int read_task = pipeline.addStage("model.read_task", [&]() {
+        return readRequiredCSVTable(input_dir + files.task_file, task_table);
+    });
+    // 以下文件为可选输入
+    int read_staff = pipeline.addStage("model.read_staff", [&]() {
+        readCSVTable(input_dir + files.staff_file, staff_table);
+        return true;
+    });
+    int read_stand = pipeline.addStage("model.read_stand", [&]() {
+        readCSVTable(input_dir + files.stand_file, stand_table);
+        return true;
+    });
+    int read_parameter = pipeline.addStage("model.read_parameter", [&]() {
+        readCSVTable(input_dir + files.parameter_file, parameter_table);
+        return true;
+    });
+    int read_connect = pipeline.addStage("model.read_connect_rule", [&]() {
+        readCSVTable(input_dir + files.connect_rule_file, connect_table);
+        return true;
+    });
+    int read_vehicle = pipeline.addStage("model.read_vehicle", [&]() {
+        readCSVTable(input_dir + files.vehicle_file, vehicle_table);
+        return true;
+    });
+    int read_break = pipeline.addStage("model.read_break", [&]() {
+        readCSVTable(input_dir + files.break_file, break_table);
+        return true;
+    });
+    int read_qual_level = pipeline.addStage("model.read_qual_level", [&]() {
+        readCSVTable(input_dir + files.qual_level_file, qual_level_table);
+        return true;
+    });
+    int read_skill = pipeline.addStage("model.read_skill", [&]() {
+        readCSVTable(input_dir + files.skill_file, skill_table);
+        return true;
+    });
+
+    int build_shifts = pipeline.addStage("model.build_shifts", [&]() {
+        return loadShiftColumns(shift_table, model);
+    }, {read_shift});
+    int build_tasks = pipeline.addStage("model.build_tasks", [&]() {
+        return loadTaskColumns(task_table, model);
+    }, {build_shifts, read_task});
+    int build_stands = pipeline.addStage("model.build_stands", [&]() {
+        loadStandColumns(stand_table, model);
+        model.buildIndexes();
+        return true;
+    }, {build_tasks, read_stand});
+    int build_staff = pipeline.addStage("model.build_staff", [&]() {
+        loadStaffColumns(staff_table, model);
+        return true;
+    }, {build_stands, read_staff});
+    int build_rules = pipeline.addStage("model.build_rules", [&]() {
+        loadRuleTable(parameter_table, connect_table, model);
+        model.clearAssignments();
+        return true;
+    }, {build_staff, read_parameter, read_connect});
+    int build_vehicles = pipeline.addStage("model.build_vehicles", [&]() {
+        loadVehicleColumns(vehicle_table, model);
+        return true;
+    }, {build_rules, read_vehicle});
+    int build_breaks = pipeline.addStage("model.build_breaks", [&]() {
+        loadBreakColumns(break_table, model);
+        return true;
+    }, {build_vehicles, read_break});
+    int build_proficiency = pipeline.addStage("model.build_proficiency", [&]() {
+        loadProficiencyColumns(qual_level_table, model);
+        return true;
+    }, {build_breaks, read_qual_level});
+    pipeline.addStage("model.build_skills", [&]() {
+        loadSkillColumns(skill_table, model);
+        return true;
+    }, {build_proficiency, read_skill});
+
+    return pipeline.run(max_threads);
+}
+
+}  // namespace Model
+}  // namespace AirportStaffScheduler
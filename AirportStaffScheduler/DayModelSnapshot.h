@@ -0,0 +1,681 @@
+/**
+ * @file DayModelSnapshot.h
+ * @brief 单日模型的二进制列式快照（加速进程重启后的加载）
+ *
+ * loadDayModel每次都要解析全部CSV、清洗表头并按列名匹配字段。首次加载后把规范化的
+ * DayModel写成一个带版本号的二进制快照：字符串池（偏移表 + 字节区）、定宽时间列、
+ * 各编号列、班组CSR、机位相邻表、车辆列、休息列、熟练度列、双机优先级列和规则表。之后启动时直接映射（mmap/MapViewOfFile）
+ * 快照文件，各列整块拷贝进模型，不再做任何文本解析。
+ *
+ * 快照头部记录了每个源CSV的路径、大小和修改时间，任一文件变化（包括可选文件的新增或删除）
+ * 时快照自动失效并重新从CSV加载。快照按本机字节序写入，只用于同一台机器上的重启缓存。
+ */
+
+#pragma once
+
+#include "DayModel.h"
+#include "Logger.h"
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace AirportStaffScheduler {
+namespace Model {
+
+/**
+ * @brief 源文件指纹（路径 + 大小 + 修改时间）
+ */
+struct SourceStamp {
+    std::string path;            ///< 文件名（相对于输入目录，同一目录用相对/绝对路径访问时快照仍有效）
+    int64_t size = -1;           ///< 文件大小（字节，-1表示文件不存在）
+    int64_t mtime = 0;           ///< 修改时间（秒）
+
+    bool operator==(const SourceStamp& other) const {
+        return path == other.path && size == other.size && mtime == other.mtime;
+    }
+    bool operator!=(const SourceStamp& other) const { return !(*this == other); }
+};
+
+/**
+ * @brief 读取输入目录下某文件的指纹（文件不存在时size为-1）
+ */
+inline SourceStamp stampFile(const std::string& input_dir, const std::string& name) {
+    SourceStamp stamp;
+    stamp.path = name;
+    struct stat info;
+    if (stat((input_dir + name).c_str(), &info) == 0) {
+        stamp.size = static_cast<int64_t>(info.st_size);
+        stamp.mtime = static_cast<int64_t>(info.st_mtime);
+    }
+    return stamp;
+}
+
+/**
+ * @brief 模型各输入文件的指纹（顺序与loadDayModel读取的文件一致）
+ */
+inline std::vector<SourceStamp> stampDayModelFiles(const std::string& input_dir, const DayModelFiles& files) {
+    std::vector<SourceStamp> stamps;
+    stamps.push_back(stampFile(input_dir, files.shift_file));
+    stamps.push_back(stampFile(input_dir, files.task_file));
+    stamps.push_back(stampFile(input_dir, files.staff_file));
+    stamps.push_back(stampFile(input_dir, files.stand_file));
+    stamps.push_back(stampFile(input_dir, files.parameter_file));
+    stamps.push_back(stampFile(input_dir, files.connect_rule_file));
+    stamps.push_back(stampFile(input_dir, files.vehicle_file));
+    stamps.push_back(stampFile(input_dir, files.break_file));
+    stamps.push_back(stampFile(input_dir, files.qual_level_file));
+    stamps.push_back(stampFile(input_dir, files.skill_file));
+    return stamps;
+}
+
+/**
+ * @brief 只读内存映射文件
+ */
+class MappedFile {
+public:
+    MappedFile() : data_(nullptr), size_(0)
+#ifdef _WIN32
+        , file_(INVALID_HANDLE_VALUE), mapping_(nullptr)
+#endif
+    {
+    }
+
+    ~MappedFile() { close(); }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * @brief 映射整个文件（空文件视为失败）
+     */
+    bool open(const std::string& path) {
+        close();
+#ifdef _WIN32
+        file_ = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                            FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file_ == INVALID_HANDLE_VALUE) {
+            return false;
+        }
+        LARGE_INTEGER file_size;
+        if (!GetFileSizeEx(file_, &file_size) || file_size.QuadPart <= 0) {
+            close();
+            return false;
+        }
+        mapping_ = CreateFileMappingA(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mapping_) {
+            close();
+            return false;
+        }
+        data_ = static_cast<const char*>(MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0));
+        if (!data_) {
+            close();
+            return false;
+        }
+        size_ = static_cast<size_t>(file_size.QuadPart);
+#else
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return false;
+        }
+        struct stat info;
+        if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+            ::close(fd);
+            return false;
+        }
+        void* address = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (address == MAP_FAILED) {
+            return false;
+        }
+        data_ = static_cast<const char*>(address);
+        size_ = static_cast<size_t>(info.st_size);
+#endif
+        return true;
+    }
+
+    void close() {
+#ifdef _WIN32
+        if (data_) {
+            UnmapViewOfFile(data_);
+        }
+        if (mapping_) {
+            CloseHandle(mapping_);
+            mapping_ = nullptr;
+        }
+        if (file_ != INVALID_HANDLE_VALUE) {
+            CloseHandle(file_);
+            file_ = INVALID_HANDLE_VALUE;
+        }
+#else
+        if (data_) {
+            munmap(const_cast<char*>(data_), size_);
+        }
+#endif
+        data_ = nullptr;
+        size_ = 0;
+    }
+
+    const char* data() const { return data_; }
+    size_t size() const { return size_; }
+
+private:
+    const char* data_;           ///< 映射地址
+    size_t size_;                ///< 文件大小
+#ifdef _WIN32
+    HANDLE file_;                ///< 文件句柄
+    HANDLE mapping_;             ///< 映射句柄
+#endif
+};
+
+namespace Snapshot {
+
+const char MAGIC[4] = {'D', 'M', 'S', 'N'};
+const uint32_t VERSION = 4;      ///< 快照格式版本（DayModel列或写入顺序变化时递增）
+
+/**
+ * @brief 快照写入缓冲（整个快照先在内存中拼好，再一次写入文件）
+ */
+class Writer {
+public:
+    template <typename T>
+    void value(const T& v) {
+        bytes(&v, sizeof(T));
+    }
+
+    void bytes(const void* data, size_t length) {
+        const char* p = static_cast<const char*>(data);
+        buffer_.insert(buffer_.end(), p, p + length);
+    }
+
+    void string(const std::string& str) {
+        value(static_cast<uint32_t>(str.size()));
+        bytes(str.data(), str.size());
+    }
+
+    /**
+     * @brief 写入一列（元素数 + 按StoredT定宽存储的元素）
+     */
+    template <typename StoredT, typename T>
+    void column(const std::vector<T>& values) {
+        value(static_cast<uint32_t>(values.size()));
+        if (sizeof(StoredT) == sizeof(T)) {
+            if (!values.empty()) {
+                bytes(&values[0], values.size() * sizeof(T));
+            }
+            return;
+        }
+        for (const T& v : values) {
+            value(static_cast<StoredT>(v));
+        }
+    }
+
+    /**
+     * @brief 写入文件（先写临时文件再改名，避免并发启动读到半个快照）
+     */
+    bool save(const std::string& path) const {
+        std::string temp_path = path + ".tmp";
+        FILE* file = std::fopen(temp_path.c_str(), "wb");
+        if (!file) {
+            return false;
+        }
+        bool ok = buffer_.empty() || std::fwrite(&buffer_[0], 1, buffer_.size(), file) == buffer_.size();
+        ok = (std::fclose(file) == 0) && ok;
+        if (ok) {
+            std::remove(path.c_str());
+            ok = std::rename(temp_path.c_str(), path.c_str()) == 0;
+        }
+        if (!ok) {
+            std::remove(temp_path.c_str());
+        }
+        return ok;
+    }
+
+private:
+    std::vector<char> buffer_;
+};
+
+/**
+ * @brief 快照读取游标（越界时置失败标志，之后的读取全部返回默认值）
+ */
+class Reader {
+public:
+    Reader(const char* data, size_t size) : data_(data), size_(size), pos_(0), ok_(true) {}
+
+    bool ok() const { return ok_; }
+    bool atEnd() const { return pos_ == size_; }
+
+    template <typename T>
+    T value() {
+        T v = T();
+        bytes(&v, sizeof(T));
+        return v;
+    }
+
+    void bytes(void* out, size_t length) {
+        if (!ok_ || length > size_ - pos_) {
+            ok_ = false;
+            return;
+        }
+        std::memcpy(out, data_ + pos_, length);
+        pos_ += length;
+    }
+
+    std::string string() {
+        uint32_t length = value<uint32_t>();
+        if (!ok_ || length > size_ - pos_) {
+            ok_ = false;
+            return std::string();
+        }
+        std::string str(data_ + pos_, length);
+        pos_ += length;
+        return str;
+    }
+
+    /**
+     * @brief 读取Writer::column写入的一列
+     */
+    template <typename StoredT, typename T>
+    void column(std::vector<T>& values) {
+        uint32_t count = value<uint32_t>();
+        if (!ok_ || count > (size_ - pos_) / sizeof(StoredT)) {
+            ok_ = false;
+            values.clear();
+            return;
+        }
+        values.resize(count);
+        if (sizeof(StoredT) == sizeof(T)) {
+            if (count > 0) {
+                bytes(&values[0], count * sizeof(T));
+            }
+            return;
+        }
+        for (uint32_t i = 0; i < count; ++i) {
+            values[i] = static_cast<T>(value<StoredT>());
+        }
+    }
+
+private:
+    const char* data_;
+    size_t size_;
+    size_t pos_;
+    bool ok_;
+};
+
+// 辅助函数：写入/读取CSR形式的二维列（std::vector<std::vector<int>>）
+inline void writeNested(Writer& writer, const std::vector<std::vector<int>>& nested) {
+    std::vector<int32_t> begin(1, 0);
+    std::vector<int32_t> items;
+    for (const auto& row : nested) {
+        items.insert(items.end(), row.begin(), row.end());
+        begin.push_back(static_cast<int32_t>(items.size()));
+    }
+    writer.column<int32_t>(begin);
+    writer.column<int32_t>(items);
+}
+
+inline void readNested(Reader& reader, std::vector<std::vector<int>>& nested) {
+    std::vector<int32_t> begin;
+    std::vector<int32_t> items;
+    reader.column<int32_t>(begin);
+    reader.column<int32_t>(items);
+    nested.clear();
+    if (!reader.ok() || begin.empty()) {
+        return;
+    }
+    nested.resize(begin.size() - 1);
+    for (size_t i = 0; i + 1 < begin.size(); ++i) {
+        if (begin[i] < 0 || begin[i] > begin[i + 1] || static_cast<size_t>(begin[i + 1]) > items.size()) {
+            nested.clear();
+            return;
+        }
+        nested[i].assign(items.begin() + begin[i], items.begin() + begin[i + 1]);
+    }
+}
+
+}  // namespace Snapshot
+
+/**
+ * @brief 把已加载的模型写成快照（分配结果不写入）
+ * @param model 已加载的模型
+ * @param path 快照文件路径
+ * @param stamps 源文件指纹（stampDayModelFiles，应在读取CSV之前取得）
+ * @return 写入成功返回true
+ */
+inline bool saveDayModelSnapshot(const DayModel& model, const std::string& path,
+                                 const std::vector<SourceStamp>& stamps) {
+    PROFILE_SCOPE_DETAIL("model.save_snapshot", path);
+    Snapshot::Writer w;
+    w.bytes(Snapshot::MAGIC, sizeof(Snapshot::MAGIC));
+    w.value(Snapshot::VERSION);
+    w.value(static_cast<uint32_t>(stamps.size()));
+    for (const auto& stamp : stamps) {
+        w.string(stamp.path);
+        w.value(stamp.size);
+        w.value(stamp.mtime);
+    }
+
+    // 字符串池：偏移表 + 连续字节区（0号空字符串也写入，编号与模型一致）
+    std::vector<uint32_t> offsets(1, 0);
+    std::string blob;
+    for (size_t i = 0; i < model.strings.size(); ++i) {
+        blob += model.strings.get(static_cast<int>(i));
+        offsets.push_back(static_cast<uint32_t>(blob.size()));
+    }
+    w.column<uint32_t>(offsets);
+    w.string(blob);
+
+    const TaskColumns& t = model.tasks;
+    w.column<int32_t>(t.task_id);
+    w.column<int32_t>(t.task_name);
+    w.column<int32_t>(t.task_date);
+    w.column<int64_t>(t.start_time);
+    w.column<int64_t>(t.duration);
+    w.column<int64_t>(t.arrival_time);
+    w.column<int64_t>(t.departure_time);
+    w.column<int32_t>(t.in_out);
+    w.column<int32_t>(t.flight_attribute);
+    w.column<int32_t>(t.body_type);
+    w.column<int32_t>(t.arrival_flight_id);
+    w.column<int32_t>(t.departure_flight_id);
+    w.column<int32_t>(t.arrival_flight_number);
+    w.column<int32_t>(t.departure_flight_number);
+    w.column<int32_t>(t.terminal);
+    w.column<int32_t>(t.stand);
+    w.column<int32_t>(t.required_qualification);
+    w.column<int32_t>(t.required_count);
+    w.column<double>(t.cargo_weight);
+    w.column<int32_t>(t.service);
+    w.column<int32_t>(t.vehicle_type);
+
+    const StaffColumns& s = model.staff;
+    w.column<int32_t>(s.staff_id);
+    w.column<int32_t>(s.staff_name);
+    w.column<int32_t>(s.group);
+    w.column<int32_t>(s.shift_name);
+    w.column<int64_t>(s.shift_start);
+    w.column<int64_t>(s.shift_end);
+    w.column<char>(s.allow_overtime);
+    w.column<char>(s.is_backup);
+    w.column<int32_t>(s.qualification);
+    w.column<int32_t>(s.position);
+
+    const GroupColumns& g = model.groups;
+    w.column<int32_t>(g.group_name);
+    w.column<int32_t>(g.shift_type);
+    w.column<int32_t>(g.member_begin);
+    w.column<int32_t>(g.members);
+
+    w.column<int32_t>(model.stands.stand);
+    w.column<char>(model.stands.is_remote);
+    Snapshot::writeNested(w, model.stands.adjacent);
+
+    const VehicleColumns& v = model.vehicles;
+    w.column<int32_t>(v.plate);
+    w.column<int32_t>(v.vehicle_type);
+    w.column<char>(v.available);
+    w.column<int32_t>(v.bound_staff);
+
+    const BreakColumns& b = model.breaks;
+    w.column<int32_t>(b.staff_id);
+    w.column<int32_t>(b.name);
+    w.column<int64_t>(b.start_time);
+    w.column<int64_t>(b.end_time);
+    w.column<char>(b.locked);
+
+    const ProficiencyColumns& p = model.proficiency;
+    w.column<int32_t>(p.qualification);
+    w.column<int32_t>(p.staff);
+    w.column<int32_t>(p.level);
+
+    const SkillColumns& k = model.skills;
+    w.column<int32_t>(k.qualification);
+    w.column<int32_t>(k.double_priority);
+    w.column<int32_t>(k.continuous_double_priority);
+
+    w.value(static_cast<uint32_t>(model.rules.parameters.size()));
+    for (const auto& param : model.rules.parameters) {
+        w.string(param.first);
+        w.string(param.second);
+    }
+    w.value(static_cast<uint32_t>(model.rules.connect_rules.size()));
+    for (const auto& rule : model.rules.connect_rules) {
+        w.value(static_cast<int32_t>(rule.prev_direction));
+        w.value(static_cast<int32_t>(rule.prev_body_type));
+        w.value(static_cast<int32_t>(rule.next_direction));
+        w.value(static_cast<int64_t>(rule.min_interval));
+    }
+    return w.save(path);
+}
+
+// 辅助函数：检查编号列是否都指向字符串池内
+inline bool snapshotIdsValid(const std::vector<int>& ids, size_t limit) {
+    for (int id : ids) {
+        if (id < 0 || static_cast<size_t>(id) >= limit) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief 从快照加载模型
+ * @param path 快照文件路径
+ * @param stamps 当前源文件指纹，与快照记录的不一致时不加载
+ * @param model 输出参数（失败时内容不确定，调用方应重新从CSV加载）
+ * @return 快照有效且加载成功返回true
+ */
+inline bool loadDayModelSnapshot(const std::string& path, const std::vector<SourceStamp>& stamps,
+                                 DayModel& model) {
+    PROFILE_SCOPE_DETAIL("model.load_snapshot", path);
+    MappedFile file;
+    if (!file.open(path)) {
+        return false;
+    }
+    Snapshot::Reader r(file.data(), file.size());
+    char magic[sizeof(Snapshot::MAGIC)];
+    r.bytes(magic, sizeof(magic));
+    if (!r.ok() || std::memcmp(magic, Snapshot::MAGIC, sizeof(magic)) != 0 ||
+        r.value<uint32_t>() != Snapshot::VERSION) {
+        return false;
+    }
+    uint32_t stamp_count = r.value<uint32_t>();
+    if (!r.ok() || stamp_count != stamps.size()) {
+        return false;
+    }
+    for (uint32_t i = 0; i < stamp_count; ++i) {
+        SourceStamp stamp;
+        stamp.path = r.string();
+        stamp.size = r.value<int64_t>();
+        stamp.mtime = r.value<int64_t>();
+        if (!r.ok() || stamp != stamps[i]) {
+            LOG_DEBUG("快照已过期（" << stamps[i].path << " 已变化）: " << path);
+            return false;
+        }
+    }
+
+    model.clear();
+    std::vector<uint32_t> offsets;
+    r.column<uint32_t>(offsets);
+    std::string blob = r.string();
+    if (!r.ok() || offsets.size() < 2 || offsets.back() != blob.size()) {
+        return false;
+    }
+    for (size_t i = 1; i + 1 < offsets.size(); ++i) {
+        if (offsets[i] < offsets[i - 1] || offsets[i + 1] < offsets[i]) {
+            return false;
+        }
+        model.strings.intern(blob.substr(offsets[i], offsets[i + 1] - offsets[i]));
+    }
+    if (model.strings.size() != offsets.size() - 1) {
+        return false;  // 字符串重复，编号无法对应
+    }
+
+    TaskColumns& t = model.tasks;
+    r.column<int32_t>(t.task_id);
+    r.column<int32_t>(t.task_name);
+    r.column<int32_t>(t.task_date);
+    r.column<int64_t>(t.start_time);
+    r.column<int64_t>(t.duration);
+    r.column<int64_t>(t.arrival_time);
+    r.column<int64_t>(t.departure_time);
+    r.column<int32_t>(t.in_out);
+    r.column<int32_t>(t.flight_attribute);
+    r.column<int32_t>(t.body_type);
+    r.column<int32_t>(t.arrival_flight_id);
+    r.column<int32_t>(t.departure_flight_id);
+    r.column<int32_t>(t.arrival_flight_number);
+    r.column<int32_t>(t.departure_flight_number);
+    r.column<int32_t>(t.terminal);
+    r.column<int32_t>(t.stand);
+    r.column<int32_t>(t.required_qualification);
+    r.column<int32_t>(t.required_count);
+    r.column<double>(t.cargo_weight);
+    r.column<int32_t>(t.service);
+    r.column<int32_t>(t.vehicle_type);
+
+    StaffColumns& s = model.staff;
+    r.column<int32_t>(s.staff_id);
+    r.column<int32_t>(s.staff_name);
+    r.column<int32_t>(s.group);
+    r.column<int32_t>(s.shift_name);
+    r.column<int64_t>(s.shift_start);
+    r.column<int64_t>(s.shift_end);
+    r.column<char>(s.allow_overtime);
+    r.column<char>(s.is_backup);
+    r.column<int32_t>(s.qualification);
+    r.column<int32_t>(s.position);
+
+    GroupColumns& g = model.groups;
+    r.column<int32_t>(g.group_name);
+    r.column<int32_t>(g.shift_type);
+    r.column<int32_t>(g.member_begin);
+    r.column<int32_t>(g.members);
+
+    r.column<int32_t>(model.stands.stand);
+    r.column<char>(model.stands.is_remote);
+    Snapshot::readNested(r, model.stands.adjacent);
+
+    VehicleColumns& v = model.vehicles;
+    r.column<int32_t>(v.plate);
+    r.column<int32_t>(v.vehicle_type);
+    r.column<char>(v.available);
+    r.column<int32_t>(v.bound_staff);
+
+    BreakColumns& b = model.breaks;
+    r.column<int32_t>(b.staff_id);
+    r.column<int32_t>(b.name);
+    r.column<int64_t>(b.start_time);
+    r.column<int64_t>(b.end_time);
+    r.column<char>(b.locked);
+
+    ProficiencyColumns& p = model.proficiency;
+    r.column<int32_t>(p.qualification);
+    r.column<int32_t>(p.staff);
+    r.column<int32_t>(p.level);
+
+    SkillColumns& k = model.skills;
+    r.column<int32_t>(k.qualification);
+    r.column<int32_t>(k.double_priority);
+    r.column<int32_t>(k.continuous_double_priority);
+
+    uint32_t param_count = r.value<uint32_t>();
+    for (uint32_t i = 0; r.ok() && i < param_count; ++i) {
+        std::string name = r.string();
+        model.rules.parameters[name] = r.string();
+    }
+    uint32_t rule_count = r.value<uint32_t>();
+    for (uint32_t i = 0; r.ok() && i < rule_count; ++i) {
+        ConnectRule rule;
+        rule.prev_direction = r.value<int32_t>();
+        rule.prev_body_type = r.value<int32_t>();
+        rule.next_direction = r.value<int32_t>();
+        rule.min_interval = static_cast<long>(r.value<int64_t>());
+        model.rules.connect_rules.push_back(rule);
+    }
+    if (!r.ok() || !r.atEnd()) {
+        return false;
+    }
+
+    // 列长度一致性检查（快照损坏时宁可回退到CSV）
+    size_t task_count = t.size();
+    size_t staff_count = s.size();
+    if (t.start_time.size() != task_count || t.service.size() != task_count ||
+        t.cargo_weight.size() != task_count || t.required_count.size() != task_count ||
+        t.vehicle_type.size() != task_count ||
+        s.position.size() != staff_count || s.group.size() != staff_count ||
+        g.member_begin.size() != g.size() + 1 ||
+        model.stands.is_remote.size() != model.stands.size() ||
+        model.stands.adjacent.size() != model.stands.size() ||
+        v.vehicle_type.size() != v.size() || v.available.size() != v.size() ||
+        v.bound_staff.size() != v.size() ||
+        b.name.size() != b.size() || b.start_time.size() != b.size() ||
+        b.end_time.size() != b.size() || b.locked.size() != b.size() ||
+        p.staff.size() != p.size() || p.level.size() != p.size() ||
+        k.double_priority.size() != k.size() || k.continuous_double_priority.size() != k.size() ||
+        !snapshotIdsValid(t.task_id, model.strings.size()) ||
+        !snapshotIdsValid(s.staff_id, model.strings.size()) ||
+        !snapshotIdsValid(t.vehicle_type, model.strings.size()) ||
+        !snapshotIdsValid(v.plate, model.strings.size()) ||
+        !snapshotIdsValid(v.vehicle_type, model.strings.size()) ||
+        !snapshotIdsValid(v.bound_staff, model.strings.size()) ||
+        !snapshotIdsValid(b.staff_id, model.strings.size()) ||
+        !snapshotIdsValid(b.name, model.strings.size()) ||
+        !snapshotIdsValid(p.qualification, model.strings.size()) ||
+        !snapshotIdsValid(p.staff, staff_count) ||
+        !snapshotIdsValid(k.qualification, model.strings.size())) {
+        return false;
+    }
+
+    model.buildIndexes();
+    model.clearAssignments();
+    return true;
+}
+
+/**
+ * @brief 优先从快照加载单日模型，快照不存在或源CSV变化时从CSV加载并重写快照
+ * @param input_dir 输入目录（以/或\结尾）
+ * @param model 输出参数
+ * @param files 各输入文件名（快照路径为input_dir + files.snapshot_file）
+ * @return 加载成功返回true
+ */
+inline bool loadDayModelCached(const std::string& input_dir, DayModel& model,
+                               const DayModelFiles& files = DayModelFiles()) {
+    std::string snapshot_path = input_dir + files.snapshot_file;
+    std::vector<SourceStamp> stamps = stampDayModelFiles(input_dir, files);
+    if (loadDayModelSnapshot(snapshot_path, stamps, model)) {
+        LOG_DEBUG("从快照加载单日模型: " << snapshot_path);
+        return true;
+    }
+    if (!loadDayModel(input_dir, model, files)) {
+        return false;
+    }
+    // 加载期间源文件被修改时不写快照，下次启动重新解析
+    if (stampDayModelFiles(input_dir, files) != stamps) {
+        return true;
+    }
+    if (!saveDayModelSnapshot(model, snapshot_path, stamps)) {
+        LOG_WARN("警告：无法写入单日模型快照: " << snapshot_path);
+    }
+    return true;
+}
+
+}  // namespace Model
+}  // namespace AirportStaffScheduler
@@ -0,0 +1,299 @@
+/**
+ * @file InternedIds.h
+ * @brief 编号化的员工/任务ID列表（全局ID注册表 + 带内联存储的小列表）
+ *
+ * 任务的已分配员工通常只有3或6人，员工的已分配任务也只有十几个，用vector<string>保存时
+ * 每个ID都要单独分配一次堆内存，检查"是否已分配"也是逐个比较字符串。这里把ID字符串
+ * 注册成进程内唯一的整数编号：
+ * - IdRegistry：字符串 → 编号的注册表，编号对应的字符串按固定大小的块保存，块只追加不移动，
+ *   按编号取字符串不加锁；注册新ID时加锁（只在分配时发生）。编号在进程内一直有效，不回收；
+ * - SmallIdList：前N个编号存放在对象内部，超出时才分配堆内存；同时维护一个64位掩码
+ *   （编号低6位对应的位），判断是否包含某编号时先查掩码，掩码命中再扫描少数几个整数；
+ * - IdNames：按顺序把列表中的编号还原成ID字符串的只读视图，可以像vector<string>一样遍历、
+ *   下标访问，也可以转换成vector<string>。
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace AirportStaffScheduler {
+namespace Ids {
+
+/**
+ * @brief 全局ID注册表（ID字符串 ↔ 整数编号）
+ */
+class IdRegistry {
+public:
+    /**
+     * @brief 获取ID的编号，不存在时注册
+     */
+    static int intern(const std::string& id) {
+        IdRegistry& registry = instance();
+        std::lock_guard<std::mutex> lock(registry.mutex_);
+        auto it = registry.index_.find(id);
+        if (it != registry.index_.end()) {
+            return it->second;
+        }
+        int key = registry.size_;
+        int block = key >> BLOCK_BITS;
+        std::string* storage = registry.blocks_[block].load(std::memory_order_relaxed);
+        if (storage == nullptr) {
+            storage = new std::string[BLOCK_SIZE];
+            registry.blocks_[block].store(storage, std::memory_order_release);
+        }
+        storage[key & (BLOCK_SIZE - 1)] = id;
+        registry.index_[id] = key;
+        registry.size_++;
+        return key;
+    }
+
+    /**
+     * @brief 查找ID的编号（不注册）
+     * @return 编号，未注册返回-1
+     */
+    static int find(const std::string& id) {
+        IdRegistry& registry = instance();
+        std::lock_guard<std::mutex> lock(registry.mutex_);
+        auto it = registry.index_.find(id);
+        return it == registry.index_.end() ? -1 : it->second;
+    }
+
+    /**
+     * @brief 根据编号获取ID字符串（不加锁，编号必须由intern返回）
+     */
+    static const std::string& name(int key) {
+        return instance().blocks_[key >> BLOCK_BITS].load(std::memory_order_acquire)[key & (BLOCK_SIZE - 1)];
+    }
+
+private:
+    static const int BLOCK_BITS = 10;                  ///< 每块1024个ID
+    static const int BLOCK_SIZE = 1 << BLOCK_BITS;
+    static const int MAX_BLOCKS = 4096;                ///< 最多约400万个ID
+
+    IdRegistry() : size_(0) {
+        for (int i = 0; i < MAX_BLOCKS; ++i) {
+            blocks_[i].store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    ~IdRegistry() {
+        for (int i = 0; i < MAX_BLOCKS; ++i) {
+            delete[] blocks_[i].load(std::memory_order_relaxed);
+        }
+    }
+
+    static IdRegistry& instance() {
+        static IdRegistry registry;
+        return registry;
+    }
+
+    std::mutex mutex_;                                 ///< 保护注册
+    std::unordered_map<std::string, int> index_;       ///< ID → 编号
+    std::atomic<std::string*> blocks_[MAX_BLOCKS];     ///< 编号 → ID（按块保存，块地址不变）
+    int size_;                                         ///< 已注册的ID个数
+};
+
+/**
+ * @brief 编号列表的ID字符串视图（不持有数据，列表修改后失效）
+ */
+class IdNames {
+public:
+    /**
+     * @brief 只读迭代器（解引用得到ID字符串）
+     */
+    class const_iterator {
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef std::string value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const std::string* pointer;
+        typedef const std::string& reference;
+
+        explicit const_iterator(const int* key = nullptr) : key_(key) {}
+        reference operator*() const { return IdRegistry::name(*key_); }
+        pointer operator->() const { return &IdRegistry::name(*key_); }
+        const_iterator& operator++() { ++key_; return *this; }
+        const_iterator operator++(int) { const_iterator old = *this; ++key_; return old; }
+        bool operator==(const const_iterator& other) const { return key_ == other.key_; }
+        bool operator!=(const const_iterator& other) const { return key_ != other.key_; }
+
+    private:
+        const int* key_;
+    };
+    typedef const_iterator iterator;
+
+    IdNames(const int* begin, const int* end) : begin_(begin), end_(end) {}
+
+    const_iterator begin() const { return const_iterator(begin_); }
+    const_iterator end() const { return const_iterator(end_); }
+    size_t size() const { return static_cast<size_t>(end_ - begin_); }
+    bool empty() const { return begin_ == end_; }
+    const std::string& operator[](size_t i) const { return IdRegistry::name(begin_[i]); }
+
+    /**
+     * @brief 复制成ID字符串列表
+     */
+    operator std::vector<std::string>() const {
+        std::vector<std::string> names;
+        names.reserve(size());
+        for (const int* key = begin_; key != end_; ++key) {
+            names.push_back(IdRegistry::name(*key));
+        }
+        return names;
+    }
+
+private:
+    const int* begin_;
+    const int* end_;
+};
+
+/**
+ * @brief 带内联存储的编号列表（保持插入顺序，前N个编号不分配堆内存）
+ */
+template <size_t N>
+class SmallIdList {
+public:
+    SmallIdList() : data_(inline_), size_(0), capacity_(N), mask_(0) {}
+
+    SmallIdList(const SmallIdList& other) : data_(inline_), size_(0), capacity_(N), mask_(0) {
+        assign(other);
+    }
+
+    SmallIdList& operator=(const SmallIdList& other) {
+        if (this != &other) {
+            size_ = 0;
+            assign(other);
+        }
+        return *this;
+    }
+
+    ~SmallIdList() {
+        if (data_ != inline_) {
+            delete[] data_;
+        }
+    }
+
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    int operator[](size_t i) const { return data_[i]; }
+    const int* begin() const { return data_; }
+    const int* end() const { return data_ + size_; }
+
+    /**
+     * @brief ID字符串视图
+     */
+    IdNames names() const { return IdNames(data_, data_ + size_); }
+
+    /**
+     * @brief 是否包含编号（掩码未命中时直接返回false）
+     */
+    bool contains(int key) const {
+        if ((mask_ & bit(key)) == 0) {
+            return false;
+        }
+        for (size_t i = 0; i < size_; ++i) {
+            if (data_[i] == key) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief 是否包含ID字符串（逐个比较字符串，不查注册表）
+     */
+    bool containsName(const std::string& id) const {
+        for (size_t i = 0; i < size_; ++i) {
+            if (IdRegistry::name(data_[i]) == id) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief 追加编号（不检查重复）
+     */
+    void push_back(int key) {
+        if (size_ == capacity_) {
+            reserve(capacity_ * 2);
+        }
+        data_[size_++] = key;
+        mask_ |= bit(key);
+    }
+
+    /**
+     * @brief 移除第一个等于key的编号（保持其余顺序）
+     * @return 找到并移除返回true
+     */
+    bool remove(int key) {
+        size_t i = 0;
+        while (i < size_ && data_[i] != key) {
+            ++i;
+        }
+        if (i == size_) {
+            return false;
+        }
+        for (; i + 1 < size_; ++i) {
+            data_[i] = data_[i + 1];
+        }
+        size_--;
+        mask_ = 0;
+        for (size_t j = 0; j < size_; ++j) {
+            mask_ |= bit(data_[j]);
+        }
+        return true;
+    }
+
+    /**
+     * @brief 清空（保留已分配的容量）
+     */
+    void clear() {
+        size_ = 0;
+        mask_ = 0;
+    }
+
+private:
+    static uint64_t bit(int key) { return uint64_t(1) << (static_cast<unsigned>(key) & 63u); }
+
+    void reserve(size_t capacity) {
+        if (capacity <= capacity_) {
+            return;
+        }
+        int* data = new int[capacity];
+        for (size_t i = 0; i < size_; ++i) {
+            data[i] = data_[i];
+        }
+        if (data_ != inline_) {
+            delete[] data_;
+        }
+        data_ = data;
+        capacity_ = capacity;
+    }
+
+    void assign(const SmallIdList& other) {
+        reserve(other.size_);
+        for (size_t i = 0; i < other.size_; ++i) {
+            data_[i] = other.data_[i];
+        }
+        size_ = other.size_;
+        mask_ = other.mask_;
+    }
+
+    int* data_;                  ///< 当前存储（内联数组或堆数组）
+    size_t size_;                ///< 编号个数
+    size_t capacity_;            ///< 当前存储容量
+    uint64_t mask_;              ///< 已包含编号的低6位掩码
+    int inline_[N];              ///< 内联存储
+};
+
+}  // namespace Ids
+}  // namespace AirportStaffScheduler
@@ -0,0 +1,183 @@
+/**
+ * @file LoadPipeline.h
+ * @brief 带依赖关系的加载流水线（在线程池上并发执行相互独立的阶段）
+ *
+ * 每个阶段声明它依赖的前序阶段，所有依赖成功完成后才会被执行；没有依赖关系的阶段
+ * （例如各个CSV文件的读取和解析）由工作线程并发执行。某个阶段失败（返回false）时，
+ * 依赖它的阶段不再执行，整个流水线返回false。
+ *
+ * 用法：
+ *   LoadPipeline pipeline;
+ *   int read_a = pipeline.addStage("read a", [&]() { return readA(); });
+ *   int read_b = pipeline.addStage("read b", [&]() { return readB(); });
+ *   pipeline.addStage("join", [&]() { return join(); }, {read_a, read_b});
+ *   bool ok = pipeline.run();
+ */
+
+#pragma once
+
+#include "Profiler.h"
+#include <functional>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <deque>
+#include <vector>
+#include <string>
+
+namespace AirportStaffScheduler {
+namespace Pipeline {
+
+/**
+ * @brief 加载流水线
+ */
+class LoadPipeline {
+public:
+    LoadPipeline() : finished_count_(0), failed_(false) {}
+
+    /**
+     * @brief 添加一个阶段
+     * @param name 阶段名（字符串字面量，用于性能剖析）
+     * @param work 阶段函数，返回false表示失败
+     * @param dependencies 依赖的阶段编号（必须是之前添加的阶段）
+     * @return 阶段编号
+     */
+    int addStage(const char* name, std::function<bool()> work, const std::vector<int>& dependencies = {}) {
+        int id = static_cast<int>(stages_.size());
+        Stage stage;
+        stage.name = name;
+        stage.work = std::move(work);
+        stage.remaining = static_cast<int>(dependencies.size());
+        stages_.push_back(std::move(stage));
+        for (int dependency : dependencies) {
+            stages_[dependency].dependents.push_back(id);
+        }
+        return id;
+    }
+
+    /**
+     * @brief 执行所有阶段（调用线程也参与执行），全部完成后返回；每个流水线只能运行一次
+     * @param max_threads 最大线程数（0表示按硬件线程数）
+     * @return 所有阶段都成功返回true
+     */
+    bool run(unsigned max_threads = 0) {
+        finished_count_ = 0;
+        failed_ = false;
+        ready_.clear();
+        for (size_t i = 0; i < stages_.size(); ++i) {
+            stages_[i].state = stages_[i].remaining == 0 ? STATE_READY : STATE_WAITING;
+            if (stages_[i].state == STATE_READY) {
+                ready_.push_back(static_cast<int>(i));
+            }
+        }
+
+        unsigned thread_count = max_threads > 0 ? max_threads : std::thread::hardware_concurrency();
+        if (thread_count == 0) {
+            thread_count = 1;
+        }
+        if (thread_count > stages_.size()) {
+            thread_count = static_cast<unsigned>(stages_.size());
+        }
+
+        std::vector<std::thread> workers;
+        for (unsigned i = 1; i < thread_count; ++i) {
+            workers.emplace_back(&LoadPipeline::workerLoop, this);
+        }
+        workerLoop();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        return !failed_;
+    }
+
+    /**
+     * @brief 阶段是否成功完成（run之后调用）
+     */
+    bool succeeded(int stage) const { return stages_[stage].state == STATE_DONE; }
+
+private:
+    enum StageState {
+        STATE_WAITING,     ///< 等待依赖
+        STATE_READY,       ///< 可执行
+        STATE_RUNNING,     ///< 执行中
+        STATE_DONE,        ///< 成功完成
+        STATE_FAILED,      ///< 失败
+        STATE_SKIPPED      ///< 依赖失败，未执行
+    };
+
+    struct Stage {
+        const char* name = "";
+        std::function<bool()> work;
+        std::vector<int> dependents;     ///< 依赖本阶段的阶段
+        int remaining = 0;               ///< 尚未完成的依赖数
+        bool blocked = false;            ///< 是否有依赖失败
+        StageState state = STATE_WAITING;
+    };
+
+    void workerLoop() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (finished_count_ < stages_.size()) {
+            if (ready_.empty()) {
+                cv_.wait(lock);
+                continue;
+            }
+            int id = ready_.front();
+            ready_.pop_front();
+            stages_[id].state = STATE_RUNNING;
+            lock.unlock();
+
+            bool ok = false;
+            {
+                PROFILE_SCOPE(stages_[id].name);
+                try {
+                    ok = stages_[id].work();
+                } catch (...) {
+                    ok = false;
+                }
+            }
+
+            lock.lock();
+            finish(id, ok);
+            cv_.notify_all();
+        }
+    }
+
+    // 辅助函数：记录阶段结束并释放后续阶段（调用时已持有锁）
+    void finish(int id, bool ok) {
+        std::vector<int> pending(1, id);
+        stages_[id].state = ok ? STATE_DONE : STATE_FAILED;
+        while (!pending.empty()) {
+            int current = pending.back();
+            pending.pop_back();
+            finished_count_++;
+            bool current_ok = stages_[current].state == STATE_DONE;
+            if (!current_ok) {
+                failed_ = true;
+            }
+            for (int dependent : stages_[current].dependents) {
+                Stage& next = stages_[dependent];
+                next.blocked = next.blocked || !current_ok;
+                if (--next.remaining > 0) {
+                    continue;
+                }
+                if (next.blocked) {
+                    next.state = STATE_SKIPPED;
+                    pending.push_back(dependent);
+                } else {
+                    next.state = STATE_READY;
+                    ready_.push_back(dependent);
+                }
+            }
+        }
+    }
+
+    std::vector<Stage> stages_;        ///< 所有阶段
+    std::deque<int> ready_;            ///< 可执行的阶段
+    size_t finished_count_;            ///< 已结束（成功、失败或跳过）的阶段数
+    bool failed_;                      ///< 是否有阶段失败
+    std::mutex mutex_;
+    std::condition_variable cv_;
+};
+
+}  // namespace Pipeline
+}  // namespace AirportStaffScheduler
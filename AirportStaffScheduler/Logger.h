@@ -0,0 +1,275 @@
+/**
+ * @file Logger.h
+ * @brief 分级日志（编译期级别过滤 + 后台异步输出）
+ *
+ * 用法：LOG_DEBUG("Task " << task_id << " assigned " << count);
+ *
+ * - 编译期最低级别由AIRPORT_SCHEDULER_LOG_LEVEL宏决定（默认INFO），低于该级别的
+ *   日志宏展开为空语句，参数表达式不会生成任何代码；
+ * - 运行期还可以通过setMinLevel()进一步提高级别，未启用的级别不会格式化消息；
+ * - 格式化后的消息放入无锁环形缓冲区，由后台线程统一写到stdout（INFO）或stderr（其他级别），
+ *   调度循环中不再直接调用cerr/cout。缓冲区满时生产者让出CPU等待，不丢消息。
+ *
+ * 需要与cout/cerr的输出保持先后顺序时（例如测试程序打印统计信息前），先调用flush()。
+ */
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <sstream>
+#include <thread>
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+
+#define AIRPORT_LOG_LEVEL_TRACE 0
+#define AIRPORT_LOG_LEVEL_DEBUG 1
+#define AIRPORT_LOG_LEVEL_INFO  2
+#define AIRPORT_LOG_LEVEL_WARN  3
+#define AIRPORT_LOG_LEVEL_ERROR 4
+#define AIRPORT_LOG_LEVEL_OFF   5
+
+#ifndef AIRPORT_SCHEDULER_LOG_LEVEL
+#define AIRPORT_SCHEDULER_LOG_LEVEL AIRPORT_LOG_LEVEL_INFO
+#endif
+
+namespace AirportStaffScheduler {
+namespace Logging {
+
+/**
+ * @brief 日志级别
+ */
+enum LogLevel {
+    LEVEL_TRACE = AIRPORT_LOG_LEVEL_TRACE,
+    LEVEL_DEBUG = AIRPORT_LOG_LEVEL_DEBUG,
+    LEVEL_INFO = AIRPORT_LOG_LEVEL_INFO,
+    LEVEL_WARN = AIRPORT_LOG_LEVEL_WARN,
+    LEVEL_ERROR = AIRPORT_LOG_LEVEL_ERROR,
+    LEVEL_OFF = AIRPORT_LOG_LEVEL_OFF
+};
+
+// 辅助函数：运行期最低级别（初始为编译期级别）
+inline std::atomic<int>& runtimeMinLevel() {
+    static std::atomic<int> level(AIRPORT_SCHEDULER_LOG_LEVEL);
+    return level;
+}
+
+// 辅助函数：后台输出线程是否已启动
+inline std::atomic<bool>& loggerStarted() {
+    static std::atomic<bool> started(false);
+    return started;
+}
+
+/**
+ * @brief 设置运行期最低级别（不能低于编译期级别，低于编译期级别的日志已被编译掉）
+ */
+inline void setMinLevel(LogLevel level) {
+    runtimeMinLevel().store(static_cast<int>(level), std::memory_order_relaxed);
+}
+
+/**
+ * @brief 获取运行期最低级别
+ */
+inline LogLevel getMinLevel() {
+    return static_cast<LogLevel>(runtimeMinLevel().load(std::memory_order_relaxed));
+}
+
+/**
+ * @brief 该级别是否需要输出（在格式化消息之前判断）
+ */
+inline bool isEnabled(LogLevel level) {
+    return static_cast<int>(level) >= AIRPORT_SCHEDULER_LOG_LEVEL &&
+           static_cast<int>(level) >= runtimeMinLevel().load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief 日志输出器（单例）
+ *
+ * 多生产者单消费者的有界环形缓冲区（每个槽位带序号，生产者通过CAS领取位置），
+ * 消费者为首次写日志时启动的后台线程，程序退出时析构函数输出剩余消息。
+ */
+class Logger {
+public:
+    static const size_t CAPACITY = 4096;  ///< 环形缓冲区槽位数（2的幂）
+
+    static Logger& getInstance() {
+        static Logger instance;
+        return instance;
+    }
+
+    /**
+     * @brief 写入一条已格式化的消息（缓冲区满时等待后台线程腾出位置）
+     */
+    void write(LogLevel level, std::string message) {
+        while (!tryPush(level, message)) {
+            std::this_thread::yield();
+        }
+    }
+
+    /**
+     * @brief 等待调用前写入的消息全部输出
+     */
+    void flush() {
+        size_t target = enqueue_pos_.load(std::memory_order_acquire);
+        while (dequeue_pos_.load(std::memory_order_acquire) < target) {
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+        }
+        std::fflush(stdout);
+        std::fflush(stderr);
+    }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        LogLevel level;
+        std::string message;
+    };
+
+    Logger()
+        : cells_(new Cell[CAPACITY])
+        , enqueue_pos_(0)
+        , dequeue_pos_(0)
+        , stop_(false)
+    {
+        for (size_t i = 0; i < CAPACITY; ++i) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        writer_ = std::thread(&Logger::run, this);
+        loggerStarted().store(true, std::memory_order_release);
+    }
+
+    ~Logger() {
+        stop_.store(true, std::memory_order_release);
+        if (writer_.joinable()) {
+            writer_.join();
+        }
+        drain();
+        std::fflush(stdout);
+        std::fflush(stderr);
+    }
+
+    Logger(const Logger&) = delete;
+    Logger& operator=(const Logger&) = delete;
+
+    bool tryPush(LogLevel level, std::string& message) {
+        Cell* cell = nullptr;
+        size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &cells_[pos & (CAPACITY - 1)];
+            size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;  // 缓冲区已满
+            } else {
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+        cell->level = level;
+        cell->message.swap(message);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool tryPop(LogLevel& level, std::string& message) {
+        size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+        Cell& cell = cells_[pos & (CAPACITY - 1)];
+        if (cell.sequence.load(std::memory_order_acquire) != pos + 1) {
+            return false;
+        }
+        level = cell.level;
+        message.swap(cell.message);
+        cell.message.clear();
+        cell.sequence.store(pos + CAPACITY, std::memory_order_release);
+        dequeue_pos_.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // 辅助函数：输出当前缓冲区中的所有消息，返回输出条数
+    size_t drain() {
+        size_t count = 0;
+        LogLevel level = LEVEL_INFO;
+        std::string message;
+        while (tryPop(level, message)) {
+            FILE* stream = (level == LEVEL_INFO) ? stdout : stderr;
+            std::fwrite(message.data(), 1, message.size(), stream);
+            std::fputc('\n', stream);
+            count++;
+        }
+        return count;
+    }
+
+    void run() {
+        while (!stop_.load(std::memory_order_acquire)) {
+            if (drain() > 0) {
+                std::fflush(stdout);
+                std::fflush(stderr);
+            } else {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+    }
+
+    std::unique_ptr<Cell[]> cells_;         ///< 环形缓冲区
+    std::atomic<size_t> enqueue_pos_;       ///< 下一个写入位置
+    std::atomic<size_t> dequeue_pos_;       ///< 下一个读取位置（只由后台线程推进）
+    std::atomic<bool> stop_;                ///< 停止后台线程
+    std::thread writer_;                    ///< 后台输出线程
+};
+
+/**
+ * @brief 等待已写入的日志全部输出（未写过日志时不会启动后台线程）
+ */
+inline void flush() {
+    if (loggerStarted().load(std::memory_order_acquire)) {
+        Logger::getInstance().flush();
+    }
+}
+
+}  // namespace Logging
+}  // namespace AirportStaffScheduler
+
+// 辅助宏：级别启用时才格式化消息
+#define AIRPORT_LOG_WRITE(level, expr)                                                        \
+    do {                                                                                      \
+        if (::AirportStaffScheduler::Logging::isEnabled(level)) {                             \
+            std::ostringstream airport_log_stream_;                                           \
+            airport_log_stream_ << expr;                                                      \
+            ::AirportStaffScheduler::Logging::Logger::getInstance().write(level, airport_log_stream_.str()); \
+        }                                                                                     \
+    } while (0)
+
+#if AIRPORT_SCHEDULER_LOG_LEVEL <= AIRPORT_LOG_LEVEL_TRACE
+#define LOG_TRACE(expr) AIRPORT_LOG_WRITE(::AirportStaffScheduler::Logging::LEVEL_TRACE, expr)
+#else
+#define LOG_TRACE(expr) do {} while (0)
+#endif
+
+#if AIRPORT_SCHEDULER_LOG_LEVEL <= AIRPORT_LOG_LEVEL_DEBUG
+#define LOG_DEBUG(expr) AIRPORT_LOG_WRITE(::AirportStaffScheduler::Logging::LEVEL_DEBUG, expr)
+#else
+#define LOG_DEBUG(expr) do {} while (0)
+#endif
+
+#if AIRPORT_SCHEDULER_LOG_LEVEL <= AIRPORT_LOG_LEVEL_INFO
+#define LOG_INFO(expr) AIRPORT_LOG_WRITE(::AirportStaffScheduler::Logging::LEVEL_INFO, expr)
+#else
+#define LOG_INFO(expr) do {} while (0)
+#endif
+
+#if AIRPORT_SCHEDULER_LOG_LEVEL <= AIRPORT_LOG_LEVEL_WARN
+#define LOG_WARN(expr) AIRPORT_LOG_WRITE(::AirportStaffScheduler::Logging::LEVEL_WARN, expr)
+#else
+#define LOG_WARN(expr) do {} while (0)
+#endif
+
+#if AIRPORT_SCHEDULER_LOG_LEVEL <= AIRPORT_LOG_LEVEL_ERROR
+#define LOG_ERROR(expr) AIRPORT_LOG_WRITE(::AirportStaffScheduler::Logging::LEVEL_ERROR, expr)
+#else
+#define LOG_ERROR(expr) do {} while (0)
+#endif
@@ -0,0 +1,459 @@
+/**
+ * @file PlanDiff.h
+ * @brief 两版排班方案的差异计算（只输出变化的任务，供手持终端增量下发）
+ *
+ * 每版方案是一组（任务, 员工, 开始, 结束）行，任务ID和员工ID在同一个字符串池中编号，
+ * 对比时只比较整数：
+ * - 每版方案按任务编号计数排序（编号范围即字符串池大小），同一任务的员工按编号插入排序
+ *   （每个任务只有一两个小组），排序和归并都是线性时间；
+ * - 两版方案按任务归并：只在新方案中 → 新增；只在旧方案中 → 删除；员工相同而时间不同 → 改时；
+ *   员工不同 → 换人（可能同时改时）；
+ * - 受影响员工（其任务时间线发生变化的员工）用位图标记，同样是线性时间。
+ *
+ * 输出格式（compact）：每个变化一行
+ *   op,任务ID,开始,结束,员工,原开始,原结束,原员工
+ * op为 + 新增、- 删除、~ 改时、> 换人；时间为当天秒数（跨天时大于86400），多个员工以;分隔，
+ * 不适用的字段留空。
+ */
+
+#pragma once
+
+#include "DayModel.h"
+#include "PlanWriter.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace AirportStaffScheduler {
+namespace Output {
+
+/**
+ * @brief 变化类型
+ */
+enum class PlanChangeKind : uint8_t {
+    ADDED = 0,       ///< 新方案中新增的任务分配
+    REMOVED = 1,     ///< 新方案中不再分配的任务
+    RETIMED = 2,     ///< 员工不变，时间变化
+    REASSIGNED = 3,  ///< 员工变化（时间可能同时变化）
+    COUNT = 4
+};
+
+/**
+ * @brief 方案中的一行（一个员工执行一个任务）
+ */
+struct PlanRow {
+    int task;        ///< 任务ID编号
+    int staff;       ///< 员工ID编号
+    int64_t start;   ///< 开始时间（当天秒数）
+    int64_t end;     ///< 结束时间（当天秒数）
+};
+
+/**
+ * @brief 一版方案
+ */
+class PlanTable {
+public:
+    PlanTable() : sorted_(true) {}
+
+    void add(int task, int staff, int64_t start, int64_t end) {
+        PlanRow row;
+        row.task = task;
+        row.staff = staff;
+        row.start = start;
+        row.end = end;
+        rows_.push_back(row);
+        sorted_ = false;
+    }
+
+    void clear() {
+        rows_.clear();
+        sorted_ = true;
+    }
+
+    void swap(PlanTable& other) {
+        rows_.swap(other.rows_);
+        std::swap(sorted_, other.sorted_);
+    }
+
+    size_t size() const { return rows_.size(); }
+    const std::vector<PlanRow>& getRows() const { return rows_; }
+
+    /**
+     * @brief 按（任务, 员工）排序（计数排序，线性时间）
+     * @param id_count 编号范围（字符串池大小）
+     */
+    void sort(size_t id_count) {
+        if (sorted_) {
+            return;
+        }
+        std::vector<uint32_t> offsets(id_count + 1, 0);
+        for (const auto& row : rows_) {
+            offsets[row.task + 1]++;
+        }
+        for (size_t i = 1; i <= id_count; ++i) {
+            offsets[i] += offsets[i - 1];
+        }
+        std::vector<PlanRow> sorted(rows_.size());
+        for (const auto& row : rows_) {
+            sorted[offsets[row.task]++] = row;
+        }
+        // 同一任务的行数很少，插入排序即可
+        for (size_t i = 1; i < sorted.size(); ++i) {
+            PlanRow row = sorted[i];
+            size_t j = i;
+            while (j > 0 && sorted[j - 1].task == row.task && sorted[j - 1].staff > row.staff) {
+                sorted[j] = sorted[j - 1];
+                --j;
+            }
+            sorted[j] = row;
+        }
+        rows_.swap(sorted);
+        sorted_ = true;
+    }
+
+private:
+    std::vector<PlanRow> rows_;
+    bool sorted_;
+};
+
+/**
+ * @brief 单个任务的变化
+ *
+ * 员工列表保存在PlanDiff的员工数组中，用[begin, begin+count)表示
+ */
+struct PlanDiffRecord {
+    PlanChangeKind kind;
+    int task;
+    int64_t old_start;
+    int64_t old_end;
+    int64_t new_start;
+    int64_t new_end;
+    uint32_t old_staff_begin;
+    uint32_t old_staff_count;
+    uint32_t new_staff_begin;
+    uint32_t new_staff_count;
+};
+
+/**
+ * @brief 方案差异计算器（持有两版方案共用的ID字符串池）
+ */
+class PlanDiff {
+public:
+    /**
+     * @brief ID字符串池
+     */
+    Model::StringPool& getIds() { return ids_; }
+    const Model::StringPool& getIds() const { return ids_; }
+
+    /**
+     * @brief 向方案加入一行
+     */
+    void addRow(PlanTable& plan, const std::string& task_id, const std::string& staff_id,
+                int64_t start, int64_t end) {
+        plan.add(ids_.intern(task_id), ids_.intern(staff_id), start, end);
+    }
+
+    /**
+     * @brief 把调度后的任务列表加入方案（只加入已分配且有员工的任务）
+     *
+     * TaskT需要提供getTaskId、isAssigned、getActualStartTime、getDuration、getAssignedEmployeeIds
+     */
+    template <typename TaskT>
+    void addTasks(PlanTable& plan, const std::vector<TaskT>& tasks) {
+        for (const auto& task : tasks) {
+            if (!task.isAssigned() || task.getAssignedEmployeeIds().empty()) {
+                continue;
+            }
+            int task_id = ids_.intern(task.getTaskId());
+            int64_t start = task.getActualStartTime();
+            int64_t end = start + task.getDuration();
+            for (const auto& staff_id : task.getAssignedEmployeeIds()) {
+                plan.add(task_id, ids_.intern(staff_id), start, end);
+            }
+        }
+    }
+
+    /**
+     * @brief 从soln_shift.csv格式的文件（如上次的result.csv）加载方案
+     * @return 文件可读且包含人员编号、任务ID列返回true
+     */
+    bool addSolnShiftCSV(PlanTable& plan, const std::string& filename) {
+        Model::CSVTable table;
+        if (!Model::readCSVTable(filename, table)) {
+            return false;
+        }
+        int c_staff = table.column("人员编号");
+        int c_task = table.column("任务ID");
+        int c_date = table.column("任务日期");
+        int c_start = table.column("任务开始时间");
+        int c_end = table.column("任务结束时间");
+        if (c_staff < 0 || c_task < 0) {
+            return false;
+        }
+        for (size_t r = 0; r < table.rows.size(); ++r) {
+            std::string task_id = table.value(r, c_task);
+            std::string staff_id = table.value(r, c_staff);
+            if (task_id.empty() || staff_id.empty()) {
+                continue;
+            }
+            std::string date = table.value(r, c_date);
+            addRow(plan, task_id, staff_id, parseTime(table.value(r, c_start), date),
+                   parseTime(table.value(r, c_end), date));
+        }
+        return true;
+    }
+
+    /**
+     * @brief 从referschedule.csv加载预排方案（员工编号为空的任务视为未分配，多个员工以,;|分隔）
+     * @return 文件可读且包含任务ID、员工编号列返回true
+     */
+    bool addReferscheduleCSV(PlanTable& plan, const std::string& filename) {
+        Model::CSVTable table;
+        if (!Model::readCSVTable(filename, table)) {
+            return false;
+        }
+        int c_task = table.column("任务ID");
+        int c_staff = table.column("员工编号");
+        int c_date = table.column("任务日期");
+        int c_start = table.column("任务开始时间");
+        int c_duration = table.column("任务时长");
+        if (c_task < 0 || c_staff < 0) {
+            return false;
+        }
+        for (size_t r = 0; r < table.rows.size(); ++r) {
+            std::string task_id = table.value(r, c_task);
+            std::string staff_list = table.value(r, c_staff);
+            if (task_id.empty() || staff_list.empty()) {
+                continue;
+            }
+            int64_t start = parseTime(table.value(r, c_start), table.value(r, c_date));
+            int64_t end = start + Model::parseLongOr(table.value(r, c_duration), 0) * 60;
+            size_t begin = 0;
+            while (begin <= staff_list.size()) {
+                size_t next = staff_list.find_first_of(",;|", begin);
+                if (next == std::string::npos) {
+                    next = staff_list.size();
+                }
+                std::string staff_id = CSVUtils::trimQuotes(staff_list.substr(begin, next - begin));
+                if (!staff_id.empty()) {
+                    addRow(plan, task_id, staff_id, start, end);
+                }
+                begin = next + 1;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief 对比两版方案（两版都会被排序）
+     * @param before 旧方案
+     * @param after 新方案
+     * @return 变化列表（按任务编号排序），下次compare前有效
+     */
+    const std::vector<PlanDiffRecord>& compare(PlanTable& before, PlanTable& after) {
+        records_.clear();
+        staff_.clear();
+        before.sort(ids_.size());
+        after.sort(ids_.size());
+
+        const std::vector<PlanRow>& a = before.getRows();
+        const std::vector<PlanRow>& b = after.getRows();
+        size_t i = 0;
+        size_t j = 0;
+        while (i < a.size() || j < b.size()) {
+            int task;
+            if (j >= b.size() || (i < a.size() && a[i].task < b[j].task)) {
+                task = a[i].task;
+            } else {
+                task = b[j].task;
+            }
+            size_t a_end = i;
+            while (a_end < a.size() && a[a_end].task == task) {
+                ++a_end;
+            }
+            size_t b_end = j;
+            while (b_end < b.size() && b[b_end].task == task) {
+                ++b_end;
+            }
+            compareTask(task, a, i, a_end, b, j, b_end);
+            i = a_end;
+            j = b_end;
+        }
+        return records_;
+    }
+
+    /**
+     * @brief 最近一次对比的变化列表
+     */
+    const std::vector<PlanDiffRecord>& getRecords() const { return records_; }
+
+    /**
+     * @brief 某类变化的数量
+     */
+    size_t count(PlanChangeKind kind) const {
+        size_t total = 0;
+        for (const auto& record : records_) {
+            total += record.kind == kind ? 1 : 0;
+        }
+        return total;
+    }
+
+    /**
+     * @brief 变化前/后的员工编号
+     */
+    std::vector<int> getOldStaff(const PlanDiffRecord& record) const {
+        return std::vector<int>(staff_.begin() + record.old_staff_begin,
+                                staff_.begin() + record.old_staff_begin + record.old_staff_count);
+    }
+    std::vector<int> getNewStaff(const PlanDiffRecord& record) const {
+        return std::vector<int>(staff_.begin() + record.new_staff_begin,
+                                staff_.begin() + record.new_staff_begin + record.new_staff_count);
+    }
+
+    /**
+     * @brief 任务时间线发生变化的员工（按编号排序）
+     */
+    std::vector<int> getAffectedStaff() const {
+        std::vector<char> marked(ids_.size(), 0);
+        for (int staff : staff_) {
+            marked[staff] = 1;
+        }
+        std::vector<int> affected;
+        for (size_t id = 0; id < marked.size(); ++id) {
+            if (marked[id]) {
+                affected.push_back(static_cast<int>(id));
+            }
+        }
+        return affected;
+    }
+
+    /**
+     * @brief 以compact格式写出最近一次对比的变化
+     * @return 文件写入成功返回true
+     */
+    bool writeCompact(const std::string& filename) const {
+        BufferedFileWriter writer(64 * 1024);
+        if (!writer.open(filename)) {
+            return false;
+        }
+        writer.append("op,task,start,end,staff,old_start,old_end,old_staff\n");
+        static const char OPS[] = {'+', '-', '~', '>'};
+        for (const auto& record : records_) {
+            bool has_new = record.kind != PlanChangeKind::REMOVED;
+            bool has_old = record.kind != PlanChangeKind::ADDED;
+            writer.appendChar(OPS[static_cast<int>(record.kind)]);
+            writer.appendChar(',');
+            writer.append(ids_.get(record.task));
+            writer.appendChar(',');
+            writeSide(writer, has_new, record.new_start, record.new_end, record.new_staff_begin,
+                      record.new_staff_count);
+            writer.appendChar(',');
+            writeSide(writer, has_old, record.old_start, record.old_end, record.old_staff_begin,
+                      record.old_staff_count);
+            writer.appendChar('\n');
+        }
+        return writer.close();
+    }
+
+private:
+    // 辅助函数：对比同一任务在两版方案中的行（两边都已按员工编号排序）
+    void compareTask(int task, const std::vector<PlanRow>& a, size_t a_begin, size_t a_end,
+                     const std::vector<PlanRow>& b, size_t b_begin, size_t b_end) {
+        size_t a_count = a_end - a_begin;
+        size_t b_count = b_end - b_begin;
+        bool same_staff = a_count == b_count;
+        bool same_time = true;
+        for (size_t k = 0; same_staff && k < a_count; ++k) {
+            const PlanRow& old_row = a[a_begin + k];
+            const PlanRow& new_row = b[b_begin + k];
+            same_staff = old_row.staff == new_row.staff;
+            same_time = same_time && old_row.start == new_row.start && old_row.end == new_row.end;
+        }
+        if (same_staff && same_time) {
+            return;
+        }
+
+        PlanDiffRecord record = PlanDiffRecord();
+        record.task = task;
+        if (a_count == 0) {
+            record.kind = PlanChangeKind::ADDED;
+        } else if (b_count == 0) {
+            record.kind = PlanChangeKind::REMOVED;
+        } else {
+            record.kind = same_staff ? PlanChangeKind::RETIMED : PlanChangeKind::REASSIGNED;
+        }
+        if (a_count > 0) {
+            record.old_start = a[a_begin].start;
+            record.old_end = a[a_begin].end;
+        }
+        if (b_count > 0) {
+            record.new_start = b[b_begin].start;
+            record.new_end = b[b_begin].end;
+        }
+        record.old_staff_begin = static_cast<uint32_t>(staff_.size());
+        record.old_staff_count = static_cast<uint32_t>(a_count);
+        for (size_t k = a_begin; k < a_end; ++k) {
+            staff_.push_back(a[k].staff);
+        }
+        record.new_staff_begin = static_cast<uint32_t>(staff_.size());
+        record.new_staff_count = static_cast<uint32_t>(b_count);
+        for (size_t k = b_begin; k < b_end; ++k) {
+            staff_.push_back(b[k].staff);
+        }
+        records_.push_back(record);
+    }
+
+    // 辅助函数：写出一侧（新/旧）的开始、结束和员工列
+    void writeSide(BufferedFileWriter& writer, bool present, int64_t start, int64_t end,
+                   uint32_t staff_begin, uint32_t staff_count) const {
+        if (present) {
+            writer.appendInt(start);
+        }
+        writer.appendChar(',');
+        if (present) {
+            writer.appendInt(end);
+        }
+        writer.appendChar(',');
+        for (uint32_t k = 0; k < staff_count; ++k) {
+            if (k > 0) {
+                writer.appendChar(';');
+            }
+            writer.append(ids_.get(staff_[staff_begin + k]));
+        }
+    }
+
+    // 辅助函数：解析"YYYY-MM-DD HH:MM:SS"为当天秒数，日期晚于基准日期时按天推进
+    static int64_t parseTime(const std::string& text, const std::string& base_date) {
+        int64_t seconds = CSVUtils::parseDateTimeString(text);
+        if (seconds <= 0 || base_date.size() < 10 || text.size() < 10) {
+            return seconds;
+        }
+        return seconds + 24 * 3600 * (civilDay(text) - civilDay(base_date));
+    }
+
+    // 辅助函数：YYYY-MM-DD转为连续的天数（格式不符返回0）
+    static int64_t civilDay(const std::string& date) {
+        if (date.size() < 10 || date[4] != '-' || date[7] != '-') {
+            return 0;
+        }
+        int year = std::atoi(date.substr(0, 4).c_str());
+        int month = std::atoi(date.substr(5, 2).c_str());
+        int day = std::atoi(date.substr(8, 2).c_str());
+        // 把3月作为一年的第一个月，闰日落在年末
+        year -= month <= 2 ? 1 : 0;
+        int64_t era = (year >= 0 ? year : year - 399) / 400;
+        int64_t year_of_era = year - era * 400;
+        int64_t day_of_year = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+        int64_t day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+        return era * 146097 + day_of_era;
+    }
+
+    Model::StringPool ids_;                  ///< 任务ID和员工ID的字符串池（两版方案共用）
+    std::vector<PlanDiffRecord> records_;    ///< 最近一次对比的变化
+    std::vector<int> staff_;                 ///< 变化记录引用的员工编号
+};
+
+}  // namespace Output
+}  // namespace AirportStaffScheduler
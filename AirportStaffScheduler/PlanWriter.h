@@ -0,0 +1,478 @@
+/**
+ * @file PlanWriter.h
+ * @brief 排班结果输出（大块缓冲写文件 + soln_shift.csv行格式化）
+ *
+ * 测试程序原先用ofstream逐字段<<输出排班结果，日期时间经ostringstream/setw格式化，
+ * 每行都要分配若干临时字符串，多天输出时占了可观的时间。这里改为：
+ * - BufferedFileWriter：行内容直接追加到一块可复用的大缓冲区（默认1MB），整数和时间手工格式化，
+ *   缓冲区写满时整块fwrite，关闭stdio自身的缓冲，避免二次拷贝；
+ * - SolnShiftWriter：按soln_shift.csv的列顺序输出，每个人员的班期列（班期日期、开始、结束、
+ *   人员编号、姓名）只格式化一次，该人员的任务行（车辆随任务而定）逐行写出，不需要先收集整个文件。
+ *
+ * 输出与原测试程序逐字节一致（表头、全部字段加引号、日期时间格式、空字段规则）。
+ */
+
+#pragma once
+
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace AirportStaffScheduler {
+namespace Output {
+
+/**
+ * @brief 大块缓冲的文件写入器
+ *
+ * 文件以文本模式打开（与原ofstream输出的换行方式一致），缓冲区写满或关闭时整块写出。
+ */
+class BufferedFileWriter {
+public:
+    static const size_t DEFAULT_BUFFER_SIZE = 1 << 20;  ///< 默认缓冲区大小（字节）
+
+    explicit BufferedFileWriter(size_t buffer_size = DEFAULT_BUFFER_SIZE)
+        : buffer_(buffer_size > 64 ? buffer_size : 64)
+        , size_(0)
+        , file_(nullptr)
+        , failed_(false)
+    {
+    }
+
+    ~BufferedFileWriter() {
+        close();
+    }
+
+    BufferedFileWriter(const BufferedFileWriter&) = delete;
+    BufferedFileWriter& operator=(const BufferedFileWriter&) = delete;
+
+    /**
+     * @brief 打开（截断）输出文件
+     * @return 打开成功返回true
+     */
+    bool open(const std::string& filename) {
+        close();
+        file_ = std::fopen(filename.c_str(), "w");
+        if (!file_) {
+            return false;
+        }
+        // 数据已在本对象中成块缓冲，关闭stdio缓冲以免再拷贝一次
+        std::setvbuf(file_, nullptr, _IONBF, 0);
+        failed_ = false;
+        return true;
+    }
+
+    bool isOpen() const { return file_ != nullptr; }
+
+    /**
+     * @brief 是否发生过写入错误
+     */
+    bool failed() const { return failed_; }
+
+    void append(const char* data, size_t length) {
+        if (length > buffer_.size() - size_) {
+            flush();
+            if (length > buffer_.size()) {
+                writeChunk(data, length);
+                return;
+            }
+        }
+        std::memcpy(&buffer_[size_], data, length);
+        size_ += length;
+    }
+
+    void append(const std::string& text) {
+        append(text.data(), text.size());
+    }
+
+    void append(const char* text) {
+        append(text, std::strlen(text));
+    }
+
+    void appendChar(char c) {
+        if (size_ == buffer_.size()) {
+            flush();
+        }
+        buffer_[size_++] = c;
+    }
+
+    /**
+     * @brief 追加十进制整数（不经过流和临时字符串）
+     */
+    void appendInt(int64_t value) {
+        char digits[24];
+        int pos = static_cast<int>(sizeof(digits));
+        uint64_t magnitude = value < 0 ? 0 - static_cast<uint64_t>(value) : static_cast<uint64_t>(value);
+        do {
+            digits[--pos] = static_cast<char>('0' + magnitude % 10);
+            magnitude /= 10;
+        } while (magnitude > 0);
+        if (value < 0) {
+            digits[--pos] = '-';
+        }
+        append(digits + pos, sizeof(digits) - pos);
+    }
+
+    /**
+     * @brief 追加两位补零的整数（0-99，如月、日、时、分、秒）
+     */
+    void appendTwoDigits(int value) {
+        if (value < 0 || value > 99) {
+            appendInt(value);
+            return;
+        }
+        char digits[2] = {static_cast<char>('0' + value / 10), static_cast<char>('0' + value % 10)};
+        append(digits, 2);
+    }
+
+    /**
+     * @brief 把缓冲区内容写入文件
+     */
+    void flush() {
+        if (size_ > 0) {
+            writeChunk(&buffer_[0], size_);
+            size_ = 0;
+        }
+    }
+
+    /**
+     * @brief 写出剩余内容并关闭文件
+     * @return 全部写入成功返回true
+     */
+    bool close() {
+        if (!file_) {
+            return !failed_;
+        }
+        flush();
+        if (std::fclose(file_) != 0) {
+            failed_ = true;
+        }
+        file_ = nullptr;
+        return !failed_;
+    }
+
+private:
+    void writeChunk(const char* data, size_t length) {
+        if (!file_) {
+            failed_ = true;
+            return;
+        }
+        if (std::fwrite(data, 1, length, file_) != length) {
+            failed_ = true;
+        }
+    }
+
+    std::vector<char> buffer_;   ///< 行缓冲区
+    size_t size_;                ///< 缓冲区已用字节数
+    FILE* file_;                 ///< 输出文件
+    bool failed_;                ///< 是否发生过写入错误
+};
+
+/**
+ * @brief soln_shift.csv格式的排班结果输出
+ *
+ * 用法：open() → 对每个有任务的人员调用beginStaff()，再按开始时间顺序对其每个任务调用writeTask() → close()。
+ * 时间参数为parseDateTimeString返回的秒数（从当天00:00:00起，可超过一天），
+ * 与日期字符串一起格式化为"YYYY-MM-DD HH:MM:SS"。
+ */
+class SolnShiftWriter {
+public:
+    /**
+     * @brief 输出格式中装卸与VIP测试程序原有的差异（保持各自的输出不变）
+     */
+    struct Format {
+        bool roll_over_days;     ///< 超过一天的秒数是否推进日期部分（否则只取当天时间）
+        bool trailing_comma;     ///< 行末"是否加班"之后是否再多一个逗号
+
+        Format(bool roll_over = true, bool trailing = false)
+            : roll_over_days(roll_over)
+            , trailing_comma(trailing)
+        {
+        }
+    };
+
+    explicit SolnShiftWriter(const Format& format = Format(),
+                             size_t buffer_size = BufferedFileWriter::DEFAULT_BUFFER_SIZE)
+        : format_(format)
+        , writer_(buffer_size)
+        , row_count_(0)
+    {
+    }
+
+    /**
+     * @brief 打开输出文件并写入表头
+     * @return 打开成功返回true
+     */
+    bool open(const std::string& filename) {
+        row_count_ = 0;
+        if (!writer_.open(filename)) {
+            return false;
+        }
+        writer_.append("班期日期,班期开始时间,班期结束时间,人员编号,人员姓名,车辆（车牌号）,车辆类型,任务ID,任务名称,任务日期,任务开始时间,任务结束时间,到达航班ID,出发航班ID,到达航班号,出发航班号,航站楼,区域,机位,其他位置,双机航班号,是否加班\n");
+        return true;
+    }
+
+    /**
+     * @brief 开始一个人员的班期（班期各列格式化一次，供该人员的所有任务行复用）
+     * @param shift_date 班期日期
+     * @param shift_start 班期开始时间（秒）
+     * @param shift_end 班期结束时间（秒）
+     * @param staff_id 人员编号
+     * @param staff_name 人员姓名
+     */
+    void beginStaff(const std::string& shift_date, int64_t shift_start, int64_t shift_end,
+                    const std::string& staff_id, const std::string& staff_name) {
+        staff_prefix_.clear();
+        appendQuoted(staff_prefix_, shift_date);
+        staff_prefix_ += '"';
+        formatDateTime(staff_prefix_, shift_start, shift_date);
+        staff_prefix_ += "\",\"";
+        formatDateTime(staff_prefix_, shift_end, shift_date);
+        staff_prefix_ += "\",";
+        appendQuoted(staff_prefix_, staff_id);
+        appendQuoted(staff_prefix_, staff_name);
+    }
+
+    /**
+     * @brief 写出当前人员的一个任务行
+     * @tparam TaskT LoadTask或TaskDefinition（需提供任务ID、名称、日期、航班、航站楼、机位的getter）
+     * @param task 任务
+     * @param start_time 任务开始时间（秒）
+     * @param end_time 任务结束时间（秒）
+     */
+    template <typename TaskT>
+    void writeTask(const TaskT& task, int64_t start_time, int64_t end_time) {
+        writer_.append(staff_prefix_);
+        // 车辆（车牌号）、车辆类型 - 不输出
+        writer_.append("\"\",\"\",", 6);
+        writeTaskColumns(task, start_time, end_time);
+    }
+
+    /**
+     * @brief 写出当前人员的一个任务行（带派到的车辆）
+     * @param vehicle_plate 车牌号
+     * @param vehicle_type 车辆类型
+     */
+    template <typename TaskT>
+    void writeTask(const TaskT& task, int64_t start_time, int64_t end_time,
+                   const std::string& vehicle_plate, const std::string& vehicle_type) {
+        writer_.append(staff_prefix_);
+        writeQuoted(vehicle_plate);
+        writeQuoted(vehicle_type);
+        writeTaskColumns(task, start_time, end_time);
+    }
+
+    /**
+     * @brief 写出当前人员的一个休息行（与排班系统的MEAL_行格式相同：没有航班和机位，其他位置为初始位置）
+     * @param task_id 任务ID
+     * @param task_name 任务名称（如"吃饭"）
+     * @param task_date 任务日期
+     * @param start_time 休息开始时间（秒）
+     * @param end_time 休息结束时间（秒）
+     */
+    void writeBreak(const std::string& task_id, const std::string& task_name, const std::string& task_date,
+                    int64_t start_time, int64_t end_time) {
+        writer_.append(staff_prefix_);
+        writer_.append("\"\",\"\",", 6);
+        writeQuoted(task_id);
+        writeQuoted(task_name);
+        writeQuoted(task_date);
+
+        row_buffer_.clear();
+        row_buffer_ += '"';
+        formatDateTime(row_buffer_, start_time, task_date);
+        row_buffer_ += "\",\"";
+        formatDateTime(row_buffer_, end_time, task_date);
+        row_buffer_ += "\",";
+        writer_.append(row_buffer_);
+
+        // 到达/出发航班ID、航班号、航站楼、区域、机位 - 不输出
+        writer_.append("\"\",\"\",\"\",\"\",\"\",\"\",\"\",", 21);
+        writer_.append(format_.trailing_comma ? "\"INITIAL_GATE_POS\",\"\",\"否\",\n"
+                                              : "\"INITIAL_GATE_POS\",\"\",\"否\"\n");
+        row_count_++;
+    }
+
+    /**
+     * @brief 已写出的任务行数
+     */
+    size_t getRowCount() const { return row_count_; }
+
+    /**
+     * @brief 写出剩余内容并关闭文件
+     * @return 全部写入成功返回true
+     */
+    bool close() {
+        return writer_.close();
+    }
+
+    /**
+     * @brief 把秒数和日期格式化为"YYYY-MM-DD HH:MM:SS"追加到out（seconds<=0时不追加）
+     *
+     * date为空时以2020-01-01为基准日期；跨天时日期按每月30天简化推进（与原测试程序一致）。
+     */
+    void formatDateTime(std::string& out, int64_t seconds, const std::string& date) const {
+        if (seconds <= 0) {
+            return;
+        }
+        int64_t days = seconds / 86400;
+        int64_t remaining_seconds = seconds % 86400;
+
+        if (!date.empty()) {
+            // 移除可能的引号
+            size_t begin = 0;
+            size_t length = date.length();
+            if (length >= 2 && date[0] == '"' && date[length - 1] == '"') {
+                begin = 1;
+                length -= 2;
+            }
+            int year = 0;
+            int month = 0;
+            int day = 0;
+            if (days > 0 && format_.roll_over_days && parseDate(date, begin, length, year, month, day)) {
+                rollOverDays(year, month, day, days);
+                appendDate(out, year, month, day);
+            } else {
+                out.append(date, begin, length);
+            }
+        } else {
+            int year = 2020;
+            int month = 1;
+            int day = 1;
+            rollOverDays(year, month, day, days);
+            appendDate(out, year, month, day);
+        }
+
+        out += ' ';
+        appendTwoDigits(out, static_cast<int>(remaining_seconds / 3600));
+        out += ':';
+        appendTwoDigits(out, static_cast<int>((remaining_seconds % 3600) / 60));
+        out += ':';
+        appendTwoDigits(out, static_cast<int>(remaining_seconds % 60));
+    }
+
+private:
+    // 辅助函数：写出任务ID到行末的各列
+    template <typename TaskT>
+    void writeTaskColumns(const TaskT& task, int64_t start_time, int64_t end_time) {
+        writeQuoted(task.getTaskId());
+        writeQuoted(task.getTaskName());
+        writeQuoted(task.getTaskDate());
+
+        row_buffer_.clear();
+        row_buffer_ += '"';
+        formatDateTime(row_buffer_, start_time, task.getTaskDate());
+        row_buffer_ += "\",\"";
+        formatDateTime(row_buffer_, end_time, task.getTaskDate());
+        row_buffer_ += "\",";
+        writer_.append(row_buffer_);
+
+        writeQuoted(task.getArrivalFlightId());
+        writeQuoted(task.getDepartureFlightId());
+        writeQuoted(task.getArrivalFlightNumber());
+        writeQuoted(task.getDepartureFlightNumber());
+        writeQuoted(task.getTerminal());
+        // 区域 - 不输出
+        writer_.append("\"\",", 3);
+        // 机位（无机位不输出）
+        writer_.appendChar('"');
+        if (task.getStand() > 0) {
+            writer_.appendInt(task.getStand());
+        }
+        writer_.append("\",", 2);
+        // 其他位置、双机航班号 - 不输出；是否加班 - 全部为"否"
+        writer_.append(format_.trailing_comma ? "\"\",\"\",\"否\",\n" : "\"\",\"\",\"否\"\n");
+        row_count_++;
+    }
+
+    // 辅助函数：追加 "text",
+    static void appendQuoted(std::string& out, const std::string& text) {
+        out += '"';
+        out += text;
+        out += "\",";
+    }
+
+    void writeQuoted(const std::string& text) {
+        writer_.appendChar('"');
+        writer_.append(text);
+        writer_.append("\",", 2);
+    }
+
+    static void appendTwoDigits(std::string& out, int value) {
+        if (value >= 0 && value <= 99) {
+            out += static_cast<char>('0' + value / 10);
+            out += static_cast<char>('0' + value % 10);
+        } else {
+            out += std::to_string(value);
+        }
+    }
+
+    static void appendDate(std::string& out, int year, int month, int day) {
+        out += std::to_string(year);
+        out += '-';
+        appendTwoDigits(out, month);
+        out += '-';
+        appendTwoDigits(out, day);
+    }
+
+    // 辅助函数：按每月30天推进日期
+    static void rollOverDays(int& year, int& month, int& day, int64_t days) {
+        day += static_cast<int>(days);
+        while (day > 30) {
+            day -= 30;
+            month++;
+            if (month > 12) {
+                month = 1;
+                year++;
+            }
+        }
+    }
+
+    // 辅助函数：解析"YYYY-MM-DD"（与stoi一致：跳过前导空白，允许符号，至少一位数字）
+    static bool parseDate(const std::string& text, size_t begin, size_t length,
+                          int& year, int& month, int& day) {
+        size_t end = begin + length;
+        size_t dash1 = text.find('-', begin);
+        if (dash1 == std::string::npos || dash1 >= end) {
+            return false;
+        }
+        size_t dash2 = text.find('-', dash1 + 1);
+        if (dash2 == std::string::npos || dash2 >= end) {
+            return false;
+        }
+        return parseInt(text, begin, dash1, year) &&
+               parseInt(text, dash1 + 1, dash2, month) &&
+               parseInt(text, dash2 + 1, end, day);
+    }
+
+    static bool parseInt(const std::string& text, size_t begin, size_t end, int& value) {
+        while (begin < end && (text[begin] == ' ' || text[begin] == '\t')) {
+            begin++;
+        }
+        bool negative = false;
+        if (begin < end && (text[begin] == '-' || text[begin] == '+')) {
+            negative = text[begin] == '-';
+            begin++;
+        }
+        if (begin >= end || text[begin] < '0' || text[begin] > '9') {
+            return false;
+        }
+        int result = 0;
+        while (begin < end && text[begin] >= '0' && text[begin] <= '9') {
+            result = result * 10 + (text[begin] - '0');
+            begin++;
+        }
+        value = negative ? -result : result;
+        return true;
+    }
+
+    Format format_;                  ///< 输出格式差异
+    BufferedFileWriter writer_;      ///< 文件写入器
+    std::string staff_prefix_;       ///< 当前人员的班期列（已格式化）
+    std::string row_buffer_;         ///< 任务时间列的临时缓冲（复用，不逐行分配）
+    size_t row_count_;               ///< 已写出的任务行数
+};
+
+}  // namespace Output
+}  // namespace AirportStaffScheduler
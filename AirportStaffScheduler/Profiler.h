@@ -0,0 +1,381 @@
+/**
+ * @file Profiler.h
+ * @brief 调度阶段计时与计数（性能剖析）
+ *
+ * 在关键阶段放置RAII计时器和计数器，数据先记录在各线程自己的缓冲区中，
+ * 调度结束后导出为Chrome trace-event JSON（chrome://tracing、Perfetto可直接打开）
+ * 和按阶段汇总的统计表。
+ *
+ * 只有定义了AIRPORT_SCHEDULER_PROFILING宏时计时宏才会展开，否则全部编译为空语句，
+ * 不产生任何运行时开销（PROFILE_SCOPE_DETAIL等的参数表达式也不会被求值）。
+ */
+
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <vector>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <fstream>
+#include <ostream>
+#include <iomanip>
+#include <algorithm>
+
+namespace AirportStaffScheduler {
+namespace Profiling {
+
+/**
+ * @brief 单个计时事件
+ */
+struct TraceEvent {
+    const char* name;            ///< 阶段名（字符串字面量）
+    std::string detail;          ///< 附加说明（如文件名），可为空
+    long long start_ns;          ///< 开始时间（相对进程内计时起点，纳秒）
+    long long duration_ns;       ///< 持续时间（纳秒）
+};
+
+/**
+ * @brief 阶段汇总统计
+ */
+struct PhaseStats {
+    long long count = 0;         ///< 调用次数
+    long long total_ns = 0;      ///< 总耗时（纳秒）
+    long long max_ns = 0;        ///< 单次最大耗时（纳秒）
+
+    void add(long long duration_ns) {
+        count++;
+        total_ns += duration_ns;
+        max_ns = std::max(max_ns, duration_ns);
+    }
+};
+
+/**
+ * @brief 单个线程的记录缓冲区
+ *
+ * 只由所属线程写入；导出和清空须在被测线程结束（或空闲）后进行。
+ * 阶段统计和计数器按名字指针线性查找，阶段名通常只有十几个。
+ */
+class ThreadBuffer {
+public:
+    static const size_t MAX_EVENTS = 1 << 20;  ///< 单线程最多保留的事件数，超出后只计入统计
+
+    explicit ThreadBuffer(int thread_index) : thread_index_(thread_index), dropped_events_(0) {}
+
+    void record(const char* name, const std::string& detail, long long start_ns, long long duration_ns) {
+        findPhase(name).add(duration_ns);
+        if (events_.size() < MAX_EVENTS) {
+            TraceEvent event;
+            event.name = name;
+            event.detail = detail;
+            event.start_ns = start_ns;
+            event.duration_ns = duration_ns;
+            events_.push_back(event);
+        } else {
+            dropped_events_++;
+        }
+    }
+
+    void addCount(const char* name, long long delta) {
+        for (auto& counter : counters_) {
+            if (counter.first == name) {
+                counter.second += delta;
+                return;
+            }
+        }
+        counters_.push_back(std::make_pair(name, delta));
+    }
+
+    void clear() {
+        events_.clear();
+        phases_.clear();
+        counters_.clear();
+        dropped_events_ = 0;
+    }
+
+    int getThreadIndex() const { return thread_index_; }
+    const std::vector<TraceEvent>& getEvents() const { return events_; }
+    const std::vector<std::pair<const char*, PhaseStats>>& getPhases() const { return phases_; }
+    const std::vector<std::pair<const char*, long long>>& getCounters() const { return counters_; }
+    long long getDroppedEvents() const { return dropped_events_; }
+
+private:
+    PhaseStats& findPhase(const char* name) {
+        for (auto& phase : phases_) {
+            if (phase.first == name) {
+                return phase.second;
+            }
+        }
+        phases_.push_back(std::make_pair(name, PhaseStats()));
+        return phases_.back().second;
+    }
+
+    int thread_index_;                                          ///< 线程编号（导出时作为tid）
+    std::vector<TraceEvent> events_;                            ///< 计时事件
+    std::vector<std::pair<const char*, PhaseStats>> phases_;    ///< 阶段汇总
+    std::vector<std::pair<const char*, long long>> counters_;   ///< 计数器
+    long long dropped_events_;                                  ///< 超出上限未保留的事件数
+};
+
+/**
+ * @brief 线程缓冲区登记表（单例）
+ *
+ * 缓冲区由登记表共享持有，线程退出后数据仍然保留，直到reset()。
+ */
+class Registry {
+public:
+    static Registry& getInstance() {
+        static Registry instance;
+        return instance;
+    }
+
+    std::shared_ptr<ThreadBuffer> registerThread() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::shared_ptr<ThreadBuffer> buffer(new ThreadBuffer(static_cast<int>(buffers_.size()) + 1));
+        buffers_.push_back(buffer);
+        return buffer;
+    }
+
+    std::vector<std::shared_ptr<ThreadBuffer>> getBuffers() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return buffers_;
+    }
+
+    /**
+     * @brief 计时起点（首次使用时确定）
+     */
+    std::chrono::steady_clock::time_point getEpoch() const { return epoch_; }
+
+private:
+    Registry() : epoch_(std::chrono::steady_clock::now()) {}
+    Registry(const Registry&) = delete;
+    Registry& operator=(const Registry&) = delete;
+
+    mutable std::mutex mutex_;
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers_;
+    std::chrono::steady_clock::time_point epoch_;
+};
+
+/**
+ * @brief 当前线程的缓冲区（首次使用时登记）
+ */
+inline ThreadBuffer& localBuffer() {
+    static thread_local std::shared_ptr<ThreadBuffer> buffer = Registry::getInstance().registerThread();
+    return *buffer;
+}
+
+/**
+ * @brief 当前时间（相对计时起点，纳秒）
+ */
+inline long long nowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - Registry::getInstance().getEpoch()).count();
+}
+
+/**
+ * @brief 累加当前线程的计数器
+ */
+inline void addCount(const char* name, long long delta) {
+    localBuffer().addCount(name, delta);
+}
+
+/**
+ * @brief RAII阶段计时器：构造时开始计时，析构或stop()时记录
+ */
+class ScopedTimer {
+public:
+    explicit ScopedTimer(const char* name)
+        : name_(name)
+        , start_ns_(nowNs())
+        , running_(true)
+    {
+    }
+
+    ScopedTimer(const char* name, const std::string& detail)
+        : name_(name)
+        , detail_(detail)
+        , start_ns_(nowNs())
+        , running_(true)
+    {
+    }
+
+    ~ScopedTimer() { stop(); }
+
+    /**
+     * @brief 提前结束计时（用于不便另开作用域的代码段），重复调用无效果
+     */
+    void stop() {
+        if (!running_) {
+            return;
+        }
+        running_ = false;
+        localBuffer().record(name_, detail_, start_ns_, nowNs() - start_ns_);
+    }
+
+private:
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+    const char* name_;
+    std::string detail_;
+    long long start_ns_;
+    bool running_;
+};
+
+/**
+ * @brief 是否编译了计时宏
+ */
+inline bool isEnabled() {
+#ifdef AIRPORT_SCHEDULER_PROFILING
+    return true;
+#else
+    return false;
+#endif
+}
+
+/**
+ * @brief 清空所有线程的记录（须在没有线程正在计时时调用）
+ */
+inline void reset() {
+    for (const auto& buffer : Registry::getInstance().getBuffers()) {
+        buffer->clear();
+    }
+}
+
+// 辅助函数：JSON字符串转义（Windows路径中的反斜杠、引号等）
+inline std::string escapeJson(const std::string& str) {
+    std::string result;
+    result.reserve(str.size());
+    for (char c : str) {
+        switch (c) {
+            case '"': result += "\\\""; break;
+            case '\\': result += "\\\\"; break;
+            case '\n': result += "\\n"; break;
+            case '\r': result += "\\r"; break;
+            case '\t': result += "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    result += ' ';
+                } else {
+                    result += c;
+                }
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief 导出Chrome trace-event JSON
+ *
+ * 计时事件导出为"X"（完整事件），计数器在各线程最后时刻导出为"C"事件
+ * @param filename 输出文件名
+ * @return 写入成功返回true
+ */
+inline bool writeChromeTrace(const std::string& filename) {
+    std::ofstream file(filename, std::ios::out | std::ios::trunc);
+    if (!file.is_open()) {
+        return false;
+    }
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first = true;
+    file << std::fixed << std::setprecision(3);
+    for (const auto& buffer : Registry::getInstance().getBuffers()) {
+        long long last_ns = 0;
+        for (const auto& event : buffer->getEvents()) {
+            file << (first ? "\n" : ",\n") << "{\"name\":\"" << escapeJson(event.name)
+                 << "\",\"cat\":\"scheduler\",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->getThreadIndex()
+                 << ",\"ts\":" << event.start_ns / 1000.0 << ",\"dur\":" << event.duration_ns / 1000.0;
+            if (!event.detail.empty()) {
+                file << ",\"args\":{\"detail\":\"" << escapeJson(event.detail) << "\"}";
+            }
+            file << "}";
+            first = false;
+            last_ns = std::max(last_ns, event.start_ns + event.duration_ns);
+        }
+        for (const auto& counter : buffer->getCounters()) {
+            file << (first ? "\n" : ",\n") << "{\"name\":\"" << escapeJson(counter.first)
+                 << "\",\"cat\":\"scheduler\",\"ph\":\"C\",\"pid\":1,\"tid\":" << buffer->getThreadIndex()
+                 << ",\"ts\":" << last_ns / 1000.0 << ",\"args\":{\"value\":" << counter.second << "}}";
+            first = false;
+        }
+    }
+    file << "\n]}\n";
+    return file.good();
+}
+
+/**
+ * @brief 输出按阶段汇总的统计表（所有线程按阶段名合并）
+ * @param os 输出流
+ */
+inline void printSummary(std::ostream& os) {
+    std::map<std::string, PhaseStats> phases;
+    std::map<std::string, long long> counters;
+    long long dropped_events = 0;
+    for (const auto& buffer : Registry::getInstance().getBuffers()) {
+        for (const auto& phase : buffer->getPhases()) {
+            PhaseStats& merged = phases[phase.first];
+            merged.count += phase.second.count;
+            merged.total_ns += phase.second.total_ns;
+            merged.max_ns = std::max(merged.max_ns, phase.second.max_ns);
+        }
+        for (const auto& counter : buffer->getCounters()) {
+            counters[counter.first] += counter.second;
+        }
+        dropped_events += buffer->getDroppedEvents();
+    }
+
+    // 按总耗时从大到小输出
+    std::vector<std::pair<std::string, PhaseStats>> sorted(phases.begin(), phases.end());
+    std::stable_sort(sorted.begin(), sorted.end(),
+                     [](const std::pair<std::string, PhaseStats>& a, const std::pair<std::string, PhaseStats>& b) {
+                         return a.second.total_ns > b.second.total_ns;
+                     });
+
+    std::ios::fmtflags flags = os.flags();
+    os << std::left << std::setw(32) << "Phase" << std::right << std::setw(10) << "Calls"
+       << std::setw(14) << "Total(ms)" << std::setw(12) << "Avg(us)" << std::setw(12) << "Max(us)" << "\n";
+    os << std::fixed << std::setprecision(3);
+    for (const auto& phase : sorted) {
+        const PhaseStats& stats = phase.second;
+        os << std::left << std::setw(32) << phase.first << std::right << std::setw(10) << stats.count
+           << std::setw(14) << stats.total_ns / 1e6
+           << std::setw(12) << (stats.count > 0 ? stats.total_ns / 1e3 / stats.count : 0.0)
+           << std::setw(12) << stats.max_ns / 1e3 << "\n";
+    }
+    if (!counters.empty()) {
+        os << std::left << std::setw(32) << "Counter" << std::right << std::setw(10) << "Value" << "\n";
+        for (const auto& counter : counters) {
+            os << std::left << std::setw(32) << counter.first << std::right << std::setw(10) << counter.second << "\n";
+        }
+    }
+    if (dropped_events > 0) {
+        os << "(" << dropped_events << " events beyond the per-thread limit were counted but not traced)\n";
+    }
+    os.flags(flags);
+}
+
+}  // namespace Profiling
+}  // namespace AirportStaffScheduler
+
+#ifdef AIRPORT_SCHEDULER_PROFILING
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+/// 计时到当前作用域结束
+#define PROFILE_SCOPE(name) \
+    ::AirportStaffScheduler::Profiling::ScopedTimer PROFILE_CONCAT(profile_scope_, __LINE__)(name)
+/// 计时到当前作用域结束，附带说明（如文件名）
+#define PROFILE_SCOPE_DETAIL(name, detail) \
+    ::AirportStaffScheduler::Profiling::ScopedTimer PROFILE_CONCAT(profile_scope_, __LINE__)(name, detail)
+/// 具名计时器，配合PROFILE_TIMER_STOP提前结束
+#define PROFILE_TIMER(var, name) ::AirportStaffScheduler::Profiling::ScopedTimer var(name)
+#define PROFILE_TIMER_STOP(var) var.stop()
+/// 累加计数器
+#define PROFILE_COUNT(name, delta) ::AirportStaffScheduler::Profiling::addCount(name, delta)
+#else
+#define PROFILE_SCOPE(name) ((void)0)
+#define PROFILE_SCOPE_DETAIL(name, detail) ((void)0)
+#define PROFILE_TIMER(var, name) ((void)0)
+#define PROFILE_TIMER_STOP(var) ((void)0)
+#define PROFILE_COUNT(name, delta) ((void)0)
+#endif
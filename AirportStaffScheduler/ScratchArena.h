@@ -0,0 +1,144 @@
+/**
+ * @file ScratchArena.h
+ * @brief 单次派工的临时存储区（单调增长，运行结束时一次性释放）
+ *
+ * 派工过程中的映射表、小组列表、轮换数组和每轮的候选小组等临时容器只在一次
+ * assignTasksToEmployees中使用。用默认分配器时每个map节点、每次vector扩容都是一次堆分配，
+ * 结束时再逐个释放。这里按块向操作系统申请内存，块内顺序切分：
+ * - MonotonicArena：分配只移动块内指针，释放为空操作，析构（或release）时整块归还；
+ * - ArenaAllocator：满足标准分配器要求，可作为vector/map/unordered_map的分配器；
+ * - ArenaVector / ArenaMap / ArenaUnorderedMap / ArenaUnorderedSet：常用容器的别名。
+ *
+ * 容器释放的内存不会被复用，每轮都要清空重填的缓冲区应在循环外创建、循环内clear()，
+ * 保留已有容量；unordered_map应预先reserve，避免扩容时旧的桶数组留在存储区中。
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <new>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace AirportStaffScheduler {
+namespace Memory {
+
+/**
+ * @brief 单调增长的存储区（非线程安全，同一时刻只供一次派工使用）
+ */
+class MonotonicArena {
+public:
+    static const size_t DEFAULT_BLOCK_SIZE = 64 * 1024;   ///< 默认块大小
+
+    /**
+     * @brief 构造函数
+     * @param block_size 每块的大小（超过块大小的单次分配单独成块）
+     */
+    explicit MonotonicArena(size_t block_size = DEFAULT_BLOCK_SIZE)
+        : block_size_(block_size), current_(nullptr), remaining_(0), allocated_(0) {}
+
+    ~MonotonicArena() { release(); }
+
+    MonotonicArena(const MonotonicArena&) = delete;
+    MonotonicArena& operator=(const MonotonicArena&) = delete;
+
+    /**
+     * @brief 分配内存（按align对齐，申请不到时抛出std::bad_alloc）
+     */
+    void* allocate(size_t bytes, size_t align) {
+        size_t padding = (align - reinterpret_cast<size_t>(current_) % align) % align;
+        if (current_ == nullptr || padding + bytes > remaining_) {
+            size_t size = bytes + align > block_size_ ? bytes + align : block_size_;
+            char* block = static_cast<char*>(::operator new(size));
+            blocks_.push_back(block);
+            current_ = block;
+            remaining_ = size;
+            padding = (align - reinterpret_cast<size_t>(current_) % align) % align;
+        }
+        char* result = current_ + padding;
+        current_ = result + bytes;
+        remaining_ -= padding + bytes;
+        allocated_ += bytes;
+        return result;
+    }
+
+    /**
+     * @brief 归还所有块（之前分配的内存全部失效）
+     */
+    void release() {
+        for (char* block : blocks_) {
+            ::operator delete(block);
+        }
+        blocks_.clear();
+        current_ = nullptr;
+        remaining_ = 0;
+        allocated_ = 0;
+    }
+
+    /**
+     * @brief 已分配的字节数
+     */
+    size_t allocatedBytes() const { return allocated_; }
+
+    /**
+     * @brief 已申请的块数
+     */
+    size_t blockCount() const { return blocks_.size(); }
+
+private:
+    size_t block_size_;               ///< 块大小
+    char* current_;                   ///< 当前块中下一次分配的位置
+    size_t remaining_;                ///< 当前块剩余字节数
+    size_t allocated_;                ///< 已分配的字节数
+    std::vector<char*> blocks_;       ///< 已申请的块
+};
+
+/**
+ * @brief 从MonotonicArena分配的标准分配器（deallocate为空操作）
+ */
+template <typename T>
+class ArenaAllocator {
+public:
+    typedef T value_type;
+
+    ArenaAllocator(MonotonicArena& arena) : arena_(&arena) {}
+
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) : arena_(other.arena()) {}
+
+    T* allocate(size_t n) {
+        return static_cast<T*>(arena_->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T*, size_t) {}
+
+    MonotonicArena* arena() const { return arena_; }
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U>& other) const { return arena_ == other.arena(); }
+
+    template <typename U>
+    bool operator!=(const ArenaAllocator<U>& other) const { return arena_ != other.arena(); }
+
+private:
+    MonotonicArena* arena_;
+};
+
+template <typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+
+template <typename K, typename V, typename Compare = std::less<K>>
+using ArenaMap = std::map<K, V, Compare, ArenaAllocator<std::pair<const K, V>>>;
+
+template <typename K, typename V, typename Hash = std::hash<K>>
+using ArenaUnorderedMap = std::unordered_map<K, V, Hash, std::equal_to<K>, ArenaAllocator<std::pair<const K, V>>>;
+
+template <typename K, typename Hash = std::hash<K>>
+using ArenaUnorderedSet = std::unordered_set<K, Hash, std::equal_to<K>, ArenaAllocator<K>>;
+
+}  // namespace Memory
+}  // namespace AirportStaffScheduler
@@ -0,0 +1,210 @@
+/**
+ * @file SyntheticDayGenerator.h
+ * @brief 合成航班日生成器
+ *
+ * 按参数生成与input目录同格式的一天输入（task.csv、shift.csv、staff.csv、stand_pos.csv、
+ * connectRule.csv、parameter.csv），用于性能基准和规模测试。
+ * 相同参数和随机种子生成的文件完全相同。
+ */
+
+#pragma once
+
+#include "DayModel.h"
+#include <string>
+#include <vector>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <random>
+#include <algorithm>
+
+namespace AirportStaffScheduler {
+namespace Synthetic {
+
+/**
+ * @brief 合成航班日参数
+ */
+struct SyntheticDayOptions {
+    int task_count = 1000;               ///< 目标任务数（过站航班生成进港卸机+出港装机两个任务）
+    int group_count = 8;                 ///< 装卸小组数（每组3人，前一半主班、后一半副班）
+    int stand_count = 24;                ///< 机位数
+    double remote_stand_ratio = 0.3;     ///< 远机位比例
+    double transit_ratio = 0.6;          ///< 过站航班比例
+    double wide_body_ratio = 0.2;        ///< 宽体机比例
+    int bank_count = 6;                  ///< 航班波峰数（均匀分布在06:00-22:00）
+    long bank_spread = 25 * 60;          ///< 波峰内航班时间的标准差（秒）
+    std::string date = "2025-11-21";     ///< 任务日期
+    unsigned seed = 20251121;            ///< 随机种子
+};
+
+/**
+ * @brief 秒数格式化为"日期 HH:MM:SS"
+ */
+inline std::string formatDateTime(const std::string& date, long seconds) {
+    seconds = std::max(0L, std::min(seconds, 24L * 3600 - 1));
+    std::ostringstream oss;
+    oss << date << " " << std::setfill('0') << std::setw(2) << seconds / 3600 << ":"
+        << std::setw(2) << (seconds % 3600) / 60 << ":" << std::setw(2) << seconds % 60;
+    return oss.str();
+}
+
+/**
+ * @brief 生成的文件名（带前缀，便于同一目录保存多组数据）
+ */
+inline Model::DayModelFiles syntheticDayFiles(const std::string& prefix) {
+    Model::DayModelFiles files;
+    files.task_file = prefix + "task.csv";
+    files.shift_file = prefix + "shift.csv";
+    files.staff_file = prefix + "staff.csv";
+    files.stand_file = prefix + "stand_pos.csv";
+    files.connect_rule_file = prefix + "connectRule.csv";
+    files.parameter_file = prefix + "parameter.csv";
+    files.snapshot_file = prefix + "day_model.snapshot";
+    return files;
+}
+
+/**
+ * @brief 生成一天的输入文件
+ * @param output_dir 输出目录（以/或\结尾，目录需已存在）
+ * @param prefix 文件名前缀
+ * @param options 生成参数
+ * @param files 输出参数，生成的文件名（可直接传给Model::loadDayModel）
+ * @return 全部文件写入成功返回true
+ */
+inline bool writeSyntheticDay(const std::string& output_dir, const std::string& prefix,
+                              const SyntheticDayOptions& options, Model::DayModelFiles& files) {
+    files = syntheticDayFiles(prefix);
+    std::mt19937 rng(options.seed);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    std::normal_distribution<double> bank_noise(0.0, static_cast<double>(options.bank_spread));
+    auto randomRange = [&rng](long low, long high) {
+        return std::uniform_int_distribution<long>(low, high)(rng);
+    };
+
+    const long first_bank = 6 * 3600;
+    const long last_bank = 22 * 3600;
+    const int bank_count = std::max(1, options.bank_count);
+    const int stand_count = std::max(1, options.stand_count);
+    const int remote_from = stand_count - static_cast<int>(stand_count * options.remote_stand_ratio);
+
+    // 1. 机位
+    std::ofstream stand_file(output_dir + files.stand_file);
+    if (!stand_file.is_open()) {
+        return false;
+    }
+    stand_file << "\"机位\",\"相邻机位\",\"是否为远机位\"\n";
+    for (int stand = 1; stand <= stand_count; ++stand) {
+        std::string adjacent;
+        for (int other = std::max(1, stand - 2); other <= std::min(stand_count, stand + 2); ++other) {
+            if (other != stand) {
+                adjacent += (adjacent.empty() ? "" : ";") + std::to_string(other);
+            }
+        }
+        stand_file << "\"" << stand << "\",\"" << adjacent << "\",\"" << (stand > remote_from ? "Y" : "N") << "\"\n";
+    }
+
+    // 2. 班次和人员（每组3人，前一半主班06:00-19:30，后一半副班10:30-23:59）
+    std::ofstream shift_file(output_dir + files.shift_file);
+    std::ofstream staff_file(output_dir + files.staff_file);
+    if (!shift_file.is_open() || !staff_file.is_open()) {
+        return false;
+    }
+    shift_file << "\"员工编号\",\"人员姓名\",\"班组名\",\"班次名称\",\"班期开始时间\",\"班期结束时间\","
+                  "\"是否备班\",\"是否允许加班\",\"是否尽量不派工\"\n";
+    staff_file << "\"员工姓名\",\"员工编号\",\"员工资质集合\",\"员工班组资质集合\",\"员工资质等级\","
+                  "\"班组名\",\"岗位\",\"关联人员\"\n";
+    const int group_count = std::max(1, options.group_count);
+    const int main_groups = (group_count + 1) / 2;
+    for (int group = 0; group < group_count; ++group) {
+        bool is_main = group < main_groups;
+        std::string group_name = (is_main ? "1." : "2.") + std::to_string(is_main ? group + 1 : group - main_groups + 1);
+        std::string shift_start = formatDateTime(options.date, is_main ? 6 * 3600 : 10 * 3600 + 30 * 60);
+        std::string shift_end = formatDateTime(options.date, is_main ? 19 * 3600 + 30 * 60 : 24 * 3600 - 60);
+        for (int member = 1; member <= 3; ++member) {
+            std::string staff_id = "emp" + std::to_string(group * 3 + member);
+            std::string staff_name = "员工" + std::to_string(group * 3 + member);
+            shift_file << "\"" << staff_id << "\",\"" << staff_name << "\",\"" << group_name << "\",\""
+                       << (is_main ? "主班" : "副班") << "\",\"" << shift_start << "\",\"" << shift_end
+                       << "\",\"FALSE\",\"Y\",\"N\"\n";
+            staff_file << "\"" << staff_name << "\",\"" << staff_id << "\",\"装卸资质\",\"装卸资质\",,\""
+                       << group_name << "\",\"装卸组\",\"\"\n";
+        }
+    }
+
+    // 3. 任务（按波峰生成航班，过站航班拆成进港卸机和出港装机）
+    std::ofstream task_file(output_dir + files.task_file);
+    if (!task_file.is_open()) {
+        return false;
+    }
+    task_file << "\"任务ID\",\"任务名称\",\"任务日期\",\"任务开始时间\",\"任务时长\",\"进/出港\","
+                 "\"到达航班ID\",\"到达航班预达时间\",\"出发航班ID\",\"出发航班预离时间\",\"到达航班号\","
+                 "\"出发航班号\",\"航班类型\",\"机型类型\",\"任务资质要求\",\"航站楼\",\"机位\","
+                 "\"任务装卸货量\",\"任务对应的航班所需最少人数\",\"服务项\"\n";
+
+    int task_index = 0;
+    int flight_index = 0;
+    while (task_index < options.task_count) {
+        ++flight_index;
+        int bank = flight_index % bank_count;
+        long bank_center = bank_count == 1 ? (first_bank + last_bank) / 2
+                                           : first_bank + (last_bank - first_bank) * bank / (bank_count - 1);
+        bool wide = uniform(rng) < options.wide_body_ratio;
+        bool transit = uniform(rng) < options.transit_ratio;
+        bool arrival_only = !transit && uniform(rng) < 0.5;
+        long arrival = bank_center + static_cast<long>(bank_noise(rng));
+        long turnaround = wide ? randomRange(90 * 60, 150 * 60) : randomRange(45 * 60, 70 * 60);
+        long departure = arrival + turnaround;
+        int stand = static_cast<int>(randomRange(1, stand_count));
+        double cargo = wide ? 3.0 + uniform(rng) * 9.0 : 0.5 + uniform(rng) * 2.5;
+        int required_count = cargo >= 2.5 ? 6 : 3;
+
+        std::string body = wide ? "宽体" : "窄体";
+        std::string attribute = transit ? "短过站" : (arrival_only ? "航后" : "航前");
+        std::string arr_id = "ARR" + std::to_string(flight_index);
+        std::string dep_id = "DEP" + std::to_string(flight_index);
+        std::string arr_no = "SY" + std::to_string(1000 + 2 * flight_index);
+        std::string dep_no = "SY" + std::to_string(1001 + 2 * flight_index);
+
+        auto writeTask = [&](bool is_arrival) {
+            long duration = is_arrival ? (wide ? randomRange(45, 70) : randomRange(20, 40))
+                                       : (wide ? randomRange(50, 80) : randomRange(30, 50));
+            long start = is_arrival ? arrival : departure - duration * 60 - 15 * 60;
+            task_file << "\"T" << ++task_index << "\",\"" << (is_arrival ? "进港卸机" : "出港装机") << "\",\""
+                      << options.date << "\",\"" << formatDateTime(options.date, start) << "\"," << duration
+                      << ",\"" << (is_arrival ? "进" : "出") << "\",\""
+                      << (is_arrival || transit ? arr_id : "") << "\",\""
+                      << (is_arrival || transit ? formatDateTime(options.date, arrival) : "") << "\",\""
+                      << (!is_arrival || transit ? dep_id : "") << "\",\""
+                      << (!is_arrival || transit ? formatDateTime(options.date, departure) : "") << "\",\""
+                      << arr_no << "\",\"" << dep_no << "\",\"" << attribute << "\",\"" << body
+                      << "\",\"\",\"T1\",\"" << stand << "\"," << std::fixed << std::setprecision(2) << cargo
+                      << "," << required_count << ",\"装卸服务\"\n";
+        };
+
+        if (transit || arrival_only) {
+            writeTask(true);
+        }
+        if ((transit || !arrival_only) && task_index < options.task_count) {
+            writeTask(false);
+        }
+    }
+
+    // 4. 规则（与样例一致的衔接规则，派工时间覆盖全天）
+    std::ofstream connect_file(output_dir + files.connect_rule_file);
+    std::ofstream parameter_file(output_dir + files.parameter_file);
+    if (!connect_file.is_open() || !parameter_file.is_open()) {
+        return false;
+    }
+    connect_file << "\"前一个航班进/出港\",\"前一个航班机型\",\"后一个航班进/出港\",\"最小时间间隔\"\n"
+                 << "\"出\",\"窄体\",\"进\",-30\n\"出\",\"宽体\",\"进\",20\n"
+                 << "\"进\",\"窄体\",\"出\",100\n\"进\",\"宽体\",\"出\",140\n"
+                 << "\"出\",\"窄体\",\"出\",30\n\"出\",\"宽体\",\"出\",80\n"
+                 << "\"进\",\"窄体\",\"进\",30\n\"进\",\"宽体\",\"进\",80\n";
+    parameter_file << "\"派工工种\",\"派工结束时间\",\"派工开始时间\"\n"
+                   << "\"4\",\"" << formatDateTime(options.date, 24 * 3600 - 1) << "\",\""
+                   << formatDateTime(options.date, 5 * 3600) << "\"\n";
+    return true;
+}
+
+}  // namespace Synthetic
+}  // namespace AirportStaffScheduler
@@ -0,0 +1,600 @@
+/**
+ * @file scheduler_benchmark.cpp
+ * @brief 调度算法规模基准
+ *
+ * 用合成航班日（SyntheticDayGenerator.h）从100到50000个任务逐级生成输入，分别计时
+ * LoadScheduler::scheduleLoadTasks、TaskScheduler::scheduleTasks和CheckInSchedulingAlgorithm，
+ * 输出耗时、内存分配次数/字节数和方案质量（任务满足率），结果同时写入benchmark_result.csv。
+ *
+ * 用法：scheduler_benchmark [任务数...] [--budget 秒] [--seed 种子] [--dir 数据目录]
+ * 数据目录不存在时自动创建（含缺失的父目录）。
+ * 某个调度器单次耗时超过预算后，更大规模跳过该调度器，避免平方级增长时跑不完。
+ * 开始计时前先做一次约束校验自检（埋入的重叠和路程不足必须被报告），失败时返回1。
+ */
+
+#include "../SyntheticDayGenerator.h"
+#include "../DayModel.h"
+#include "../DayModelSnapshot.h"
+#include "../PlanDiff.h"
+#include "../Logger.h"
+#include "../CheckInSchedulingAlgorithm.h"
+#include "../zhuangxie_class/load_scheduler.h"
+#include "../zhuangxie_class/load_model_view.h"
+#include "../zhuangxie_class/connect_rule_table.h"
+#include "../zhuangxie_class/vehicle_pool.h"
+#include "../zhuangxie_class/capacity_sweep.h"
+#include "../vip_first_class_algo/task_scheduler.h"
+#include "../vip_first_class_algo/vip_model_view.h"
+#include "../vip_first_class_algo/employee_manager.h"
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <sys/types.h>
+#include <sys/stat.h>
+#ifdef _WIN32
+#include <direct.h>
+#endif
+
+// ===== 内存分配计数（替换全局operator new/delete） =====
+
+static std::atomic<long long> g_alloc_count(0);
+static std::atomic<long long> g_alloc_bytes(0);
+
+// 分配和释放都经过不内联的函数：operator new/delete内联进调用方后，GCC会把malloc得到的指针
+// 当成operator new的返回值，在每个delete处报 -Wmismatched-new-delete
+#if defined(__GNUC__)
+#define BENCH_NOINLINE __attribute__((noinline))
+#elif defined(_MSC_VER)
+#define BENCH_NOINLINE __declspec(noinline)
+#else
+#define BENCH_NOINLINE
+#endif
+
+static BENCH_NOINLINE void* countedAlloc(std::size_t size) {
+    g_alloc_count.fetch_add(1, std::memory_order_relaxed);
+    g_alloc_bytes.fetch_add(static_cast<long long>(size), std::memory_order_relaxed);
+    void* p = std::malloc(size == 0 ? 1 : size);
+    if (!p) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+static BENCH_NOINLINE void countedFree(void* p) noexcept {
+    std::free(p);
+}
+
+void* operator new(std::size_t size) {
+    return countedAlloc(size);
+}
+
+void* operator new[](std::size_t size) {
+    return countedAlloc(size);
+}
+
+void operator delete(void* p) noexcept {
+    countedFree(p);
+}
+
+void operator delete[](void* p) noexcept {
+    countedFree(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    countedFree(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept {
+    countedFree(p);
+}
+
+namespace {
+
+using AirportStaffScheduler::Model::DayModel;
+
+/**
+ * @brief 单个调度器在一个规模下的测量结果
+ */
+struct BenchmarkResult {
+    std::string scheduler;     ///< 调度器名称
+    int task_count;            ///< 任务数
+    int staff_count;           ///< 人员数
+    double wall_ms;            ///< 耗时（毫秒）
+    long long allocations;     ///< 分配次数
+    long long alloc_bytes;     ///< 分配字节数
+    int satisfied_tasks;       ///< 满足的任务数（人数满足或已分配）
+    std::string note;          ///< 备注（违规数等）
+};
+
+/**
+ * @brief 计时和分配计数区间
+ */
+class Measure {
+public:
+    Measure()
+        : begin_(std::chrono::steady_clock::now())
+        , count_(g_alloc_count.load())
+        , bytes_(g_alloc_bytes.load())
+    {
+    }
+
+    void finish(BenchmarkResult& result) const {
+        result.wall_ms = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - begin_).count();
+        result.allocations = g_alloc_count.load() - count_;
+        result.alloc_bytes = g_alloc_bytes.load() - bytes_;
+    }
+
+private:
+    std::chrono::steady_clock::time_point begin_;
+    long long count_;
+    long long bytes_;
+};
+
+/**
+ * @brief 调度期间屏蔽调度器自身的调试输出
+ */
+class QuietScope {
+public:
+    QuietScope()
+        : out_(std::cout.rdbuf(sink_.rdbuf()))
+        , err_(std::cerr.rdbuf(sink_.rdbuf()))
+        , log_level_(AirportStaffScheduler::Logging::getMinLevel())
+    {
+        AirportStaffScheduler::Logging::setMinLevel(AirportStaffScheduler::Logging::LEVEL_OFF);
+    }
+
+    ~QuietScope() {
+        std::cout.rdbuf(out_);
+        std::cerr.rdbuf(err_);
+        AirportStaffScheduler::Logging::setMinLevel(log_level_);
+    }
+
+private:
+    std::ostringstream sink_;
+    std::streambuf* out_;
+    std::streambuf* err_;
+    AirportStaffScheduler::Logging::LogLevel log_level_;
+};
+
+// 辅助函数：装卸调度
+BenchmarkResult runLoad(DayModel& model, std::vector<zhuangxie_class::LoadTask>* scheduled = nullptr) {
+    using namespace zhuangxie_class;
+    BenchmarkResult result = BenchmarkResult();
+    result.scheduler = "LoadScheduler";
+
+    LoadModelView view(model);
+    std::vector<LoadTask> tasks;
+    std::vector<LoadEmployeeInfo> employees;
+    std::map<std::string, std::vector<std::string>> group_name_to_employees;
+    std::vector<vip_first_class::Shift> shifts;
+    view.buildTasks(tasks);
+    view.buildEmployees(employees, group_name_to_employees);
+    view.buildShifts(shifts);
+    view.buildConnectRules(ConnectRuleTable::getInstance());
+    LoadWorkRules work_rules;
+    view.buildWorkRules(work_rules);
+    std::vector<StaffShiftWindow> shift_windows;
+    view.buildShiftWindows(shift_windows);
+    result.task_count = static_cast<int>(tasks.size());
+    result.staff_count = static_cast<int>(employees.size());
+    CapacitySweep capacity_sweep;
+    capacity_sweep.analyze(tasks, group_name_to_employees, shift_windows);
+
+    {
+        QuietScope quiet;
+        Measure measure;
+        LoadScheduler scheduler;
+        scheduler.setWorkRules(work_rules);
+        scheduler.setShiftWindows(shift_windows);
+        scheduler.scheduleLoadTasks(employees, tasks, shifts, std::vector<LoadScheduler::ShiftBlockPeriod>(),
+                                    nullptr, &group_name_to_employees);
+        measure.finish(result);
+    }
+
+    int short_staffed = 0;
+    for (const auto& task : tasks) {
+        if (static_cast<int>(task.getAssignedEmployeeIds().size()) >= task.getRequiredCount()) {
+            result.satisfied_tasks++;
+        }
+        if (task.isShortStaffed()) {
+            short_staffed++;
+        }
+    }
+    result.note = "缺人任务 " + std::to_string(short_staffed) + "，预判紧张时段 " +
+                  std::to_string(capacity_sweep.getShortfalls().size());
+    if (scheduled) {
+        scheduled->swap(tasks);
+    }
+    return result;
+}
+
+/**
+ * @brief 方案差异：以装卸调度结果为旧方案，改时/换人/删除一部分任务作为新方案，计时对比
+ */
+BenchmarkResult runPlanDiff(const std::vector<zhuangxie_class::LoadTask>& tasks) {
+    using AirportStaffScheduler::Output::PlanDiff;
+    using AirportStaffScheduler::Output::PlanTable;
+    BenchmarkResult result = BenchmarkResult();
+    result.scheduler = "PlanDiff";
+
+    PlanDiff diff;
+    PlanTable before;
+    PlanTable after;
+    diff.addTasks(before, tasks);
+    for (size_t i = 0; i < tasks.size(); ++i) {
+        const auto& task = tasks[i];
+        const auto& staff = task.getAssignedEmployeeIds();
+        if (!task.isAssigned() || staff.empty() || i % 50 == 0) {
+            continue;
+        }
+        int64_t start = task.getActualStartTime() + (i % 10 == 0 ? 300 : 0);
+        for (size_t k = 0; k < staff.size(); ++k) {
+            // 每17个任务把员工换成相邻任务的员工
+            const std::string& staff_id = (i % 17 == 0 && i + 1 < tasks.size() &&
+                                           k < tasks[i + 1].getAssignedEmployeeIds().size())
+                                              ? tasks[i + 1].getAssignedEmployeeIds()[k]
+                                              : staff[k];
+            diff.addRow(after, task.getTaskId(), staff_id, start, start + task.getDuration());
+        }
+    }
+    result.task_count = static_cast<int>(before.size());
+
+    Measure measure;
+    size_t changes = diff.compare(before, after).size();
+    measure.finish(result);
+
+    result.satisfied_tasks = result.task_count;
+    std::ostringstream note;
+    note << "方案行 " << before.size() << "，变化 " << changes << "，每个变化 " << std::fixed
+         << std::setprecision(2) << (changes > 0 ? result.wall_ms * 1000.0 / changes : 0.0) << " us";
+    result.note = note.str();
+    return result;
+}
+
+/**
+ * @brief 派车：以装卸调度结果为输入，合成两种车型的车辆池（约每8个任务一辆车），计时派车
+ */
+BenchmarkResult runVehiclePool(const std::vector<zhuangxie_class::LoadTask>& scheduled) {
+    using namespace zhuangxie_class;
+    BenchmarkResult result = BenchmarkResult();
+    result.scheduler = "VehiclePool";
+
+    std::vector<LoadTask> tasks(scheduled);
+    for (size_t i = 0; i < tasks.size(); ++i) {
+        tasks[i].setRequiredVehicleType(i % 3 == 0 ? "升降平台车" : "行李牵引车");
+    }
+    std::vector<LoadVehicle> vehicles(tasks.size() / 8 + 2);
+    for (size_t i = 0; i < vehicles.size(); ++i) {
+        vehicles[i].plate = "V" + std::to_string(i + 1);
+        vehicles[i].vehicle_type = i % 3 == 0 ? "升降平台车" : "行李牵引车";
+    }
+    result.task_count = static_cast<int>(tasks.size());
+
+    VehiclePool pool;
+    pool.setVehicles(vehicles);
+    Measure measure;
+    VehicleSummary summary = pool.assignVehicles(tasks);
+    measure.finish(result);
+
+    result.satisfied_tasks = summary.assigned_tasks;
+    std::ostringstream note;
+    note << "车辆 " << vehicles.size() << "，用到 " << summary.used_vehicles << "，跟随小组 "
+         << summary.followed_tasks << "，无车 " << summary.missing_tasks;
+    result.note = note.str();
+    return result;
+}
+
+// 辅助函数：VIP/头等舱调度
+BenchmarkResult runVip(DayModel& model) {
+    using namespace vip_first_class;
+    BenchmarkResult result = BenchmarkResult();
+    result.scheduler = "TaskScheduler";
+
+    EmployeeManager::getInstance().clearAllEmployees();
+    VipModelView view(model);
+    view.registerEmployees();
+    std::vector<TaskDefinition> tasks;
+    std::vector<Shift> shifts;
+    view.buildTasks(tasks);
+    view.buildShifts(shifts);
+    result.task_count = static_cast<int>(tasks.size());
+    result.staff_count = static_cast<int>(EmployeeManager::getInstance().getEmployeeCount());
+
+    {
+        QuietScope quiet;
+        Measure measure;
+        TaskScheduler scheduler;
+        scheduler.scheduleTasks(tasks, shifts);
+        measure.finish(result);
+    }
+
+    // 调度后的任务列表包含生成的操作间任务
+    int generated = static_cast<int>(tasks.size()) - result.task_count;
+    result.task_count = static_cast<int>(tasks.size());
+    for (const auto& task : tasks) {
+        if (!task.getAssignedEmployeeIds().empty()) {
+            result.satisfied_tasks++;
+        }
+    }
+    result.note = "生成操作间任务 " + std::to_string(generated);
+    return result;
+}
+
+// 辅助函数：值机调度（从模型构造公共类）
+BenchmarkResult runCheckIn(const DayModel& model) {
+    using namespace AirportStaffScheduler;
+    BenchmarkResult result = BenchmarkResult();
+    result.scheduler = "CheckInSchedulingAlgorithm";
+    const auto& pool = model.strings;
+    const auto& t = model.tasks;
+    const auto& s = model.staff;
+
+    std::vector<Task> tasks;
+    tasks.reserve(t.size());
+    for (size_t row = 0; row < t.size(); ++row) {
+        DateTime start = DateTime(std::chrono::seconds(t.start_time[row]));
+        DateTime end = DateTime(std::chrono::seconds(t.start_time[row] + t.duration[row]));
+        Task task(pool.get(t.task_id[row]), "", pool.get(t.task_name[row]), start, end,
+                  static_cast<int>(t.duration[row] / 60), pool.get(t.in_out[row]),
+                  pool.get(t.flight_attribute[row]), true, false,
+                  DateTime(), DateTime(), DateTime(), DateTime());
+        task.setAircraftType(pool.get(t.body_type[row]));
+        const std::string& qual = pool.get(t.required_qualification[row]);
+        if (!qual.empty()) {
+            task.setRequiredQualifications(std::vector<std::string>(1, qual));
+        }
+        tasks.push_back(task);
+    }
+
+    std::vector<Staff> staff_list;
+    std::vector<Shift> shift_list;
+    for (size_t row = 0; row < s.size(); ++row) {
+        const std::string& staff_id = pool.get(s.staff_id[row]);
+        const std::string& qual = pool.get(s.qualification[row]);
+        staff_list.push_back(Staff(staff_id, pool.get(s.staff_name[row]), "男",
+                                   qual.empty() ? std::vector<std::string>() : std::vector<std::string>(1, qual)));
+        shift_list.push_back(Shift("S" + std::to_string(row), pool.get(s.shift_name[row]), staff_id,
+                                   DateTime(std::chrono::seconds(s.shift_start[row])),
+                                   DateTime(std::chrono::seconds(s.shift_end[row])),
+                                   "", s.allow_overtime[row] != 0, false));
+    }
+    result.task_count = static_cast<int>(tasks.size());
+    result.staff_count = static_cast<int>(staff_list.size());
+
+    CheckInSchedulingAlgorithm algorithm(tasks, staff_list, shift_list, std::vector<TemporaryTask>());
+    algorithm.setValidationRules(ValidationRules::fromRuleTable(model.rules, pool));
+    {
+        QuietScope quiet;
+        Measure measure;
+        algorithm.assignTasksToShift();
+        measure.finish(result);
+    }
+
+    for (const auto& task : algorithm.getTasks()) {
+        if (!task.getAssignedShiftId().empty()) {
+            result.satisfied_tasks++;
+        }
+    }
+    const ValidationReport& report = algorithm.getValidationReport();
+    result.note = "违规 " + std::to_string(report.violations.size()) + "（重叠 " +
+                  std::to_string(report.count(ViolationType::OVERLAP)) + "）";
+    return result;
+}
+
+// 辅助函数：打印一行结果
+void printResult(const BenchmarkResult& r) {
+    double quality = r.task_count > 0 ? 100.0 * r.satisfied_tasks / r.task_count : 0.0;
+    std::cout << std::left << std::setw(28) << r.scheduler << std::right
+              << std::setw(8) << r.task_count << std::setw(7) << r.staff_count
+              << std::setw(12) << std::fixed << std::setprecision(1) << r.wall_ms
+              << std::setw(12) << r.allocations
+              << std::setw(12) << std::setprecision(1) << r.alloc_bytes / (1024.0 * 1024.0)
+              << std::setw(9) << std::setprecision(1) << quality << "%  " << r.note << std::endl;
+}
+
+// 辅助函数：确保数据目录存在，逐级创建缺失的父目录
+bool ensureDirectory(const std::string& dir) {
+    for (size_t pos = 1; pos <= dir.size(); ++pos) {
+        if (pos < dir.size() && dir[pos] != '/' && dir[pos] != '\\') {
+            continue;
+        }
+        std::string path = dir.substr(0, pos);
+        struct stat info;
+        if (stat(path.c_str(), &info) == 0) {
+            if (!(info.st_mode & S_IFDIR)) {
+                return false;
+            }
+            continue;
+        }
+#ifdef _WIN32
+        if (_mkdir(path.c_str()) != 0) {
+#else
+        if (mkdir(path.c_str(), 0755) != 0) {
+#endif
+            return false;
+        }
+    }
+    return true;
+}
+
+// 辅助函数：约束校验自检（埋入一处重叠和一处路程不足，确认都被报告；打开重叠开关后重叠不再报告）
+bool checkPlantedViolations() {
+    using namespace AirportStaffScheduler;
+    auto at = [](int hour, int minute) { return DateTime(std::chrono::seconds(hour * 3600L + minute * 60L)); };
+    auto makeTask = [](const std::string& id, DateTime start, DateTime end) {
+        return Task(id, "", id, start, end,
+                    static_cast<int>(std::chrono::duration_cast<std::chrono::minutes>(end - start).count()),
+                    "", "", true, false, DateTime(), DateTime(), DateTime(), DateTime());
+    };
+    std::vector<Task> tasks;
+    tasks.push_back(makeTask("T1", at(9, 0), at(10, 0)));
+    tasks.push_back(makeTask("T2", at(9, 50), at(10, 30)));   // 与T1重叠10分钟
+    tasks.push_back(makeTask("T3", at(10, 35), at(11, 0)));   // T2→T3间隔5分钟，路程10分钟
+    std::vector<Staff> staff_list(1, Staff("E1", "E1", "男", std::vector<std::string>()));
+    std::vector<Shift> shift_list(1, Shift("S1", "S1", "E1", at(8, 0), at(16, 0), "", false, false));
+    std::vector<int> shift_to_staff(1, 0);
+    std::vector<std::vector<int>> shift_to_tasks(1, std::vector<int>{0, 1, 2});
+
+    Model::StringPool pool;
+    Model::RuleTable table;
+    table.parameters["是否允许任务重叠"] = "N";
+    table.parameters["任务间默认最大重叠时间"] = "15";
+    ValidationRules strict = ValidationRules::fromRuleTable(table, pool);
+    strict.travelSeconds["T2|T3"] = 10 * 60;
+    ValidationReport report = AssignmentValidator(tasks, staff_list, shift_list, std::vector<TemporaryTask>(), strict)
+                                  .validate(shift_to_staff, shift_to_tasks, 1);
+    if (report.count(ViolationType::OVERLAP) != 1 || report.count(ViolationType::TRAVEL_TIME) != 1) {
+        std::cerr << "ERROR: 约束校验自检失败，埋入的违规未被报告\n" << report.summary() << std::endl;
+        return false;
+    }
+
+    table.parameters["是否允许任务重叠"] = "Y";
+    ValidationRules relaxed = ValidationRules::fromRuleTable(table, pool);
+    report = AssignmentValidator(tasks, staff_list, shift_list, std::vector<TemporaryTask>(), relaxed)
+                 .validate(shift_to_staff, shift_to_tasks, 1);
+    if (report.count(ViolationType::OVERLAP) != 0) {
+        std::cerr << "ERROR: 约束校验自检失败，允许重叠时仍报告重叠\n" << report.summary() << std::endl;
+        return false;
+    }
+    return true;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    std::vector<int> sizes;
+    double budget_seconds = 60.0;
+    unsigned seed = 20251121;
+    std::string data_dir = "./";
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--budget" && i + 1 < argc) {
+            budget_seconds = std::atof(argv[++i]);
+        } else if (arg == "--seed" && i + 1 < argc) {
+            seed = static_cast<unsigned>(std::atol(argv[++i]));
+        } else if (arg == "--dir" && i + 1 < argc) {
+            data_dir = argv[++i];
+            if (data_dir.back() != '/' && data_dir.back() != '\\') {
+                data_dir += "/";
+            }
+        } else {
+            int size = std::atoi(arg.c_str());
+            if (size > 0) {
+                sizes.push_back(size);
+            }
+        }
+    }
+    if (sizes.empty()) {
+        sizes = {100, 500, 1000, 5000, 10000, 50000};
+    }
+    if (!checkPlantedViolations()) {
+        return 1;
+    }
+    if (!ensureDirectory(data_dir)) {
+        std::cerr << "ERROR: 数据目录不存在且无法创建: " << data_dir << std::endl;
+        return 1;
+    }
+
+    std::vector<BenchmarkResult> results;
+    bool run_load = true;
+    bool run_vip = true;
+    bool run_checkin = true;
+
+    std::cout << std::left << std::setw(28) << "scheduler" << std::right << std::setw(8) << "tasks"
+              << std::setw(7) << "staff" << std::setw(12) << "wall_ms" << std::setw(12) << "allocs"
+              << std::setw(12) << "alloc_MB" << std::setw(10) << "quality" << "  note" << std::endl;
+
+    for (int size : sizes) {
+        // 1. 生成并加载合成航班日（小组数随任务量增长，约每组每天15个任务）
+        AirportStaffScheduler::Synthetic::SyntheticDayOptions options;
+        options.task_count = size;
+        options.group_count = std::max(8, size / 15);
+        options.seed = seed;
+        AirportStaffScheduler::Model::DayModelFiles files;
+        std::string prefix = "bench_" + std::to_string(size) + "_";
+        if (!AirportStaffScheduler::Synthetic::writeSyntheticDay(data_dir, prefix, options, files)) {
+            std::cerr << "ERROR: 无法写入合成数据: " << data_dir << prefix << "*.csv" << std::endl;
+            return 1;
+        }
+
+        DayModel model;
+        BenchmarkResult load_result = BenchmarkResult();
+        load_result.scheduler = "loadDayModel";
+        Measure load_measure;
+        if (!AirportStaffScheduler::Model::loadDayModel(data_dir, model, files)) {
+            std::cerr << "ERROR: 无法加载合成数据: " << data_dir << prefix << "*.csv" << std::endl;
+            return 1;
+        }
+        load_measure.finish(load_result);
+        load_result.task_count = static_cast<int>(model.tasks.size());
+        load_result.staff_count = static_cast<int>(model.staff.size());
+        load_result.satisfied_tasks = load_result.task_count;
+        load_result.note = "CSV读取";
+        printResult(load_result);
+        results.push_back(load_result);
+
+        // 同一天的二进制快照：写一次，再计时重新映射加载
+        std::vector<AirportStaffScheduler::Model::SourceStamp> stamps =
+            AirportStaffScheduler::Model::stampDayModelFiles(data_dir, files);
+        std::string snapshot_path = data_dir + files.snapshot_file;
+        if (AirportStaffScheduler::Model::saveDayModelSnapshot(model, snapshot_path, stamps)) {
+            BenchmarkResult snapshot_result = BenchmarkResult();
+            snapshot_result.scheduler = "loadDayModelSnapshot";
+            Measure snapshot_measure;
+            bool snapshot_loaded = AirportStaffScheduler::Model::loadDayModelSnapshot(snapshot_path, stamps, model);
+            snapshot_measure.finish(snapshot_result);
+            if (!snapshot_loaded && !AirportStaffScheduler::Model::loadDayModel(data_dir, model, files)) {
+                std::cerr << "ERROR: 无法加载合成数据: " << data_dir << prefix << "*.csv" << std::endl;
+                return 1;
+            }
+            snapshot_result.task_count = static_cast<int>(model.tasks.size());
+            snapshot_result.staff_count = static_cast<int>(model.staff.size());
+            snapshot_result.satisfied_tasks = snapshot_loaded ? snapshot_result.task_count : 0;
+            snapshot_result.note = snapshot_loaded ? "快照映射" : "快照无效";
+            printResult(snapshot_result);
+            results.push_back(snapshot_result);
+        }
+
+        // 2. 各调度器计时（超出预算后更大规模跳过）
+        if (run_load) {
+            model.clearAssignments();
+            std::vector<zhuangxie_class::LoadTask> scheduled;
+            results.push_back(runLoad(model, &scheduled));
+            printResult(results.back());
+            run_load = results.back().wall_ms < budget_seconds * 1000.0;
+            results.push_back(runPlanDiff(scheduled));
+            printResult(results.back());
+            results.push_back(runVehiclePool(scheduled));
+            printResult(results.back());
+        }
+        if (run_vip) {
+            results.push_back(runVip(model));
+            printResult(results.back());
+            run_vip = results.back().wall_ms < budget_seconds * 1000.0;
+        }
+        if (run_checkin) {
+            results.push_back(runCheckIn(model));
+            printResult(results.back());
+            run_checkin = results.back().wall_ms < budget_seconds * 1000.0;
+        }
+    }
+
+    std::ofstream csv(data_dir + "benchmark_result.csv");
+    csv << "调度器,任务数,人员数,耗时ms,分配次数,分配字节,满足任务数,备注\n";
+    for (const auto& r : results) {
+        csv << r.scheduler << "," << r.task_count << "," << r.staff_count << "," << std::fixed
+            << std::setprecision(3) << r.wall_ms << "," << r.allocations << "," << r.alloc_bytes << ","
+            << r.satisfied_tasks << "," << r.note << "\n";
+    }
+    std::cout << "结果已写入 " << data_dir << "benchmark_result.csv" << std::endl;
+    return 0;
+}
@@ -22,29 +22,23 @@ EmployeeInfo::~EmployeeInfo()
 
 void EmployeeInfo::addAssignedTaskId(const string& task_id)
 {
+    int key = AirportStaffScheduler::Ids::IdRegistry::intern(task_id);
     // 检查是否已存在
-    for (const string& id : assigned_task_ids_) {
-        if (id == task_id) {
-            return;  // 已经存在，不重复添加
-        }
+    if (assigned_task_ids_.contains(key)) {
+        return;  // 已经存在，不重复添加
     }
-    assigned_task_ids_.push_back(task_id);
+    assigned_task_ids_.push_back(key);
 }
 
 bool EmployeeInfo::removeAssignedTaskId(const string& task_id)
 {
-    auto it = std::find(assigned_task_ids_.begin(), assigned_task_ids_.end(), task_id);
-    if (it != assigned_task_ids_.end()) {
-        assigned_task_ids_.erase(it);
-        return true;
-    }
-    return false;
+    int key = AirportStaffScheduler::Ids::IdRegistry::find(task_id);
+    return key >= 0 && assigned_task_ids_.remove(key);
 }
 
 bool EmployeeInfo::isAssignedToTask(const string& task_id) const
 {
-    return std::find(assigned_task_ids_.begin(), assigned_task_ids_.end(), task_id) 
-           != assigned_task_ids_.end();
+    return assigned_task_ids_.containsName(task_id);
 }
 
 }  // namespace vip_first_class
@@ -8,6 +8,7 @@
 #ifndef VIP_FIRST_CLASS_EMPLOYEE_INFO_H
 #define VIP_FIRST_CLASS_EMPLOYEE_INFO_H
 
+#include "../InternedIds.h"
 #include <string>
 #include <vector>
 #include <map>
@@ -195,15 +196,14 @@ public:
     
     /**
      * @brief 获取分配的任务ID列表
-     * @return 任务ID列表的常量引用（字符串类型）
+     * @return 任务ID列表的只读视图（字符串类型，按分配顺序；修改分配后失效）
      */
-    const vector<string>& getAssignedTaskIds() const { return assigned_task_ids_; }
+    AirportStaffScheduler::Ids::IdNames getAssignedTaskIds() const { return assigned_task_ids_.names(); }
     
     /**
-     * @brief 获取分配的任务ID列表（非常量版本）
-     * @return 任务ID列表的引用（字符串类型）
+     * @brief 获取分配的任务编号列表（IdRegistry编号）
      */
-    vector<string>& getAssignedTaskIds() { return assigned_task_ids_; }
+    const AirportStaffScheduler::Ids::SmallIdList<8>& getAssignedTaskKeys() const { return assigned_task_ids_; }
     
     /**
      * @brief 添加分配的任务ID
@@ -225,6 +225,13 @@ public:
      */
     bool isAssignedToTask(const string& task_id) const;
     
+    /**
+     * @brief 检查是否已分配指定任务（按IdRegistry编号，先查掩码）
+     * @param task_key 任务编号
+     * @return true表示已分配，false表示未分配
+     */
+    bool isAssignedToTask(int task_key) const { return assigned_task_ids_.contains(task_key); }
+    
     /**
      * @brief 获取分配的任务数量
      * @return 分配的任务数量
@@ -245,7 +252,7 @@ private:
     long total_work_time_;                                 ///< 累计工作时长（秒）
     map<string, int> shift_type_counts_;       ///< 班次类型次数统计（键为"主班1"、"主班2"、"副班1"等）
     map<string, int> hall_task_counts_;        ///< 厅房任务次数统计（键为厅房名称）
-    vector<string> assigned_task_ids_;                 ///< 分配的任务ID列表（字符串类型）
+    AirportStaffScheduler::Ids::SmallIdList<8> assigned_task_ids_;  ///< 分配的任务编号列表（前8个不分配堆内存）
 };
 
 }  // namespace vip_first_class
@@ -4,12 +4,18 @@
  */
 
 #include "employee_manager.h"
+#include "scheduling_context.h"
 #include <algorithm>
 
 namespace vip_first_class {
 
 EmployeeManager& EmployeeManager::getInstance()
 {
+    // 多日窗口并行调度的工作线程使用绑定的上下文中的副本
+    SchedulingContext* context = SchedulingContext::current();
+    if (context != nullptr) {
+        return context->employees();
+    }
     static EmployeeManager instance;
     return instance;
 }
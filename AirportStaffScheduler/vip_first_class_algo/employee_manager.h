@@ -92,6 +92,8 @@ public:
     }
 
 private:
+    friend class SchedulingContext;
+    
     /**
      * @brief 私有构造函数（单例模式）
      */
@@ -103,9 +105,9 @@ private:
     ~EmployeeManager();
     
     /**
-     * @brief 禁止拷贝构造
+     * @brief 拷贝构造（只供SchedulingContext复制调度状态）
      */
-    EmployeeManager(const EmployeeManager&) = delete;
+    EmployeeManager(const EmployeeManager&) = default;
     
     /**
      * @brief 禁止赋值操作
@@ -0,0 +1,350 @@
+/**
+ * @file rolling_horizon_scheduler.cpp
+ * @brief 多日滚动调度实现
+ */
+
+#include "rolling_horizon_scheduler.h"
+#include "task_scheduler.h"
+#include "task_config.h"
+#include "employee_manager.h"
+#include "scheduling_context.h"
+#include "task_type.h"
+#include "../Logger.h"
+#include <future>
+#include <memory>
+
+namespace vip_first_class {
+
+using namespace std;
+
+void FairnessState::add(const FairnessState& delta)
+{
+    for (const auto& pair : delta.total_work_time) {
+        total_work_time[pair.first] += pair.second;
+    }
+    for (const auto& pair : delta.shift_type_counts) {
+        for (const auto& count : pair.second) {
+            shift_type_counts[pair.first][count.first] += count.second;
+        }
+    }
+    for (const auto& pair : delta.hall_task_counts) {
+        for (const auto& count : pair.second) {
+            hall_task_counts[pair.first][count.first] += count.second;
+        }
+    }
+    for (const auto& pair : delta.first_shift_counts) {
+        first_shift_counts[pair.first] += pair.second;
+    }
+}
+
+RollingHorizonScheduler::RollingHorizonScheduler()
+    : loader_()
+    , carried_state_()
+    , has_initial_state_(false)
+{
+}
+
+RollingHorizonScheduler::~RollingHorizonScheduler()
+{
+}
+
+void RollingHorizonScheduler::setInitialState(const FairnessState& state)
+{
+    carried_state_ = state;
+    has_initial_state_ = true;
+}
+
+FairnessState RollingHorizonScheduler::captureFairnessState()
+{
+    FairnessState state;
+    for (const auto& pair : EmployeeManager::getInstance().getAllEmployees()) {
+        const EmployeeInfo& emp = pair.second;
+        state.total_work_time[pair.first] = emp.getTotalWorkTime();
+        if (!emp.getShiftTypeCounts().empty()) {
+            state.shift_type_counts[pair.first] = emp.getShiftTypeCounts();
+        }
+        if (!emp.getHallTaskCounts().empty()) {
+            state.hall_task_counts[pair.first] = emp.getHallTaskCounts();
+        }
+    }
+    state.first_shift_counts = TaskScheduler::getFirstShiftCounts();
+    return state;
+}
+
+void RollingHorizonScheduler::restoreFairnessState(const FairnessState& state)
+{
+    EmployeeManager& emp_manager = EmployeeManager::getInstance();
+    for (const auto& employee_id : emp_manager.getAllEmployeeIds()) {
+        EmployeeInfo* emp = emp_manager.getEmployee(employee_id);
+        emp->resetStatistics();
+
+        auto work_it = state.total_work_time.find(employee_id);
+        if (work_it != state.total_work_time.end()) {
+            emp->setTotalWorkTime(work_it->second);
+        }
+        auto shift_it = state.shift_type_counts.find(employee_id);
+        if (shift_it != state.shift_type_counts.end()) {
+            emp->getShiftTypeCounts() = shift_it->second;
+        }
+        auto hall_it = state.hall_task_counts.find(employee_id);
+        if (hall_it != state.hall_task_counts.end()) {
+            emp->getHallTaskCounts() = hall_it->second;
+        }
+    }
+    TaskScheduler::setFirstShiftCounts(state.first_shift_counts);
+}
+
+// 辅助函数：厅房任务对应的统计名称，非厅房任务返回空字符串
+static string hallNameOf(TaskType type)
+{
+    switch (hallKindOf(type)) {
+        case HallKind::INTERNATIONAL: return "国际厅内";
+        case HallKind::DOMESTIC: return "国内厅内";
+        default: return "";
+    }
+}
+
+// 辅助函数：把员工注册到当前线程可见的EmployeeManager（已存在的员工保留其统计）
+static void registerEmployees(const vector<EmployeeInfo>& employees)
+{
+    EmployeeManager& emp_manager = EmployeeManager::getInstance();
+    for (const auto& emp : employees) {
+        EmployeeInfo* existing = emp_manager.getEmployee(emp.getEmployeeId());
+        if (existing) {
+            existing->setEmployeeName(emp.getEmployeeName());
+            existing->setQualificationMask(emp.getQualificationMask());
+        } else {
+            emp_manager.addOrUpdateEmployee(emp.getEmployeeId(), emp);
+        }
+    }
+}
+
+void RollingHorizonScheduler::solveDay(const DayInput& input, const FairnessState& state_before,
+                                       DayResult& result)
+{
+    result.day = input.day;
+    result.input = input;
+    result.tasks = input.tasks;
+
+    // 1. 注册当天的员工（已存在的员工保留其统计），清空前一天的任务分配
+    registerEmployees(input.employees);
+    EmployeeManager& emp_manager = EmployeeManager::getInstance();
+    for (const auto& employee_id : emp_manager.getAllEmployeeIds()) {
+        emp_manager.getEmployee(employee_id)->clearAssignedTasks();
+    }
+
+    // 2. 带入前一天的统计
+    restoreFairnessState(state_before);
+
+    // 3. 调度
+    TaskScheduler scheduler;
+    scheduler.scheduleTasks(result.tasks, input.shifts);
+    result.scheduled = true;
+    result.hall_fixed_persons = TaskConfig::getInstance().getHallMaintenanceFixedPersons();
+    result.first_group_leads = TaskScheduler::isFirstHallGroupLeading(result.hall_fixed_persons,
+                                                                      state_before.first_shift_counts);
+
+    // 4. 计算当天的统计增量
+    FairnessState& delta = result.delta;
+    delta = FairnessState();
+    for (const auto& pair : TaskScheduler::getFirstShiftCounts()) {
+        auto it = state_before.first_shift_counts.find(pair.first);
+        int before = (it != state_before.first_shift_counts.end()) ? it->second : 0;
+        if (pair.second != before) {
+            delta.first_shift_counts[pair.first] = pair.second - before;
+        }
+    }
+    for (const auto& task : result.tasks) {
+        long work_time = (task.getEndTime() > task.getStartTime())
+                             ? task.getEndTime() - task.getStartTime()
+                             : task.getDuration();
+        string hall_name = hallNameOf(task.getTaskType());
+        for (const auto& employee_id : task.getAssignedEmployeeIds()) {
+            delta.total_work_time[employee_id] += work_time;
+            if (!hall_name.empty()) {
+                delta.hall_task_counts[employee_id][hall_name] += 1;
+            }
+        }
+    }
+    for (const auto& shift : input.shifts) {
+        string prefix;
+        if (shift.getShiftType() == static_cast<int>(ShiftType::MAIN)) {
+            prefix = "主班";
+        } else if (shift.getShiftType() == static_cast<int>(ShiftType::SUB)) {
+            prefix = "副班";
+        } else {
+            continue;
+        }
+        for (const auto& pos_pair : shift.getPositionToEmployeeId()) {
+            delta.shift_type_counts[pos_pair.second][prefix + to_string(pos_pair.first)] += 1;
+        }
+    }
+
+    // 5. 把当天结果提交到当前线程的调度状态
+    FairnessState state_after = state_before;
+    state_after.add(delta);
+    restoreFairnessState(state_after);
+}
+
+// 辅助函数：加载一天的输入（可在后台线程运行，context为发起预读的线程绑定的上下文）
+static bool loadDayInput(SchedulingContext* context, const DayLoader& loader, const string& day, DayInput& input)
+{
+    SchedulingContext::Scope scope(context);
+    input = DayInput();
+    input.day = day;
+    if (!loader) {
+        return false;
+    }
+    try {
+        return loader(day, input);
+    } catch (const exception& e) {
+        LOG_WARN("警告：加载 " << day << " 的输入失败: " << e.what());
+        return false;
+    }
+}
+
+vector<DayResult> RollingHorizonScheduler::runSequence(const DayLoader& loader, const vector<string>& days,
+                                                       size_t begin, size_t end,
+                                                       const FairnessState& initial_state)
+{
+    vector<DayResult> results;
+    if (begin >= end) {
+        return results;
+    }
+    results.reserve(end - begin);
+
+    FairnessState state = initial_state;
+    SchedulingContext* context = SchedulingContext::current();
+    DayInput next_input;
+    future<bool> prefetch = async(launch::async, loadDayInput, context, cref(loader), cref(days[begin]),
+                                  ref(next_input));
+
+    for (size_t i = begin; i < end; ++i) {
+        bool loaded = prefetch.get();
+        DayInput input = std::move(next_input);
+
+        // 第D天调度期间，后台预读第D+1天的输入
+        if (i + 1 < end) {
+            next_input = DayInput();
+            prefetch = async(launch::async, loadDayInput, context, cref(loader), cref(days[i + 1]),
+                             ref(next_input));
+        }
+
+        DayResult result;
+        result.day = days[i];
+        result.scheduled = false;
+        result.first_group_leads = true;
+        if (loaded) {
+            solveDay(input, state, result);
+            state.add(result.delta);
+        } else {
+            LOG_WARN("警告：" << days[i] << " 的输入加载失败，跳过当天调度");
+            result.input = std::move(input);
+        }
+        results.push_back(std::move(result));
+    }
+    return results;
+}
+
+vector<DayResult> RollingHorizonScheduler::run(const vector<string>& days)
+{
+    if (!has_initial_state_) {
+        carried_state_ = captureFairnessState();
+    }
+
+    vector<DayResult> results = runSequence(loader_, days, 0, days.size(), carried_state_);
+    for (const auto& result : results) {
+        carried_state_.add(result.delta);
+        LOG_INFO("滚动调度：" << result.day << (result.scheduled ? " 调度完成" : " 未调度"));
+    }
+    has_initial_state_ = true;
+    return results;
+}
+
+vector<DayResult> RollingHorizonScheduler::runWindow(SchedulingContext* context, const DayLoader& loader,
+                                                     const vector<string>& days, size_t begin, size_t end,
+                                                     const FairnessState& initial_state)
+{
+    SchedulingContext::Scope scope(context);
+    return runSequence(loader, days, begin, end, initial_state);
+}
+
+vector<DayResult> RollingHorizonScheduler::runWindows(const vector<string>& days, size_t window_days,
+                                                      size_t max_parallel)
+{
+    if (!has_initial_state_) {
+        carried_state_ = captureFairnessState();
+    }
+    if (window_days == 0) {
+        window_days = days.size();
+    }
+    if (max_parallel == 0) {
+        max_parallel = 1;
+    }
+
+    // 1. 切分窗口，分批并行调度（每个窗口都从初始统计开始）
+    vector<pair<size_t, size_t>> windows;
+    for (size_t begin = 0; begin < days.size(); begin += window_days) {
+        windows.push_back(make_pair(begin, min(begin + window_days, days.size())));
+    }
+
+    // 每个窗口使用调用线程调度状态（员工信息、任务配置、第一次值守次数）的一份副本
+    SchedulingContext base(EmployeeManager::getInstance(), TaskConfig::getInstance(),
+                           TaskScheduler::getFirstShiftCounts());
+    vector<unique_ptr<SchedulingContext>> contexts;
+    for (size_t w = 0; w < windows.size(); ++w) {
+        contexts.push_back(unique_ptr<SchedulingContext>(new SchedulingContext(base)));
+    }
+
+    vector<vector<DayResult>> window_results(windows.size());
+    for (size_t batch = 0; batch < windows.size(); batch += max_parallel) {
+        vector<future<vector<DayResult>>> futures;
+        size_t batch_end = min(batch + max_parallel, windows.size());
+        for (size_t w = batch; w < batch_end; ++w) {
+            futures.push_back(async(launch::async, runWindow, contexts[w].get(), cref(loader_), cref(days),
+                                    windows[w].first, windows[w].second, cref(carried_state_)));
+        }
+        for (size_t w = batch; w < batch_end; ++w) {
+            window_results[w] = futures[w - batch].get();
+        }
+    }
+
+    // 2. 边界校正：按实际带入的统计逐日检查。当天的调度结果只取决于输入和
+    //    厅内保障任务的值守顺序，顺序一致时直接采用窗口结果，否则在当前线程重排
+    vector<DayResult> results;
+    results.reserve(days.size());
+    FairnessState actual = carried_state_;
+    size_t resolved_days = 0;
+    for (size_t w = 0; w < window_results.size(); ++w) {
+        for (auto& result : window_results[w]) {
+            if (result.scheduled && w > 0) {
+                bool actual_leads = TaskScheduler::isFirstHallGroupLeading(result.hall_fixed_persons,
+                                                                           actual.first_shift_counts);
+                if (actual_leads != result.first_group_leads) {
+                    DayResult resolved;
+                    resolved.scheduled = false;
+                    resolved.first_group_leads = true;
+                    solveDay(result.input, actual, resolved);
+                    result = std::move(resolved);
+                    resolved_days++;
+                }
+            }
+            actual.add(result.delta);
+            results.push_back(std::move(result));
+        }
+    }
+
+    LOG_INFO("窗口并行调度完成：共 " << days.size() << " 天，" << windows.size() << " 个窗口，边界校正重排 "
+             << resolved_days << " 天");
+
+    // 3. 窗口内注册的员工只在窗口副本中，带出统计前先注册到调用线程
+    for (const auto& result : results) {
+        registerEmployees(result.input.employees);
+    }
+    carried_state_ = actual;
+    has_initial_state_ = true;
+    restoreFairnessState(carried_state_);
+    return results;
+}
+
+}  // namespace vip_first_class
@@ -0,0 +1,171 @@
+/**
+ * @file rolling_horizon_scheduler.h
+ * @brief 多日滚动调度
+ *
+ * 逐日调用TaskScheduler：调度第D天并提交后，把公平性统计（累计工时、班次类型次数、
+ * 厅房任务次数、第一次值守次数）带入第D+1天；调度第D天的同时在后台线程预读第D+1天的输入。
+ * 另提供按窗口并行重排多日（如30天）排班的批量模式，窗口边界处按实际带入的统计进行校正。
+ */
+
+#ifndef VIP_FIRST_CLASS_ROLLING_HORIZON_SCHEDULER_H
+#define VIP_FIRST_CLASS_ROLLING_HORIZON_SCHEDULER_H
+
+#include "task_definition.h"
+#include "shift.h"
+#include "employee_info.h"
+#include <vector>
+#include <string>
+#include <map>
+#include <functional>
+
+namespace vip_first_class {
+
+using namespace std;
+
+class SchedulingContext;
+
+/**
+ * @brief 跨天带入的公平性统计
+ *
+ * 既可以表示某一时刻的累计值，也可以表示某一天产生的增量
+ */
+struct FairnessState {
+    map<string, long> total_work_time;                  ///< 员工ID -> 累计工作时长（秒）
+    map<string, map<string, int>> shift_type_counts;     ///< 员工ID -> 班次类型次数（"主班1"等）
+    map<string, map<string, int>> hall_task_counts;      ///< 员工ID -> 厅房任务次数（"国内厅内"等）
+    map<string, int> first_shift_counts;                 ///< 员工ID -> 第一次值守次数
+
+    /**
+     * @brief 累加另一份统计（通常是某一天的增量）
+     */
+    void add(const FairnessState& delta);
+};
+
+/**
+ * @brief 一天的调度输入
+ */
+struct DayInput {
+    string day;                          ///< 日期标识（如"2025-11-21"）
+    vector<TaskDefinition> tasks;        ///< 任务列表（任务类型已设置）
+    vector<Shift> shifts;                ///< 班次列表
+    vector<EmployeeInfo> employees;      ///< 当天上班的员工（未注册的员工会在调度前注册）
+};
+
+/**
+ * @brief 一天的调度结果
+ */
+struct DayResult {
+    string day;                          ///< 日期标识
+    bool scheduled;                      ///< 是否完成调度（输入加载失败时为false）
+    DayInput input;                      ///< 调度前的输入（用于窗口边界校正时重排）
+    vector<TaskDefinition> tasks;        ///< 调度后的任务列表（含生成的操作间任务）
+    vector<string> hall_fixed_persons;   ///< 当天厅内保障任务固定人选
+    bool first_group_leads;              ///< 当天厅内保障任务是否第一组先值守
+    FairnessState delta;                 ///< 当天产生的公平性统计增量
+};
+
+/**
+ * @brief 日输入加载函数：根据日期标识填充输入，成功返回true
+ *
+ * 会在后台线程中调用，只能读取文件和解析数据，不能访问EmployeeManager等调度状态
+ */
+typedef function<bool(const string& day, DayInput& input)> DayLoader;
+
+/**
+ * @brief 多日滚动调度类
+ */
+class RollingHorizonScheduler {
+public:
+    /**
+     * @brief 构造函数
+     */
+    RollingHorizonScheduler();
+
+    /**
+     * @brief 析构函数
+     */
+    ~RollingHorizonScheduler();
+
+    /**
+     * @brief 设置日输入加载函数
+     */
+    void setDayLoader(const DayLoader& loader) { loader_ = loader; }
+
+    /**
+     * @brief 设置第一天之前已有的公平性统计（不设置时从当前线程的调度状态读取）
+     */
+    void setInitialState(const FairnessState& state);
+
+    /**
+     * @brief 获取最后一天调度后带出的公平性统计
+     */
+    const FairnessState& getCarriedState() const { return carried_state_; }
+
+    /**
+     * @brief 逐日滚动调度（在当前线程调度，后台线程预读下一天输入）
+     * @param days 日期标识列表（按时间顺序）
+     * @return 每天的调度结果
+     */
+    vector<DayResult> run(const vector<string>& days);
+
+    /**
+     * @brief 按窗口并行重排多日排班
+     *
+     * 每个窗口在独立线程中从初始统计开始逐日调度（工作线程绑定一份SchedulingContext，
+     * 即调用线程的EmployeeManager、TaskConfig和第一次值守次数的副本）；全部窗口完成后在当前线程
+     * 按实际带入的统计逐日校正：厅内保障任务的值守顺序与窗口内假设一致的天直接采用，
+     * 不一致的天按实际统计重新调度
+     * @param days 日期标识列表（按时间顺序）
+     * @param window_days 每个窗口的天数
+     * @param max_parallel 同时运行的窗口数上限
+     * @return 每天的调度结果
+     */
+    vector<DayResult> runWindows(const vector<string>& days, size_t window_days, size_t max_parallel);
+
+    /**
+     * @brief 读取当前线程调度状态中的公平性统计
+     */
+    static FairnessState captureFairnessState();
+
+    /**
+     * @brief 把公平性统计写入当前线程的调度状态
+     */
+    static void restoreFairnessState(const FairnessState& state);
+
+private:
+    /**
+     * @brief 在当前线程调度连续若干天（后台预读下一天输入）
+     * @param loader 日输入加载函数
+     * @param days 日期标识列表
+     * @param begin 起始下标
+     * @param end 结束下标（不含）
+     * @param initial_state 起始统计
+     * @return 每天的调度结果
+     */
+    static vector<DayResult> runSequence(const DayLoader& loader, const vector<string>& days,
+                                         size_t begin, size_t end, const FairnessState& initial_state);
+
+    /**
+     * @brief 在工作线程中绑定窗口的调度状态上下文后调用runSequence
+     * @param context 窗口的调度状态上下文
+     */
+    static vector<DayResult> runWindow(SchedulingContext* context, const DayLoader& loader,
+                                       const vector<string>& days, size_t begin, size_t end,
+                                       const FairnessState& initial_state);
+
+    /**
+     * @brief 在当前线程调度一天
+     * @param input 调度输入
+     * @param state_before 当天开始时的统计
+     * @param result 输出参数，调度结果
+     */
+    static void solveDay(const DayInput& input, const FairnessState& state_before, DayResult& result);
+
+    DayLoader loader_;                   ///< 日输入加载函数
+    FairnessState carried_state_;        ///< 带入/带出的公平性统计
+    bool has_initial_state_;             ///< 是否设置了初始统计
+};
+
+}  // namespace vip_first_class
+
+#endif  // VIP_FIRST_CLASS_ROLLING_HORIZON_SCHEDULER_H
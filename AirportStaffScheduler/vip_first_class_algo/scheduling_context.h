@@ -0,0 +1,81 @@
+/**
+ * @file scheduling_context.h
+ * @brief 调度状态上下文（多日窗口并行调度时，工作线程使用的调度状态副本）
+ *
+ * EmployeeManager、TaskConfig和第一次值守次数是进程内唯一的单例。窗口并行调度时，
+ * 调用线程先把这三份状态复制成一个SchedulingContext，每个窗口再复制一份并在工作线程中
+ * 绑定（SchedulingContext::Scope）；绑定期间该线程的getInstance()和第一次值守次数
+ * 读写的都是上下文中的副本，调用线程上的配置修改（setTaskPriority、addFixedPersonByType等）
+ * 随副本带入工作线程，工作线程的调度也不会改动进程内的单例。未绑定的线程仍使用单例。
+ */
+
+#ifndef VIP_FIRST_CLASS_SCHEDULING_CONTEXT_H
+#define VIP_FIRST_CLASS_SCHEDULING_CONTEXT_H
+
+#include "employee_manager.h"
+#include "task_config.h"
+#include <map>
+#include <string>
+
+namespace vip_first_class {
+
+using namespace std;
+
+/**
+ * @brief 调度状态上下文
+ */
+class SchedulingContext {
+public:
+    /**
+     * @brief 构造函数（复制给定的调度状态）
+     * @param employees 员工信息
+     * @param config 任务配置
+     * @param first_shift_counts 员工ID到第一次值守次数的映射
+     */
+    SchedulingContext(const EmployeeManager& employees, const TaskConfig& config,
+                      const map<string, int>& first_shift_counts)
+        : employees_(employees), config_(config), first_shift_counts_(first_shift_counts) {}
+
+    SchedulingContext(const SchedulingContext& other)
+        : employees_(other.employees_), config_(other.config_), first_shift_counts_(other.first_shift_counts_) {}
+
+    SchedulingContext& operator=(const SchedulingContext&) = delete;
+
+    EmployeeManager& employees() { return employees_; }
+    TaskConfig& config() { return config_; }
+    map<string, int>& firstShiftCounts() { return first_shift_counts_; }
+
+    /**
+     * @brief 当前线程绑定的上下文（未绑定返回nullptr）
+     */
+    static SchedulingContext* current() { return slot(); }
+
+    /**
+     * @brief 在作用域内把上下文绑定到当前线程（析构时恢复之前的绑定）
+     */
+    class Scope {
+    public:
+        explicit Scope(SchedulingContext* context) : previous_(slot()) { slot() = context; }
+        ~Scope() { slot() = previous_; }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        SchedulingContext* previous_;
+    };
+
+private:
+    static SchedulingContext*& slot() {
+        static thread_local SchedulingContext* context = nullptr;
+        return context;
+    }
+
+    EmployeeManager employees_;              ///< 员工信息副本
+    TaskConfig config_;                      ///< 任务配置副本
+    map<string, int> first_shift_counts_;    ///< 第一次值守次数副本
+};
+
+}  // namespace vip_first_class
+
+#endif  // VIP_FIRST_CLASS_SCHEDULING_CONTEXT_H
@@ -0,0 +1,94 @@
+/**
+ * @file task_arena.cpp
+ * @brief 调度过程中生成任务的存储区实现
+ */
+
+#include "task_arena.h"
+#include <functional>
+
+namespace vip_first_class {
+
+using namespace std;
+
+const size_t TaskArena::CHUNK_SIZE;
+
+TaskArena::TaskArena()
+    : chunks_()
+    , size_(0)
+    , index_()
+{
+}
+
+TaskArena::~TaskArena()
+{
+}
+
+size_t TaskArena::SlotKeyHash::operator()(const SlotKey& key) const
+{
+    size_t h = hash<long>()(key.start_time);
+    h = h * 31 + hash<long>()(key.end_time);
+    h = h * 31 + hash<int>()(key.type);
+    return h;
+}
+
+TaskDefinition* TaskArena::find(TaskType type, long start_time, long end_time) const
+{
+    SlotKey key = {static_cast<int>(type), start_time, end_time};
+    auto it = index_.find(key);
+    return it == index_.end() ? nullptr : it->second;
+}
+
+TaskDefinition* TaskArena::findOrCreate(TaskType type, long start_time, long end_time, bool* created)
+{
+    SlotKey key = {static_cast<int>(type), start_time, end_time};
+    auto it = index_.find(key);
+    if (it != index_.end()) {
+        if (created) {
+            *created = false;
+        }
+        return it->second;
+    }
+    
+    // 当前块已满时新开一块；块内容量固定，不会重新分配，已有任务地址不变
+    if (chunks_.empty() || chunks_.back().size() == CHUNK_SIZE) {
+        chunks_.push_back(vector<TaskDefinition>());
+        chunks_.back().reserve(CHUNK_SIZE);
+    }
+    chunks_.back().emplace_back();
+    TaskDefinition* task = &chunks_.back().back();
+    size_++;
+    
+    task->setTaskType(type);
+    task->setStartTime(start_time);
+    task->setEndTime(end_time);
+    index_[key] = task;
+    
+    if (created) {
+        *created = true;
+    }
+    return task;
+}
+
+void TaskArena::indexTask(TaskDefinition& task)
+{
+    SlotKey key = {static_cast<int>(task.getTaskType()), task.getStartTime(), task.getEndTime()};
+    // 与原先的线性查找一致：同一键保留最先登记的任务
+    index_.insert(make_pair(key, &task));
+}
+
+void TaskArena::appendTo(vector<TaskDefinition>& tasks) const
+{
+    tasks.reserve(tasks.size() + size_);
+    for (const auto& chunk : chunks_) {
+        tasks.insert(tasks.end(), chunk.begin(), chunk.end());
+    }
+}
+
+void TaskArena::clear()
+{
+    chunks_.clear();
+    size_ = 0;
+    index_.clear();
+}
+
+}  // namespace vip_first_class
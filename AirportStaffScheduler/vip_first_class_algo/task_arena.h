@@ -0,0 +1,110 @@
+/**
+ * @file task_arena.h
+ * @brief 调度过程中生成任务的存储区
+ * 
+ * 操作间、吃饭、休息等在调度过程中动态生成的任务按块存储，
+ * 追加新任务不会移动已有任务，指针和下标在整个调度过程中保持有效；
+ * 同时按（任务类型, 开始时间, 结束时间）建立哈希索引，查找和插入均为O(1)
+ */
+
+#ifndef VIP_FIRST_CLASS_TASK_ARENA_H
+#define VIP_FIRST_CLASS_TASK_ARENA_H
+
+#include "task_definition.h"
+#include "task_type.h"
+#include <vector>
+#include <unordered_map>
+#include <cstddef>
+
+namespace vip_first_class {
+
+using namespace std;
+
+/**
+ * @brief 生成任务存储区
+ */
+class TaskArena {
+public:
+    static const size_t CHUNK_SIZE = 64;  ///< 每块容纳的任务数
+    
+    /**
+     * @brief 构造函数
+     */
+    TaskArena();
+    
+    /**
+     * @brief 析构函数
+     */
+    ~TaskArena();
+    
+    TaskArena(const TaskArena&) = delete;
+    TaskArena& operator=(const TaskArena&) = delete;
+    
+    /**
+     * @brief 获取存储区中的任务数
+     */
+    size_t size() const { return size_; }
+    
+    /**
+     * @brief 按下标获取任务（下标在clear之前保持不变）
+     */
+    TaskDefinition& at(size_t index) { return chunks_[index / CHUNK_SIZE][index % CHUNK_SIZE]; }
+    const TaskDefinition& at(size_t index) const { return chunks_[index / CHUNK_SIZE][index % CHUNK_SIZE]; }
+    
+    /**
+     * @brief 按（类型, 开始时间, 结束时间）查找任务
+     * @return 任务指针，不存在返回nullptr
+     */
+    TaskDefinition* find(TaskType type, long start_time, long end_time) const;
+    
+    /**
+     * @brief 查找任务，不存在时在存储区中创建
+     * 
+     * 新建的任务只设置了类型、开始时间和结束时间，其他属性由调用方设置
+     * @param created 输出参数，是否新建了任务（可为nullptr）
+     * @return 任务指针（地址在clear之前保持不变）
+     */
+    TaskDefinition* findOrCreate(TaskType type, long start_time, long end_time, bool* created = nullptr);
+    
+    /**
+     * @brief 把存储区之外的任务加入索引（例如输入中已有的操作间任务）
+     * @param task 任务引用，调用方需保证其地址在使用期间不变
+     */
+    void indexTask(TaskDefinition& task);
+    
+    /**
+     * @brief 把存储区中的任务按创建顺序追加到任务列表末尾
+     */
+    void appendTo(vector<TaskDefinition>& tasks) const;
+    
+    /**
+     * @brief 清空存储区和索引（之前返回的指针全部失效）
+     */
+    void clear();
+
+private:
+    /**
+     * @brief 索引键：任务类型 + 开始时间 + 结束时间
+     */
+    struct SlotKey {
+        int type;
+        long start_time;
+        long end_time;
+        
+        bool operator==(const SlotKey& other) const {
+            return type == other.type && start_time == other.start_time && end_time == other.end_time;
+        }
+    };
+    
+    struct SlotKeyHash {
+        size_t operator()(const SlotKey& key) const;
+    };
+    
+    vector<vector<TaskDefinition>> chunks_;                        ///< 任务块，每块容量固定为CHUNK_SIZE
+    size_t size_;                                                  ///< 任务数
+    unordered_map<SlotKey, TaskDefinition*, SlotKeyHash> index_;   ///< 索引
+};
+
+}  // namespace vip_first_class
+
+#endif  // VIP_FIRST_CLASS_TASK_ARENA_H
@@ -4,9 +4,11 @@
  */
 
 #include "task_config.h"
+#include "scheduling_context.h"
 #include "shift.h"
 #include "task_definition.h"
 #include "employee_manager.h"
+#include "../Logger.h"
 #include <set>
 #include <algorithm>
 #include <vector>
@@ -22,6 +24,11 @@ const vector<string> TaskConfig::empty_employee_list_;
 
 TaskConfig& TaskConfig::getInstance()
 {
+    // 多日窗口并行调度的工作线程使用绑定的上下文中的副本
+    SchedulingContext* context = SchedulingContext::current();
+    if (context != nullptr) {
+        return context->config();
+    }
     static TaskConfig instance;
     return instance;
 }
@@ -44,37 +51,37 @@ void TaskConfig::initializeDefaultConfig()
     // 使用任务类型枚举值作为ID的基础
     // 1. 调度：仅固定主1
     long task_id = static_cast<long>(TaskType::DISPATCH);
-    task_type_to_id_[TaskType::DISPATCH] = task_id;
+    setTaskTypeToId(TaskType::DISPATCH, task_id);
     task_id_to_fixed_persons_[task_id].push_back(FixedPersonInfo(ShiftCategory::MAIN, 1));
     
     // 2. 国际前台早班：仅固定副1
     task_id = static_cast<long>(TaskType::INTERNATIONAL_FRONT_DESK_EARLY);
-    task_type_to_id_[TaskType::INTERNATIONAL_FRONT_DESK_EARLY] = task_id;
+    setTaskTypeToId(TaskType::INTERNATIONAL_FRONT_DESK_EARLY, task_id);
     task_id_to_fixed_persons_[task_id].push_back(FixedPersonInfo(ShiftCategory::SUB, 1));
     
     // 3. 国际前台晚班：仅固定副2
     task_id = static_cast<long>(TaskType::INTERNATIONAL_FRONT_DESK_LATE);
-    task_type_to_id_[TaskType::INTERNATIONAL_FRONT_DESK_LATE] = task_id;
+    setTaskTypeToId(TaskType::INTERNATIONAL_FRONT_DESK_LATE, task_id);
     task_id_to_fixed_persons_[task_id].push_back(FixedPersonInfo(ShiftCategory::SUB, 2));
     
     // 4. 国际厅内早班：仅固定副3
     task_id = static_cast<long>(TaskType::INTERNATIONAL_HALL_EARLY);
-    task_type_to_id_[TaskType::INTERNATIONAL_HALL_EARLY] = task_id;
+    setTaskTypeToId(TaskType::INTERNATIONAL_HALL_EARLY, task_id);
     task_id_to_fixed_persons_[task_id].push_back(FixedPersonInfo(ShiftCategory::SUB, 3));
     
     // 5. 国际厅内晚班：固定副5
     task_id = static_cast<long>(TaskType::INTERNATIONAL_HALL_LATE);
-    task_type_to_id_[TaskType::INTERNATIONAL_HALL_LATE] = task_id;
+    setTaskTypeToId(TaskType::INTERNATIONAL_HALL_LATE, task_id);
     task_id_to_fixed_persons_[task_id].push_back(FixedPersonInfo(ShiftCategory::SUB, 5));
     
     // 6. 国内厅内早班：固定副4
     task_id = static_cast<long>(TaskType::DOMESTIC_HALL_EARLY);
-    task_type_to_id_[TaskType::DOMESTIC_HALL_EARLY] = task_id;
+    setTaskTypeToId(TaskType::DOMESTIC_HALL_EARLY, task_id);
     task_id_to_fixed_persons_[task_id].push_back(FixedPersonInfo(ShiftCategory::SUB, 4));
     
     // 7. 国内前台早班：有副6和主5
     task_id = static_cast<long>(TaskType::DOMESTIC_FRONT_DESK_EARLY);
-    task_type_to_id_[TaskType::DOMESTIC_FRONT_DESK_EARLY] = task_id;
+    setTaskTypeToId(TaskType::DOMESTIC_FRONT_DESK_EARLY, task_id);
     task_id_to_fixed_persons_[task_id].push_back(FixedPersonInfo(ShiftCategory::SUB, 6));
     task_id_to_fixed_persons_[task_id].push_back(FixedPersonInfo(ShiftCategory::MAIN, 5));
 
@@ -92,9 +99,8 @@ const vector<FixedPersonInfo>& TaskConfig::getFixedPersons(long task_id) const
 
 const vector<FixedPersonInfo>& TaskConfig::getFixedPersonsByType(TaskType task_type) const
 {
-    auto type_it = task_type_to_id_.find(task_type);
-    if (type_it != task_type_to_id_.end()) {
-        return getFixedPersons(type_it->second);
+    if (isKnownTaskType(task_type) && task_type_to_id_[static_cast<int>(task_type)] >= 0) {
+        return getFixedPersons(task_type_to_id_[static_cast<int>(task_type)]);
     }
     return empty_list_;
 }
@@ -106,29 +112,33 @@ void TaskConfig::addFixedPerson(long task_id, const FixedPersonInfo& fixed_perso
 
 void TaskConfig::addFixedPersonByType(TaskType task_type, const FixedPersonInfo& fixed_person)
 {
-    long task_id = static_cast<long>(task_type);
+    if (!isKnownTaskType(task_type)) {
+        LOG_WARN("警告：未知任务类型 " << static_cast<int>(task_type) << "，忽略固定人选配置");
+        return;
+    }
     
-    // 如果类型还没有映射到ID，创建映射
-    if (task_type_to_id_.find(task_type) == task_type_to_id_.end()) {
-        task_type_to_id_[task_type] = task_id;
-    } else {
-        // 如果已有映射，使用已存在的ID
-        task_id = task_type_to_id_[task_type];
+    // 如果类型还没有映射到ID，创建映射（ID与枚举值相同）；如果已有映射，使用已存在的ID
+    int index = static_cast<int>(task_type);
+    if (task_type_to_id_[index] < 0) {
+        task_type_to_id_[index] = static_cast<long>(task_type);
     }
     
-    addFixedPerson(task_id, fixed_person);
+    addFixedPerson(task_type_to_id_[index], fixed_person);
 }
 
 void TaskConfig::setTaskTypeToId(TaskType task_type, long task_id)
 {
-    task_type_to_id_[task_type] = task_id;
+    if (!isKnownTaskType(task_type)) {
+        LOG_WARN("警告：未知任务类型 " << static_cast<int>(task_type) << "，忽略任务ID映射");
+        return;
+    }
+    task_type_to_id_[static_cast<int>(task_type)] = task_id;
 }
 
 long TaskConfig::getTaskIdByType(TaskType task_type) const
 {
-    auto it = task_type_to_id_.find(task_type);
-    if (it != task_type_to_id_.end()) {
-        return it->second;
+    if (isKnownTaskType(task_type) && task_type_to_id_[static_cast<int>(task_type)] >= 0) {
+        return task_type_to_id_[static_cast<int>(task_type)];
     }
     return 0;
 }
@@ -140,9 +150,8 @@ bool TaskConfig::hasFixedPersonConfig(long task_id) const
 
 bool TaskConfig::hasFixedPersonConfigByType(TaskType task_type) const
 {
-    auto type_it = task_type_to_id_.find(task_type);
-    if (type_it != task_type_to_id_.end()) {
-        return hasFixedPersonConfig(type_it->second);
+    if (isKnownTaskType(task_type) && task_type_to_id_[static_cast<int>(task_type)] >= 0) {
+        return hasFixedPersonConfig(task_type_to_id_[static_cast<int>(task_type)]);
     }
     return false;
 }
@@ -150,72 +159,33 @@ bool TaskConfig::hasFixedPersonConfigByType(TaskType task_type) const
 void TaskConfig::clear()
 {
     task_id_to_fixed_persons_.clear();
-    task_type_to_id_.clear();
-    task_type_to_priority_.clear();
+    fill(task_type_to_id_, task_type_to_id_ + TASK_TYPE_COUNT, -1L);
+    fill(task_type_to_priority_, task_type_to_priority_ + TASK_TYPE_COUNT, 0);
 }
 
 int TaskConfig::getTaskPriority(TaskType task_type) const
 {
-    auto it = task_type_to_priority_.find(task_type);
-    if (it != task_type_to_priority_.end()) {
-        return it->second;
+    if (isKnownTaskType(task_type)) {
+        return task_type_to_priority_[static_cast<int>(task_type)];
     }
     return 0;  // 默认优先级为0
 }
 
 void TaskConfig::setTaskPriority(TaskType task_type, int priority)
 {
-    task_type_to_priority_[task_type] = priority;
+    if (!isKnownTaskType(task_type)) {
+        LOG_WARN("警告：未知任务类型 " << static_cast<int>(task_type) << "，忽略优先级设置");
+        return;
+    }
+    task_type_to_priority_[static_cast<int>(task_type)] = priority;
 }
 
 void TaskConfig::initializeTaskPriorities()
 {
-    // 优先级顺序：调度类 > 外场 > 厅内 > 前台协助
-    // 数值越大优先级越高
-    
-    // 调度类：优先级100（最高）
-    setTaskPriority(TaskType::DISPATCH, 100);
-
-    // 其他前台任务：优先级与调度相同
-    setTaskPriority(TaskType::DOMESTIC_FRONT_DESK, 100);
-    setTaskPriority(TaskType::DOMESTIC_FRONT_DESK_EARLY, 100);
-    setTaskPriority(TaskType::INTERNATIONAL_FRONT_DESK_EARLY, 100);
-    setTaskPriority(TaskType::INTERNATIONAL_FRONT_DESK_LATE, 100);
-    
-    // 外场类：优先级80
-    setTaskPriority(TaskType::EXTERNAL_DOMESTIC_DEPARTURE_FEW, 80);
-    setTaskPriority(TaskType::EXTERNAL_DOMESTIC_DEPARTURE_MANY, 80);
-    setTaskPriority(TaskType::EXTERNAL_DOMESTIC_ARRIVAL_FEW, 80);
-    setTaskPriority(TaskType::EXTERNAL_DOMESTIC_ARRIVAL_MANY, 80);
-    setTaskPriority(TaskType::EXTERNAL_INTERNATIONAL_DEPARTURE_FEW, 80);
-    setTaskPriority(TaskType::EXTERNAL_INTERNATIONAL_DEPARTURE_MANY, 80);
-    setTaskPriority(TaskType::EXTERNAL_INTERNATIONAL_ARRIVAL_FEW, 80);
-    setTaskPriority(TaskType::EXTERNAL_INTERNATIONAL_ARRIVAL_MANY, 80);
-    
-    // 厅内类：优先级60
-    setTaskPriority(TaskType::INTERNATIONAL_HALL_EARLY, 60);
-    setTaskPriority(TaskType::INTERNATIONAL_HALL_LATE, 60);
-    setTaskPriority(TaskType::DOMESTIC_HALL_EARLY, 60);
-    setTaskPriority(TaskType::DOMESTIC_HALL_0830_0930, 60);
-    setTaskPriority(TaskType::DOMESTIC_HALL_0930_1030, 60);
-    setTaskPriority(TaskType::DOMESTIC_HALL_1030_1130, 60);
-    setTaskPriority(TaskType::DOMESTIC_HALL_1130_1230, 60);
-    setTaskPriority(TaskType::DOMESTIC_HALL_1230_1330, 60);
-    setTaskPriority(TaskType::DOMESTIC_HALL_1330_1430, 60);
-    setTaskPriority(TaskType::DOMESTIC_HALL_1430_1530, 60);
-    setTaskPriority(TaskType::DOMESTIC_HALL_1530_1630, 60);
-    setTaskPriority(TaskType::DOMESTIC_HALL_1630_1730, 60);
-    setTaskPriority(TaskType::DOMESTIC_HALL_1730_1830, 60);
-    setTaskPriority(TaskType::DOMESTIC_HALL_1830_1930, 60);
-    setTaskPriority(TaskType::DOMESTIC_HALL_1930_2030, 60);
-    setTaskPriority(TaskType::DOMESTIC_HALL_2030_AFTER, 60);
-    
-    // 前台协助类：优先级40（最低）
-    setTaskPriority(TaskType::DOMESTIC_FRONT_DESK_ASSIST, 40);
-    setTaskPriority(TaskType::DOMESTIC_FRONT_DESK_ASSIST2, 40);
-    
-    // 操作间类：优先级30
-    setTaskPriority(TaskType::OPERATION_ROOM, 30);
+    // 优先级顺序：调度类 > 外场 > 厅内 > 前台协助，数值越大优先级越高
+    for (int i = 0; i < TASK_TYPE_COUNT; ++i) {
+        task_type_to_priority_[i] = defaultTaskPriority(static_cast<TaskType>(i));
+    }
 }
 
 void TaskConfig::setHallMaintenanceFixedPersons(const vector<Shift>& shifts, 
@@ -139,7 +139,7 @@ public:
     /**
      * @brief 初始化任务优先级配置
      * 
-     * 根据业务需求初始化所有任务的优先级
+     * 从任务类型属性表（TASK_TYPE_TRAITS）复制所有任务的默认优先级
      * 优先级顺序：调度类 > 外场 > 厅内 > 前台协助
      */
     void initializeTaskPriorities();
@@ -161,6 +161,8 @@ public:
     const vector<string>& getHallMaintenanceFixedPersons() const;
 
 private:
+    friend class SchedulingContext;
+    
     /**
      * @brief 私有构造函数（单例模式）
      */
@@ -172,9 +174,9 @@ private:
     ~TaskConfig();
     
     /**
-     * @brief 禁止拷贝构造
+     * @brief 拷贝构造（只供SchedulingContext复制调度状态）
      */
-    TaskConfig(const TaskConfig&) = delete;
+    TaskConfig(const TaskConfig&) = default;
     
     /**
      * @brief 禁止赋值操作
@@ -184,11 +186,11 @@ private:
     // 任务ID到固定人选列表的映射
     map<long, vector<FixedPersonInfo>> task_id_to_fixed_persons_;
     
-    // 任务类型到任务ID的映射（用于通过类型查找）
-    map<TaskType, long> task_type_to_id_;
+    // 任务类型到任务ID的映射（用于通过类型查找，按枚举值下标，-1表示未映射）
+    long task_type_to_id_[TASK_TYPE_COUNT];
     
-    // 任务类型到优先级的映射（数值越大优先级越高）
-    map<TaskType, int> task_type_to_priority_;
+    // 任务类型到优先级（按枚举值下标，数值越大优先级越高）
+    int task_type_to_priority_[TASK_TYPE_COUNT];
     
     // 空的固定人选列表（用于返回默认值）
     static const vector<FixedPersonInfo> empty_list_;
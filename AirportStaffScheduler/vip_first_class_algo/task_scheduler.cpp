@@ -6,8 +6,12 @@
 #include "task_scheduler.h"
 #include "task_config.h"
 #include "employee_manager.h"
+#include "scheduling_context.h"
 #include "employee_info.h"
+#include "vip_model_view.h"
 #include "../CommonAdapterUtils.h"
+#include "../Profiler.h"
+#include "../Logger.h"
 #include <algorithm>
 #include <map>
 #include <vector>
@@ -111,6 +115,12 @@ static bool isEmployeeAvailable(const string& employee_id, long task_start, long
     return true;  // 员工空闲
 }
 
+// 辅助函数：任务占用的结束时间（没有结束时间的任务按开始时间 + 时长）
+static long taskOccupiedEnd(const TaskDefinition& task)
+{
+    return task.getEndTime() > task.getStartTime() ? task.getEndTime() : task.getStartTime() + task.getDuration();
+}
+
 // 辅助函数：计算员工当日已分配任务的总时长（秒）
 static long calculateEmployeeDailyTaskTime(const string& employee_id, 
                                                 long current_task_start_time,
@@ -229,39 +239,82 @@ static bool isTaskFixedForEmployee(const string& task_id, TaskType task_type, co
     return false;
 }
 
+map<string, int>& TaskScheduler::firstShiftCounts()
+{
+    // 多日窗口并行调度的工作线程使用绑定的上下文中的副本
+    SchedulingContext* context = SchedulingContext::current();
+    return context != nullptr ? context->firstShiftCounts() : first_shift_counts_;
+}
+
 void TaskScheduler::resetFirstShiftCounts()
 {
-    first_shift_counts_.clear();
+    firstShiftCounts().clear();
 }
 
 int TaskScheduler::getFirstShiftCount(const string& employee_id)
 {
-    auto it = first_shift_counts_.find(employee_id);
-    return (it != first_shift_counts_.end()) ? it->second : 0;
+    const map<string, int>& counts = firstShiftCounts();
+    auto it = counts.find(employee_id);
+    return (it != counts.end()) ? it->second : 0;
 }
 
 void TaskScheduler::incrementFirstShiftCount(const string& employee_id)
 {
-    first_shift_counts_[employee_id]++;
+    firstShiftCounts()[employee_id]++;
+}
+
+const map<string, int>& TaskScheduler::getFirstShiftCounts()
+{
+    return firstShiftCounts();
+}
+
+void TaskScheduler::setFirstShiftCounts(const map<string, int>& counts)
+{
+    firstShiftCounts() = counts;
+}
+
+bool TaskScheduler::isFirstHallGroupLeading(const vector<string>& hall_fixed_persons,
+                                            const map<string, int>& first_shift_counts)
+{
+    auto count_of = [&first_shift_counts](const string& employee_id) {
+        auto it = first_shift_counts.find(employee_id);
+        return (it != first_shift_counts.end()) ? it->second : 0;
+    };
+    
+    // 4人：前2人一组、后2人一组；3人：前2人一组、第3人一组；2人：每组1人
+    int sum1 = 0;
+    int sum2 = 0;
+    if (hall_fixed_persons.size() == 4) {
+        sum1 = count_of(hall_fixed_persons[0]) + count_of(hall_fixed_persons[1]);
+        sum2 = count_of(hall_fixed_persons[2]) + count_of(hall_fixed_persons[3]);
+    } else if (hall_fixed_persons.size() == 3) {
+        sum1 = count_of(hall_fixed_persons[0]) + count_of(hall_fixed_persons[1]);
+        sum2 = count_of(hall_fixed_persons[2]);
+    } else if (hall_fixed_persons.size() == 2) {
+        sum1 = count_of(hall_fixed_persons[0]);
+        sum2 = count_of(hall_fixed_persons[1]);
+    }
+    return sum1 <= sum2;
 }
 
 void TaskScheduler::scheduleTasks(vector<TaskDefinition>& tasks, 
                                    const vector<Shift>& shifts)
 {
+    PROFILE_SCOPE("vip.schedule");
+    
     // 0. 动态设定厅内保障任务的4个固定人选
     TaskConfig::getInstance().setHallMaintenanceFixedPersons(shifts, tasks);
     
-    // 0.1 预先预留足够容量，避免在添加操作间任务时重新分配内存导致指针失效
-    // 估计需要添加的操作间任务数量（最多14个，对应14个厅内保障任务时间段）
-    size_t estimated_operation_tasks = 14;
-    tasks.reserve(tasks.size() + estimated_operation_tasks);
-    cerr << "[DEBUG] 任务向量容量已预留，当前大小=" << tasks.size() 
-         << ", 容量=" << tasks.capacity() << endl;
+    // 0.1 调度过程中生成的任务（操作间任务等）放在generated_tasks_中，
+    // tasks在调度结束前不再增长，任务指针在整个调度过程中保持有效
+    generated_tasks_.clear();
     
     // 1. 根据任务优先级对任务进行排序（优先级高的在前）
-    sort(tasks.begin(), tasks.end(), [](const TaskDefinition& a, const TaskDefinition& b) {
-        int priority_a = TaskConfig::getInstance().getTaskPriority(a.getTaskType());
-        int priority_b = TaskConfig::getInstance().getTaskPriority(b.getTaskType());
+    PROFILE_TIMER(sort_timer, "vip.sort");
+    const TaskConfig& task_config = TaskConfig::getInstance();
+    sort(tasks.begin(), tasks.end(), [&task_config](const TaskDefinition& a, const TaskDefinition& b) {
+        int priority_a = task_config.getTaskPriority(a.getTaskType());
+        int priority_b = task_config.getTaskPriority(b.getTaskType());
         
         // 优先级高的排在前面（数值越大优先级越高）
         if (priority_a != priority_b) {
@@ -271,32 +324,86 @@ void TaskScheduler::scheduleTasks(vector<TaskDefinition>& tasks,
         // 如果优先级相同，按照任务ID排序（保持稳定排序）
         return a.getTaskId() < b.getTaskId();
     });
+    PROFILE_TIMER_STOP(sort_timer);
     
     // 2. 创建任务ID到TaskDefinition指针的映射，方便查找和更新
     map<string, TaskDefinition*> task_ptr_map;
     for (auto& task : tasks) {
         task_ptr_map[task.getTaskId()] = &task;
     }
-    cerr << "[DEBUG] 任务指针映射建立完成，共 " << task_ptr_map.size() << " 个任务" << endl;
+    LOG_DEBUG("[DEBUG] 任务指针映射建立完成，共 " << task_ptr_map.size() << " 个任务");
+    
+    // 2.0 员工休息：每名有休息的员工一条时间线。强制替换会撤销已有分配，时间线不增量维护，
+    // 检查时按员工当前的已分配任务重建（只涉及有休息的员工）
+    map<string, int> break_owner;  // 员工ID -> 时间线编号
+    for (const auto& item : breaks_) {
+        if (!break_owner.count(item.staff_id)) {
+            int owner = static_cast<int>(break_owner.size());
+            break_owner[item.staff_id] = owner;
+        }
+    }
+    AirportStaffScheduler::Breaks::BreakTimeline break_timeline;
+    break_timeline.reset(break_owner.size());
+    vector<int> break_ids = break_timeline.addStaffBreaks(breaks_, [&](const string& employee_id) {
+        auto it = break_owner.find(employee_id);
+        return it == break_owner.end() ? -1 : it->second;
+    });
+    auto rebuildBreaks = [&](int owner, const string& employee_id) {
+        break_timeline.clearWork(owner);
+        auto* employee = EmployeeManager::getInstance().getEmployee(employee_id);
+        if (!employee) {
+            return;
+        }
+        vector<pair<long, long>> spans;
+        for (const string& assigned_task_id : employee->getAssignedTaskIds()) {
+            auto task_it = task_ptr_map.find(assigned_task_id);
+            if (task_it != task_ptr_map.end() && task_it->second != nullptr) {
+                spans.push_back(make_pair(task_it->second->getStartTime(), taskOccupiedEnd(*task_it->second)));
+            }
+        }
+        sort(spans.begin(), spans.end());
+        for (const auto& span : spans) {
+            break_timeline.addWork(owner, span.first, span.second);
+        }
+    };
+    auto breaksAllow = [&](const string& employee_id, const TaskDefinition& task) {
+        auto it = break_owner.find(employee_id);
+        if (it == break_owner.end()) {
+            return true;
+        }
+        rebuildBreaks(it->second, employee_id);
+        return break_timeline.canWork(it->second, task.getStartTime(), taskOccupiedEnd(task));
+    };
+    
+    // 输入中已有的操作间任务加入索引，生成操作间任务时直接复用
+    for (auto& task : tasks) {
+        if (task.getTaskType() == TaskType::OPERATION_ROOM) {
+            generated_tasks_.indexTask(task);
+        }
+    }
     
     // 2.1 先处理厅内保障任务（4人，2人一组轮流值守）
+    // 新生成的操作间任务在创建时加入task_ptr_map，地址不会改变，无需重建映射
     scheduleHallMaintenanceTasks(tasks, shifts, task_ptr_map);
     
-    // 2.2 在添加操作间任务后，重新建立任务指针映射，确保所有指针都是最新的
-    // 因为scheduleHallMaintenanceTasks可能会添加新的操作间任务，导致tasks向量重新分配
-    task_ptr_map.clear();
+    // 2.2 处理顺序：输入任务（已按优先级排序）在前，生成的任务在后
+    vector<TaskDefinition*> task_order;
+    task_order.reserve(tasks.size() + generated_tasks_.size());
     for (auto& task : tasks) {
-        task_ptr_map[task.getTaskId()] = &task;
+        task_order.push_back(&task);
+    }
+    for (size_t i = 0; i < generated_tasks_.size(); ++i) {
+        task_order.push_back(&generated_tasks_.at(i));
     }
-    cerr << "[DEBUG] 厅内任务处理后，任务指针映射已更新，共 " << task_ptr_map.size() << " 个任务" << endl;
     
     // 3. 使用任务ID集合来跟踪已处理的任务
     set<string> processed_task_ids;
     
     // 4. 遍历任务列表，逐个分配任务
     size_t current_index = 0;
-    while (current_index < tasks.size()) {
-        TaskDefinition& task = tasks[current_index];
+    while (current_index < task_order.size()) {
+        PROFILE_SCOPE("vip.task");
+        TaskDefinition& task = *task_order[current_index];
         string task_id = task.getTaskId();
         
         // 跳过已经处理过的任务
@@ -313,24 +420,7 @@ void TaskScheduler::scheduleTasks(vector<TaskDefinition>& tasks,
         }
         
         // 跳过厅内保障任务（已经单独处理）
-        bool is_hall_maintenance_task = false;
-        static const TaskType hall_task_types[] = {
-            TaskType::DOMESTIC_HALL_EARLY,      // 国内厅内早班（05:30-08:30）
-            TaskType::DOMESTIC_HALL_0830_0930, TaskType::DOMESTIC_HALL_0930_1030,
-            TaskType::DOMESTIC_HALL_1030_1130, TaskType::DOMESTIC_HALL_1130_1230,
-            TaskType::DOMESTIC_HALL_1230_1330, TaskType::DOMESTIC_HALL_1330_1430,
-            TaskType::DOMESTIC_HALL_1430_1530, TaskType::DOMESTIC_HALL_1530_1630,
-            TaskType::DOMESTIC_HALL_1630_1730, TaskType::DOMESTIC_HALL_1730_1830,
-            TaskType::DOMESTIC_HALL_1830_1930, TaskType::DOMESTIC_HALL_1930_2030,
-            TaskType::DOMESTIC_HALL_2030_AFTER
-        };
-        for (const auto& hall_task_type : hall_task_types) {
-            if (task.getTaskType() == hall_task_type) {
-                is_hall_maintenance_task = true;
-                break;
-            }
-        }
-        if (is_hall_maintenance_task) {
+        if (isHallMaintenanceTask(task.getTaskType())) {
             processed_task_ids.insert(task.getTaskId());
             current_index++;
             continue;
@@ -344,6 +434,8 @@ void TaskScheduler::scheduleTasks(vector<TaskDefinition>& tasks,
         int required_count = task.getRequiredCount();  // 需要的人数（从任务属性获取）
         
         // 3.1 分配固定人选：收集所有固定人选对应的员工，然后统一处理
+        PROFILE_COUNT("vip.tasks", 1);
+        PROFILE_TIMER(fixed_persons_timer, "vip.fixed_persons");
         vector<string> fixed_employee_candidates;
         set<string> fixed_employee_set;  // 用于去重
         
@@ -383,7 +475,8 @@ void TaskScheduler::scheduleTasks(vector<TaskDefinition>& tasks,
             
             // 检查固定人选是否在时间段空闲
             if (isEmployeeAvailable(fixed_employee_id, task.getStartTime(), task.getEndTime(),
-                                     task.allowOverlap(), task.getMaxOverlapTime(), task_ptr_map)) {
+                                     task.allowOverlap(), task.getMaxOverlapTime(), task_ptr_map) &&
+                breaksAllow(fixed_employee_id, task)) {
                 // 检查是否已经分配（避免重复分配）
                 if (!task.isAssignedToEmployee(fixed_employee_id)) {
                     // 分配任务给固定人选
@@ -401,10 +494,12 @@ void TaskScheduler::scheduleTasks(vector<TaskDefinition>& tasks,
         
         // 更新已分配人数（从任务对象重新获取，确保数据一致）
         assigned_count = static_cast<int>(task.getAssignedEmployeeCount());
+        PROFILE_TIMER_STOP(fixed_persons_timer);
         
         // 3.2 如果还需要其他人，继续分配
         while (assigned_count < required_count) {
             string selected_employee_id;
+            PROFILE_TIMER(filter_timer, "vip.filter_candidates");
             
             // 3.2.1 优先选择空闲的、当日任务时间最少的人
             // 软约束：副班人员上下班弹性 - 任务繁忙时，优先安排工时少的副班人员提前上岗或延迟下岗
@@ -435,7 +530,8 @@ void TaskScheduler::scheduleTasks(vector<TaskDefinition>& tasks,
                         
                         // 检查是否空闲
                         if (isEmployeeAvailable(employee_id, task.getStartTime(), task.getEndTime(),
-                                                 task.allowOverlap(), task.getMaxOverlapTime(), task_ptr_map)) {
+                                                 task.allowOverlap(), task.getMaxOverlapTime(), task_ptr_map) &&
+                            breaksAllow(employee_id, task)) {
                             // 计算该员工当日已分配任务的总时长
                             long daily_task_time = calculateEmployeeDailyTaskTime(employee_id, 
                                                                                       task.getStartTime(), 
@@ -478,7 +574,8 @@ void TaskScheduler::scheduleTasks(vector<TaskDefinition>& tasks,
                         
                         // 检查是否空闲
                         if (isEmployeeAvailable(employee_id, task.getStartTime(), task.getEndTime(),
-                                                 task.allowOverlap(), task.getMaxOverlapTime(), task_ptr_map)) {
+                                                 task.allowOverlap(), task.getMaxOverlapTime(), task_ptr_map) &&
+                            breaksAllow(employee_id, task)) {
                             // 计算该员工当日已分配任务的总时长
                             long daily_task_time = calculateEmployeeDailyTaskTime(employee_id, 
                                                                                       task.getStartTime(), 
@@ -503,6 +600,8 @@ void TaskScheduler::scheduleTasks(vector<TaskDefinition>& tasks,
                 }
             }
             
+            PROFILE_TIMER_STOP(filter_timer);
+            
             // 3.2.2 如果找到空闲的人，分配任务
             if (!selected_employee_id.empty()) {
                 // 维护双向映射：任务到人（任务->人员）
@@ -520,6 +619,8 @@ void TaskScheduler::scheduleTasks(vector<TaskDefinition>& tasks,
             
             // 3.2.3 如果没有空闲的人，找有非固定任务且优先级低的人
             // 先收集所有可以撤销的任务，然后按优先级排序，选择优先级最低的
+            PROFILE_SCOPE("vip.forced_replacement");
+            PROFILE_COUNT("vip.forced_replacements", 1);
             struct ReplaceableTask {
                 string employee_id;
                 string task_id;
@@ -639,12 +740,12 @@ void TaskScheduler::scheduleTasks(vector<TaskDefinition>& tasks,
             
             // 如果找不到可以撤销的任务，输出错误信息
             if (!found_replacement && replaceable_tasks.empty()) {
-                cerr << "错误：无法为任务 ID " << task.getTaskId() 
-                          << " (名称: " << task.getTaskName() 
+                LOG_ERROR("错误：无法为任务 ID " << task.getTaskId()
+                          << " (名称: " << task.getTaskName()
                           << ", 类型: " << static_cast<int>(task.getTaskType())
                           << ", 优先级: " << current_priority
-                          << ") 找到可以撤销的任务。任务需要 " << required_count 
-                          << " 人，当前已分配 " << assigned_count << " 人。" << endl;
+                          << ") 找到可以撤销的任务。任务需要 " << required_count
+                          << " 人，当前已分配 " << assigned_count << " 人。");
             }
             
             // 如果找到可以替换的员工，分配当前任务
@@ -681,26 +782,8 @@ void TaskScheduler::scheduleTasks(vector<TaskDefinition>& tasks,
                     
                     assigned_count++;
                     
-                    // 重新排序tasks列表（因为任务状态可能改变）
-                    sort(tasks.begin(), tasks.end(), [](const TaskDefinition& a, const TaskDefinition& b) {
-                        int priority_a = TaskConfig::getInstance().getTaskPriority(a.getTaskType());
-                        int priority_b = TaskConfig::getInstance().getTaskPriority(b.getTaskType());
-                        
-                        if (priority_a != priority_b) {
-                            return priority_a > priority_b;
-                        }
-                        
-                        return a.getTaskId() < b.getTaskId();
-                    });
-                    
-                    // 重新建立任务指针映射
-                    task_ptr_map.clear();
-                    for (auto& t : tasks) {
-                        task_ptr_map[t.getTaskId()] = &t;
-                    }
-                    cerr << "[DEBUG] 任务重新排序后，指针映射已更新，共 " << task_ptr_map.size() << " 个任务" << endl;
-                    
-                    // 重新开始循环（从0开始）
+                    // 排序键（优先级、任务ID）不随分配状态变化，处理顺序不变，
+                    // 只需从头重新扫描，让被撤销的任务重新参与分配
                     current_index = 0;
                     continue;
                 }
@@ -710,11 +793,11 @@ void TaskScheduler::scheduleTasks(vector<TaskDefinition>& tasks,
                 break;
             }
         }
-        cout<<"任务 ID " << task.getTaskId() 
-                  << " (名称: " << task.getTaskName() 
+        LOG_DEBUG("任务 ID " << task.getTaskId()
+                  << " (名称: " << task.getTaskName()
                   << ", 类型: " << static_cast<int>(task.getTaskType())
-                  << ") 已分配 " << assigned_count 
-                  << " 人，需求 " << required_count << " 人。" << endl;
+                  << ") 已分配 " << assigned_count
+                  << " 人，需求 " << required_count << " 人。");
         // 更新任务状态
         if (assigned_count > 0) {
             task.setAssigned(true);
@@ -724,7 +807,17 @@ void TaskScheduler::scheduleTasks(vector<TaskDefinition>& tasks,
         processed_task_ids.insert(task.getTaskId());
         current_index++;
     }
-    cout<<"任务调度完成！"<<endl;
+    
+    // 4.1 休息的最终位置：按每名员工的最终分配重建
+    for (const auto& owner : break_owner) {
+        rebuildBreaks(owner.second, owner.first);
+    }
+    break_timeline.getPlacements(breaks_, break_ids, break_placements_);
+    
+    // 5. 生成的任务追加到任务列表末尾，供调用方输出
+    generated_tasks_.appendTo(tasks);
+    generated_tasks_.clear();
+    LOG_INFO("任务调度完成！");
 }
 
 // 使用公共类的适配器函数实现
@@ -789,32 +882,48 @@ void TaskScheduler::scheduleTasksFromCommon(
     scheduleTasks(tasks, shifts);
 }
 
+// 使用单日模型视图实现（不经过公共类转换）
+void TaskScheduler::scheduleTasksFromModel(AirportStaffScheduler::Model::DayModel& model)
+{
+    VipModelView view(model);
+    view.registerEmployees();
+    
+    vector<TaskDefinition> tasks;
+    vector<Shift> shifts;
+    view.buildTasks(tasks);
+    view.buildShifts(shifts);
+    view.buildBreaks(breaks_);
+    
+    scheduleTasks(tasks, shifts);
+    view.commitAssignments(tasks);
+}
+
 void TaskScheduler::scheduleHallMaintenanceTasks(vector<TaskDefinition>& tasks,
                                                  const vector<Shift>& shifts,
                                                  map<string, TaskDefinition*>& task_ptr_map)
 {
+    PROFILE_SCOPE("vip.hall_maintenance");
+    
     // 获取厅内保障任务的4个固定人选
     const auto& hall_fixed_persons = TaskConfig::getInstance().getHallMaintenanceFixedPersons();
     if (hall_fixed_persons.size() < 2) {
         // 如果不足2个人，无法进行分组，直接返回
-        cerr << "警告：厅内保障任务固定人选不足2人，无法进行分组。当前人数: " << hall_fixed_persons.size() << endl;
+        LOG_WARN("警告：厅内保障任务固定人选不足2人，无法进行分组。当前人数: " << hall_fixed_persons.size());
         return;
     }
     
     if (hall_fixed_persons.size() < 4) {
-        cerr << "警告：厅内保障任务固定人选不足4人，当前人数: " << hall_fixed_persons.size() << "，将使用现有人员进行分配" << endl;
+        LOG_WARN("警告：厅内保障任务固定人选不足4人，当前人数: " << hall_fixed_persons.size() << "，将使用现有人员进行分配");
     }
     
     // 将人员分为两组：根据第一次值守次数决定
     vector<string> group1, group2;
     bool group1_starts_first = true;  // 记录group1是否先值守
     
+    bool first_group_leads = isFirstHallGroupLeading(hall_fixed_persons, firstShiftCounts());
     if (hall_fixed_persons.size() == 4) {
         // 4个人：分成两组，每组2人
-        int sum1 = getFirstShiftCount(hall_fixed_persons[0]) + getFirstShiftCount(hall_fixed_persons[1]);
-        int sum2 = getFirstShiftCount(hall_fixed_persons[2]) + getFirstShiftCount(hall_fixed_persons[3]);
-        
-        if (sum1 <= sum2) {
+        if (first_group_leads) {
             // 第一组先值守
             group1.push_back(hall_fixed_persons[0]);
             group1.push_back(hall_fixed_persons[1]);
@@ -831,10 +940,7 @@ void TaskScheduler::scheduleHallMaintenanceTasks(vector<TaskDefinition>& tasks,
         }
     } else if (hall_fixed_persons.size() == 3) {
         // 3个人：第一组2人，第二组1人
-        int sum1 = getFirstShiftCount(hall_fixed_persons[0]) + getFirstShiftCount(hall_fixed_persons[1]);
-        int sum2 = getFirstShiftCount(hall_fixed_persons[2]);
-        
-        if (sum1 <= sum2) {
+        if (first_group_leads) {
             group1.push_back(hall_fixed_persons[0]);
             group1.push_back(hall_fixed_persons[1]);
             group2.push_back(hall_fixed_persons[2]);
@@ -847,10 +953,7 @@ void TaskScheduler::scheduleHallMaintenanceTasks(vector<TaskDefinition>& tasks,
         }
     } else if (hall_fixed_persons.size() == 2) {
         // 2个人：每组1人
-        int sum1 = getFirstShiftCount(hall_fixed_persons[0]);
-        int sum2 = getFirstShiftCount(hall_fixed_persons[1]);
-        
-        if (sum1 <= sum2) {
+        if (first_group_leads) {
             group1.push_back(hall_fixed_persons[0]);
             group2.push_back(hall_fixed_persons[1]);
             group1_starts_first = true;
@@ -864,42 +967,25 @@ void TaskScheduler::scheduleHallMaintenanceTasks(vector<TaskDefinition>& tasks,
     // 收集所有厅内保障任务ID（包括国内厅内早班和1小时为粒度的任务）
     // 使用任务ID而不是指针，避免在添加操作间任务时指针失效
     vector<string> hall_task_ids;
-    static const TaskType hall_task_types[] = {
-        TaskType::DOMESTIC_HALL_EARLY,      // 国内厅内早班（05:30-08:30）
-        TaskType::DOMESTIC_HALL_0830_0930, TaskType::DOMESTIC_HALL_0930_1030,
-        TaskType::DOMESTIC_HALL_1030_1130, TaskType::DOMESTIC_HALL_1130_1230,
-        TaskType::DOMESTIC_HALL_1230_1330, TaskType::DOMESTIC_HALL_1330_1430,
-        TaskType::DOMESTIC_HALL_1430_1530, TaskType::DOMESTIC_HALL_1530_1630,
-        TaskType::DOMESTIC_HALL_1630_1730, TaskType::DOMESTIC_HALL_1730_1830,
-        TaskType::DOMESTIC_HALL_1830_1930, TaskType::DOMESTIC_HALL_1930_2030,
-        TaskType::DOMESTIC_HALL_2030_AFTER
-    };
-    cerr << "[DEBUG] 开始收集厅内保障任务，任务总数: " << tasks.size() << endl;
+    LOG_DEBUG("[DEBUG] 开始收集厅内保障任务，任务总数: " << tasks.size());
     for (auto& task : tasks) {
-        bool is_hall_task = false;
-        for (const auto& hall_task_type : hall_task_types) {
-            if (task.getTaskType() == hall_task_type) {
-                is_hall_task = true;
-                break;
-            }
-        }
-        if (is_hall_task) {
+        if (isHallMaintenanceTask(task.getTaskType())) {
             hall_task_ids.push_back(task.getTaskId());
-            cerr << "[DEBUG] 找到厅内保障任务: ID=" << task.getTaskId() 
-                 << ", 名称=" << task.getTaskName()
-                 << ", 类型=" << static_cast<int>(task.getTaskType())
-                 << ", 指针=" << static_cast<void*>(&task)
-                 << ", 开始时间=" << task.getStartTime()
-                 << ", 已分配人数=" << task.getAssignedEmployeeCount() << endl;
+            LOG_DEBUG("[DEBUG] 找到厅内保障任务: ID=" << task.getTaskId()
+                      << ", 名称=" << task.getTaskName()
+                      << ", 类型=" << static_cast<int>(task.getTaskType())
+                      << ", 指针=" << static_cast<void*>(&task)
+                      << ", 开始时间=" << task.getStartTime()
+                      << ", 已分配人数=" << task.getAssignedEmployeeCount());
         }
     }
     
     if (hall_task_ids.empty()) {
-        cerr << "警告：未找到任何厅内保障任务，任务总数: " << tasks.size() << endl;
+        LOG_WARN("警告：未找到任何厅内保障任务，任务总数: " << tasks.size());
         return;
     }
     
-    cerr << "找到 " << hall_task_ids.size() << " 个厅内保障任务，固定人选 " << hall_fixed_persons.size() << " 人" << endl;
+    LOG_INFO("找到 " << hall_task_ids.size() << " 个厅内保障任务，固定人选 " << hall_fixed_persons.size() << " 人");
     
     // 按时间排序（通过task_ptr_map获取指针）
     sort(hall_task_ids.begin(), hall_task_ids.end(), 
@@ -923,19 +1009,19 @@ void TaskScheduler::scheduleHallMaintenanceTasks(vector<TaskDefinition>& tasks,
         // 通过task_ptr_map获取任务指针，确保使用最新指针（避免指针失效）
         auto task_it = task_ptr_map.find(task_id);
         if (task_it == task_ptr_map.end() || task_it->second == nullptr) {
-            cerr << "[ERROR] 任务ID=" << task_id << " 不在指针映射中或指针为空！跳过" << endl;
+            LOG_ERROR("[ERROR] 任务ID=" << task_id << " 不在指针映射中或指针为空！跳过");
             continue;
         }
         
         TaskDefinition* task = task_it->second;
         long task_start = task->getStartTime();
         
-        cerr << "[DEBUG] 开始处理厅内任务 ID=" << task_id 
-             << ", 名称=" << task->getTaskName()
-             << ", 指针=" << static_cast<void*>(task)
-             << ", 开始时间=" << task_start
-             << ", 需要人数=" << task->getRequiredCount()
-             << ", 当前已分配=" << task->getAssignedEmployeeCount() << endl;
+        LOG_DEBUG("[DEBUG] 开始处理厅内任务 ID=" << task_id
+                  << ", 名称=" << task->getTaskName()
+                  << ", 指针=" << static_cast<void*>(task)
+                  << ", 开始时间=" << task_start
+                  << ", 需要人数=" << task->getRequiredCount()
+                  << ", 当前已分配=" << task->getAssignedEmployeeCount());
         
         // 如果是第一个任务，根据分组决策设置group1_on_duty
         if (first_task) {
@@ -953,8 +1039,8 @@ void TaskScheduler::scheduleHallMaintenanceTasks(vector<TaskDefinition>& tasks,
         const auto& on_duty_group = group1_on_duty ? group1 : group2;
         const auto& off_duty_group = group1_on_duty ? group2 : group1;
         
-        cerr << "[DEBUG] 任务ID=" << task_id << " 值守组=" << (group1_on_duty ? "group1" : "group2")
-             << ", 值守组人数=" << on_duty_group.size() << endl;
+        LOG_DEBUG("[DEBUG] 任务ID=" << task_id << " 值守组=" << (group1_on_duty ? "group1" : "group2")
+                  << ", 值守组人数=" << on_duty_group.size());
         
         // 为值守组分配厅内保障任务（维护双向映射：任务->员工 和 员工->任务）
         for (const auto& employee_id : on_duty_group) {
@@ -967,15 +1053,15 @@ void TaskScheduler::scheduleHallMaintenanceTasks(vector<TaskDefinition>& tasks,
                 if (employee) {
                     employee->addAssignedTaskId(task->getTaskId());
                 }
-                cerr << "[DEBUG] 任务ID=" << task_id << " 分配给员工 " << employee_id << endl;
+                LOG_DEBUG("[DEBUG] 任务ID=" << task_id << " 分配给员工 " << employee_id);
             }
         }
         
         // 如果任务需要的人数超过值守组人数，从另一组补充（维护双向映射）
         int assigned_count = static_cast<int>(task->getAssignedEmployeeCount());
         int required_count = task->getRequiredCount();
-        cerr << "[DEBUG] 任务ID=" << task_id << " 已分配=" << assigned_count 
-             << ", 需要=" << required_count << endl;
+        LOG_DEBUG("[DEBUG] 任务ID=" << task_id << " 已分配=" << assigned_count
+                  << ", 需要=" << required_count);
         
         if (assigned_count < required_count) {
             for (const auto& employee_id : off_duty_group) {
@@ -990,27 +1076,16 @@ void TaskScheduler::scheduleHallMaintenanceTasks(vector<TaskDefinition>& tasks,
                         employee->addAssignedTaskId(task->getTaskId());
                     }
                     assigned_count++;
-                    cerr << "[DEBUG] 任务ID=" << task_id << " 从非值守组补充分配给员工 " << employee_id << endl;
+                    LOG_DEBUG("[DEBUG] 任务ID=" << task_id << " 从非值守组补充分配给员工 " << employee_id);
                 }
             }
         }
         
         // 为不值守的组分配操作间任务（允许完全重叠）
         // 操作间任务的时间段与厅内保障任务相同（不值守的组在这个时间段做操作间任务）
-        scheduleOperationRoomTasks(tasks, shifts, task_ptr_map, off_duty_group,
+        scheduleOperationRoomTasks(shifts, task_ptr_map, off_duty_group,
                                     task->getStartTime(), task->getEndTime());
         
-        // 在添加操作间任务后，重新从task_ptr_map获取任务指针，确保使用最新指针
-        // 虽然已经预留了容量，但为了安全起见，还是重新获取指针
-        auto updated_task_it = task_ptr_map.find(task_id);
-        if (updated_task_it != task_ptr_map.end() && updated_task_it->second != nullptr) {
-            task = updated_task_it->second;
-            cerr << "[DEBUG] 任务ID=" << task_id << " 在添加操作间任务后，重新获取指针=" 
-                 << static_cast<void*>(task) << endl;
-        } else {
-            cerr << "[ERROR] 任务ID=" << task_id << " 在添加操作间任务后，无法从映射中获取指针！" << endl;
-        }
-        
         // 更新第一次值守次数（只在第一次任务且group1先值守时增加）
         if (!first_shift_count_incremented && group1_on_duty && group1_starts_first) {
             for (const auto& employee_id : group1) {
@@ -1030,68 +1105,56 @@ void TaskScheduler::scheduleHallMaintenanceTasks(vector<TaskDefinition>& tasks,
         
         // 验证分配结果
         int final_assigned = static_cast<int>(task->getAssignedEmployeeCount());
-        cerr << "[DEBUG] 任务ID=" << task_id << " 分配完成，最终已分配人数=" << final_assigned 
-             << ", 任务指针=" << static_cast<void*>(task) << endl;
+        LOG_DEBUG("[DEBUG] 任务ID=" << task_id << " 分配完成，最终已分配人数=" << final_assigned
+                  << ", 任务指针=" << static_cast<void*>(task));
         
         if (final_assigned == 0) {
-            cerr << "[ERROR] 警告：任务ID=" << task->getTaskId() << " (" << task->getTaskName() 
-                 << ") 在scheduleHallMaintenanceTasks结束后仍未被分配，任务指针=" 
-                 << static_cast<void*>(task) << endl;
+            LOG_ERROR("[ERROR] 警告：任务ID=" << task->getTaskId() << " (" << task->getTaskName()
+                      << ") 在scheduleHallMaintenanceTasks结束后仍未被分配，任务指针="
+                      << static_cast<void*>(task));
         } else {
-            cout << "厅内任务ID=" << task->getTaskId() << " (" << task->getTaskName() 
-                 << ") 已分配 " << final_assigned << " 人" << endl;
+            LOG_DEBUG("厅内任务ID=" << task->getTaskId() << " (" << task->getTaskName()
+                      << ") 已分配 " << final_assigned << " 人");
         }
     }
     
-    cerr << "厅内保障任务分配完成，共处理 " << hall_task_ids.size() << " 个任务" << endl;
+    LOG_INFO("厅内保障任务分配完成，共处理 " << hall_task_ids.size() << " 个任务");
     
     // 验证所有厅内保障任务的分配状态（通过task_ptr_map验证）
-    cerr << "[DEBUG] 开始验证厅内保障任务的分配状态..." << endl;
+    LOG_DEBUG("[DEBUG] 开始验证厅内保障任务的分配状态...");
     for (const string& task_id : hall_task_ids) {
         auto it = task_ptr_map.find(task_id);
         if (it != task_ptr_map.end() && it->second != nullptr) {
             TaskDefinition* mapped_task = it->second;
             int assigned_count = static_cast<int>(mapped_task->getAssignedEmployeeCount());
-            cerr << "[DEBUG] 任务ID=" << task_id << " 验证通过: 已分配人数=" 
-                 << assigned_count << ", 指针=" << static_cast<void*>(mapped_task) << endl;
+            LOG_DEBUG("[DEBUG] 任务ID=" << task_id << " 验证通过: 已分配人数="
+                      << assigned_count << ", 指针=" << static_cast<void*>(mapped_task));
             if (assigned_count == 0) {
-                cerr << "[ERROR] 任务ID=" << task_id << " (" << mapped_task->getTaskName() 
-                     << ") 验证失败：分配后仍为0人！" << endl;
+                LOG_ERROR("[ERROR] 任务ID=" << task_id << " (" << mapped_task->getTaskName()
+                          << ") 验证失败：分配后仍为0人！");
             }
         } else {
-            cerr << "[ERROR] 任务ID=" << task_id 
-                 << " 不在任务指针映射中或指针为空！" << endl;
+            LOG_ERROR("[ERROR] 任务ID=" << task_id
+                      << " 不在任务指针映射中或指针为空！");
         }
     }
-    cerr << "[DEBUG] 厅内保障任务分配状态验证完成" << endl;
+    LOG_DEBUG("[DEBUG] 厅内保障任务分配状态验证完成");
 }
 
-void TaskScheduler::scheduleOperationRoomTasks(vector<TaskDefinition>& tasks,
-                                               const vector<Shift>& shifts,
+void TaskScheduler::scheduleOperationRoomTasks(const vector<Shift>& shifts,
                                                map<string, TaskDefinition*>& task_ptr_map,
                                                const vector<string>& off_duty_employees,
                                                long time_slot_start,
                                                long time_slot_end)
 {
-    // 查找或创建操作间任务
-    TaskDefinition* operation_task = nullptr;
-    for (auto& task : tasks) {
-        if (task.getTaskType() == TaskType::OPERATION_ROOM &&
-            task.getStartTime() == time_slot_start &&
-            task.getEndTime() == time_slot_end) {
-            operation_task = &task;
-            break;
-        }
-    }
+    // 查找或创建操作间任务（按类型和时间段索引，O(1)）
+    bool created = false;
+    TaskDefinition* operation_task = generated_tasks_.findOrCreate(
+        TaskType::OPERATION_ROOM, time_slot_start, time_slot_end, &created);
     
-    // 如果不存在，创建一个新的操作间任务
-    if (!operation_task) {
-        tasks.emplace_back();
-        operation_task = &tasks.back();
-        operation_task->setTaskType(TaskType::OPERATION_ROOM);
+    // 如果不存在，初始化新建的操作间任务
+    if (created) {
         operation_task->setTaskName("操作间任务");
-        operation_task->setStartTime(time_slot_start);
-        operation_task->setEndTime(time_slot_end);
         operation_task->setRequiredCount(2);
         operation_task->setAllowOverlap(true);  // 允许重叠
         operation_task->setMaxOverlapTime(60);  // 最大重叠时间60秒
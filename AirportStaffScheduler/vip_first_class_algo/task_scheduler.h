@@ -10,6 +10,8 @@
 
 #include "task_definition.h"
 #include "shift.h"
+#include "task_arena.h"
+#include "../BreakTimeline.h"
 #include "../CommonAdapterUtils.h"
 #include <vector>
 #include <map>
@@ -20,6 +22,9 @@ namespace AirportStaffScheduler {
     class Task;
     class Shift;
     class Staff;
+    namespace Model {
+        class DayModel;
+    }
 }
 
 namespace vip_first_class {
@@ -61,6 +66,25 @@ public:
                                  const std::vector<AirportStaffScheduler::Shift>& shifts,
                                  const std::vector<AirportStaffScheduler::Staff>& staffs);
     
+    /**
+     * @brief 调度任务（使用单日模型）
+     * 
+     * 直接从模型生成任务和班次，调度后把分配结果回写到模型
+     * @param model 单日模型
+     */
+    void scheduleTasksFromModel(AirportStaffScheduler::Model::DayModel& model);
+    
+    /**
+     * @brief 设置员工休息（默认没有休息；scheduleTasksFromModel从模型的break.csv读取）
+     * @param breaks 休息列表：锁定休息期间不派工，未锁定的用餐在浮动窗口内随派工挪到空档
+     */
+    void setBreaks(const vector<AirportStaffScheduler::Breaks::StaffBreak>& breaks) { breaks_ = breaks; }
+    
+    /**
+     * @brief 获取最近一次调度后每名员工的休息位置（按setBreaks的顺序）
+     */
+    const vector<AirportStaffScheduler::Breaks::BreakPlacement>& getBreakPlacements() const { return break_placements_; }
+    
     /**
      * @brief 重置第一次值守次数统计（用于新的一天）
      */
@@ -78,6 +102,29 @@ public:
      * @param employee_id 员工ID
      */
     static void incrementFirstShiftCount(const string& employee_id);
+    
+    /**
+     * @brief 获取所有员工的第一次值守次数（用于跨天保存）
+     * @return 员工ID到次数的映射
+     */
+    static const map<string, int>& getFirstShiftCounts();
+    
+    /**
+     * @brief 设置所有员工的第一次值守次数（用于跨天恢复）
+     * @param counts 员工ID到次数的映射
+     */
+    static void setFirstShiftCounts(const map<string, int>& counts);
+    
+    /**
+     * @brief 判断厅内保障任务的第一组（固定人选的前半部分）是否先值守
+     * 
+     * 第一次值守次数之和较少（或相等）的一组先值守
+     * @param hall_fixed_persons 厅内保障任务固定人选（2~4人）
+     * @param first_shift_counts 员工ID到第一次值守次数的映射
+     * @return true表示第一组先值守
+     */
+    static bool isFirstHallGroupLeading(const vector<string>& hall_fixed_persons,
+                                        const map<string, int>& first_shift_counts);
 
 private:
     /**
@@ -92,20 +139,32 @@ private:
     
     /**
      * @brief 为不值守的员工分配操作间任务
-     * @param tasks 任务列表
+     * 
+     * 操作间任务在generated_tasks_中查找或创建，不会改变tasks，已有任务指针保持有效
      * @param shifts 班次列表
      * @param task_ptr_map 任务ID到TaskDefinition指针的映射
      * @param on_duty_employees 正在值守的员工ID列表
      * @param time_slot_start 时间段开始时间
      * @param time_slot_end 时间段结束时间
      */
-    void scheduleOperationRoomTasks(vector<TaskDefinition>& tasks,
-                                    const vector<Shift>& shifts,
+    void scheduleOperationRoomTasks(const vector<Shift>& shifts,
                                     map<string, TaskDefinition*>& task_ptr_map,
                                     const vector<string>& off_duty_employees,
                                     long time_slot_start,
                                     long time_slot_end);
     
+    // 调度过程中生成的任务（操作间任务等），调度结束时追加到任务列表
+    TaskArena generated_tasks_;
+    
+    // 员工休息和调度后的休息位置
+    vector<AirportStaffScheduler::Breaks::StaffBreak> breaks_;
+    vector<AirportStaffScheduler::Breaks::BreakPlacement> break_placements_;
+    
+    /**
+     * @brief 当前线程可见的第一次值守次数（绑定了SchedulingContext时为上下文中的副本）
+     */
+    static map<string, int>& firstShiftCounts();
+    
     // 静态成员：跟踪每个员工作为第一次值守的次数（全局字段）
     static map<string, int> first_shift_counts_;
 };
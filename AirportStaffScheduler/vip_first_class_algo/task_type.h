@@ -2,7 +2,9 @@
  * @file task_type.h
  * @brief 任务类型枚举
  * 
- * 定义所有任务类型的枚举，基于 Task.txt 文件生成
+ * 定义所有任务类型的枚举，基于 Task.txt 文件生成；
+ * 每个类型的固定属性（厅内分类、默认优先级）放在按枚举值下标的constexpr表中，
+ * 调度时的任务分类只是一次数组读取
  */
 
 #ifndef VIP_FIRST_CLASS_TASK_TYPE_H
@@ -69,6 +71,99 @@ enum class TaskType {
     OPERATION_ROOM = 31                          ///< 操作间任务
 };
 
+const int TASK_TYPE_COUNT = 32;  ///< 任务类型个数（枚举值为0..TASK_TYPE_COUNT-1）
+
+/**
+ * @brief 厅内任务分类
+ */
+enum class HallKind {
+    NONE = 0,            ///< 非厅内任务
+    INTERNATIONAL = 1,   ///< 国际厅内
+    DOMESTIC = 2         ///< 国内厅内（厅内保障任务，单独排班）
+};
+
+/**
+ * @brief 任务类型的固定属性
+ */
+struct TaskTypeTraits {
+    HallKind hall;        ///< 厅内分类
+    int priority;         ///< 默认优先级（数值越大优先级越高）
+};
+
+/**
+ * @brief 任务类型属性表（按枚举值下标）
+ * 
+ * 优先级顺序：调度类 = 前台 > 外场 > 厅内 > 前台协助 > 操作间
+ */
+constexpr TaskTypeTraits TASK_TYPE_TRAITS[TASK_TYPE_COUNT] = {
+    {HallKind::NONE, 100},          // 调度
+    {HallKind::NONE, 100},          // 国内前台
+    {HallKind::NONE, 40},           // 国内前台协助
+    {HallKind::NONE, 40},           // 国内前台协助2
+    {HallKind::NONE, 100},          // 国内前台早班
+    {HallKind::NONE, 100},          // 国际前台早班
+    {HallKind::NONE, 100},          // 国际前台晚班
+    {HallKind::INTERNATIONAL, 60},  // 国际厅内早班
+    {HallKind::INTERNATIONAL, 60},  // 国际厅内晚班
+    {HallKind::DOMESTIC, 60},       // 国内厅内早班
+    {HallKind::DOMESTIC, 60},       // 国内厅内08:30-09:30
+    {HallKind::DOMESTIC, 60},       // 国内厅内09:30-10:30
+    {HallKind::DOMESTIC, 60},       // 国内厅内10:30-11:30
+    {HallKind::DOMESTIC, 60},       // 国内厅内11:30-12:30
+    {HallKind::DOMESTIC, 60},       // 国内厅内12:30-13:30
+    {HallKind::DOMESTIC, 60},       // 国内厅内13:30-14:30
+    {HallKind::DOMESTIC, 60},       // 国内厅内14:30-15:30
+    {HallKind::DOMESTIC, 60},       // 国内厅内15:30-16:30
+    {HallKind::DOMESTIC, 60},       // 国内厅内16:30-17:30
+    {HallKind::DOMESTIC, 60},       // 国内厅内17:30-18:30
+    {HallKind::DOMESTIC, 60},       // 国内厅内18:30-19:30
+    {HallKind::DOMESTIC, 60},       // 国内厅内19:30-20:30
+    {HallKind::DOMESTIC, 60},       // 国内厅内20:30-航后
+    {HallKind::NONE, 80},           // 外场（国内出港-少人）
+    {HallKind::NONE, 80},           // 外场（国内出港-多人）
+    {HallKind::NONE, 80},           // 外场（国内进港-少人）
+    {HallKind::NONE, 80},           // 外场（国内进港-多人）
+    {HallKind::NONE, 80},           // 外场（国际出港-少人）
+    {HallKind::NONE, 80},           // 外场（国际出港-多人）
+    {HallKind::NONE, 80},           // 外场（国际进港-少人）
+    {HallKind::NONE, 80},           // 外场（国际进港-多人）
+    {HallKind::NONE, 30}            // 操作间
+};
+
+/**
+ * @brief 任务类型是否在属性表范围内
+ */
+constexpr bool isKnownTaskType(TaskType type) {
+    return static_cast<int>(type) >= 0 && static_cast<int>(type) < TASK_TYPE_COUNT;
+}
+
+/**
+ * @brief 任务类型的厅内分类
+ */
+constexpr HallKind hallKindOf(TaskType type) {
+    return isKnownTaskType(type) ? TASK_TYPE_TRAITS[static_cast<int>(type)].hall : HallKind::NONE;
+}
+
+/**
+ * @brief 是否厅内保障任务（国内厅内早班及按1小时划分的国内厅内任务）
+ */
+constexpr bool isHallMaintenanceTask(TaskType type) {
+    return hallKindOf(type) == HallKind::DOMESTIC;
+}
+
+/**
+ * @brief 任务类型的默认优先级（未知类型为0）
+ */
+constexpr int defaultTaskPriority(TaskType type) {
+    return isKnownTaskType(type) ? TASK_TYPE_TRAITS[static_cast<int>(type)].priority : 0;
+}
+
+static_assert(TASK_TYPE_COUNT == static_cast<int>(TaskType::OPERATION_ROOM) + 1 &&
+              isHallMaintenanceTask(TaskType::DOMESTIC_HALL_2030_AFTER) &&
+              !isHallMaintenanceTask(TaskType::EXTERNAL_INTERNATIONAL_ARRIVAL_MANY) &&
+              defaultTaskPriority(TaskType::OPERATION_ROOM) == 30,
+              "TASK_TYPE_TRAITS must match TaskType");
+
 }  // namespace vip_first_class
 
 #endif  // VIP_FIRST_CLASS_TASK_TYPE_H
@@ -12,7 +12,11 @@
 #include "shift.h"
 #include "task_definition.h"
 #include "task_type.h"
+#include "rolling_horizon_scheduler.h"
 #include "../CSVDataLoader.h"
+#include "../Profiler.h"
+#include "../Logger.h"
+#include "../PlanWriter.h"
 #include <iostream>
 #include <fstream>
 #include <sstream>
@@ -23,6 +27,7 @@
 #include <algorithm>
 
 using namespace vip_first_class;
+using AirportStaffScheduler::Output::SolnShiftWriter;
 
 // 辅助函数：将时间字符串（如"08:30"）转换为从2020-01-01 00:00:00开始的秒数
 static int64_t parseTimeString(const std::string& time_str) {
@@ -127,76 +132,9 @@ static std::string formatTime(int64_t seconds) {
     return oss.str();
 }
 
-// 辅助函数：将秒数和任务日期转换为日期时间字符串（YYYY-MM-DD HH:MM:SS格式）
-// 基准日期：2020-01-01 00:00:00
-static std::string formatDateTime(int64_t seconds, const std::string& task_date = "") {
-    if (seconds <= 0) {
-        return "";
-    }
-    
-    // 如果提供了任务日期，使用任务日期作为日期部分
-    if (!task_date.empty()) {
-        // 从任务日期中提取日期部分（YYYY-MM-DD）
-        std::string date_part = task_date;
-        // 移除可能的引号
-        if (date_part.front() == '"' && date_part.back() == '"') {
-            date_part = date_part.substr(1, date_part.length() - 2);
-        }
-        
-        // 计算时间部分（从当天00:00:00开始的秒数）
-        int64_t days = seconds / 86400;
-        int64_t remaining_seconds = seconds % 86400;
-        
-        // 如果秒数超过一天，需要调整日期
-        // 这里简化处理：假设任务日期就是正确的日期
-        int hours = remaining_seconds / 3600;
-        int minutes = (remaining_seconds % 3600) / 60;
-        int secs = remaining_seconds % 60;
-        
-        std::ostringstream oss;
-        oss << date_part << " "
-            << std::setfill('0') << std::setw(2) << hours << ":"
-            << std::setfill('0') << std::setw(2) << minutes << ":"
-            << std::setfill('0') << std::setw(2) << secs;
-        return oss.str();
-    }
-    
-    // 如果没有提供任务日期，使用基准日期计算
-    int64_t days = seconds / 86400;
-    int64_t remaining_seconds = seconds % 86400;
-    
-    // 使用基准日期2020-01-01
-    int year = 2020;
-    int month = 1;
-    int day = 1;
-    
-    // 累加天数（简化处理，每月30天）
-    day += static_cast<int>(days);
-    while (day > 30) {
-        day -= 30;
-        month++;
-        if (month > 12) {
-            month = 1;
-            year++;
-        }
-    }
-    
-    int hours = static_cast<int>(remaining_seconds / 3600);
-    int minutes = static_cast<int>((remaining_seconds % 3600) / 60);
-    int secs = static_cast<int>(remaining_seconds % 60);
-    
-    std::ostringstream oss;
-    oss << year << "-" 
-        << std::setfill('0') << std::setw(2) << month << "-"
-        << std::setfill('0') << std::setw(2) << day << " "
-        << std::setfill('0') << std::setw(2) << hours << ":"
-        << std::setfill('0') << std::setw(2) << minutes << ":"
-        << std::setfill('0') << std::setw(2) << secs;
-    return oss.str();
-}
-
 // 辅助函数：导出任务分配结果到CSV文件
 static void exportToCSV(const std::vector<TaskDefinition>& tasks, const std::string& filename) {
+    PROFILE_SCOPE_DETAIL("output.write", filename);
     std::ofstream file(filename);
     if (!file.is_open()) {
         std::cerr << "错误：无法创建CSV文件 " << filename << std::endl;
@@ -248,15 +186,14 @@ struct EmployeeTaskSlot {
 static void exportEmployeeScheduleToCSV(const std::vector<TaskDefinition>& tasks, 
                                          const std::vector<Shift>& shifts,
                                          const std::string& filename) {
-    std::ofstream file(filename);
-    if (!file.is_open()) {
+    PROFILE_SCOPE_DETAIL("output.write", filename);
+    // VIP结果历史格式：时间只取当天部分，行末无多余逗号
+    SolnShiftWriter writer(SolnShiftWriter::Format(false, false));
+    if (!writer.open(filename)) {
         std::cerr << "错误：无法创建CSV文件 " << filename << std::endl;
         return;
     }
     
-    // 写入CSV表头（按照soln_shift.csv格式）
-    file << "班期日期,班期开始时间,班期结束时间,人员编号,人员姓名,车辆（车牌号）,车辆类型,任务ID,任务名称,任务日期,任务开始时间,任务结束时间,到达航班ID,出发航班ID,到达航班号,出发航班号,航站楼,区域,机位,其他位置,双机航班号,是否加班\n";
-    
     // 收集每个员工的任务时间段
     std::map<std::string, std::vector<EmployeeTaskSlot>> employee_schedule;
     
@@ -335,128 +272,30 @@ static void exportEmployeeScheduleToCSV(const std::vector<TaskDefinition>& tasks
             shift_date = schedule_it->second[0].task_ptr->getTaskDate();
         }
         
-        // 获取班期开始时间（第一个任务的开始时间）
+        // 班期开始时间（第一个任务的开始时间）和结束时间（最晚的任务的结束时间）
         int64_t shift_start_time = schedule_it->second[0].start_time;
-        std::string shift_start_str = formatDateTime(shift_start_time, shift_date);
-        
-        // 获取班期结束时间（最晚的任务的结束时间）
         int64_t shift_end_time = 0;
         for (const auto& task_slot : schedule_it->second) {
             if (task_slot.end_time > shift_end_time) {
                 shift_end_time = task_slot.end_time;
             }
         }
-        std::string shift_end_str = formatDateTime(shift_end_time, shift_date);
         
-        // 输出每个任务
+        // 该员工的任务行直接写出
+        writer.beginStaff(shift_date, shift_start_time, shift_end_time,
+                          employee_id, employee->getEmployeeName());
         for (const auto& task_slot : schedule_it->second) {
             if (!task_slot.task_ptr) {
                 continue;
             }
-            
-            const TaskDefinition& task = *(task_slot.task_ptr);
-            
-            // 班期日期
-            file << "\"" << shift_date << "\",";
-            
-            // 班期开始时间
-            file << "\"" << shift_start_str << "\",";
-            
-            // 班期结束时间
-            file << "\"" << shift_end_str << "\",";
-            
-            // 人员编号
-            file << "\"" << employee_id << "\",";
-            
-            // 人员姓名
-            file << "\"" << employee->getEmployeeName() << "\",";
-            
-            // 车辆（车牌号）- 不输出
-            file << "\"\",";
-            
-            // 车辆类型 - 不输出
-            file << "\"\",";
-            
-            // 任务ID
-            file << "\"" << task.getTaskId() << "\",";
-            
-            // 任务名称
-            file << "\"" << task.getTaskName() << "\",";
-            
-            // 任务日期
-            file << "\"" << task.getTaskDate() << "\",";
-            
-            // 任务开始时间（实际开始时间）
-            std::string task_start_str = formatDateTime(task_slot.start_time, task.getTaskDate());
-            file << "\"" << task_start_str << "\",";
-            
-            // 任务结束时间（实际开始时间 + 时长）
-            std::string task_end_str = formatDateTime(task_slot.end_time, task.getTaskDate());
-            file << "\"" << task_end_str << "\",";
-            
-            // 到达航班ID
-            std::string arrival_flight_id = task.getArrivalFlightId();
-            if (arrival_flight_id.empty()) {
-                file << "\"\",";
-            } else {
-                file << "\"" << arrival_flight_id << "\",";
-            }
-            
-            // 出发航班ID
-            std::string departure_flight_id = task.getDepartureFlightId();
-            if (departure_flight_id.empty()) {
-                file << "\"\",";
-            } else {
-                file << "\"" << departure_flight_id << "\",";
-            }
-            
-            // 到达航班号
-            std::string arrival_flight_number = task.getArrivalFlightNumber();
-            if (arrival_flight_number.empty()) {
-                file << "\"\",";
-            } else {
-                file << "\"" << arrival_flight_number << "\",";
-            }
-            
-            // 出发航班号
-            std::string departure_flight_number = task.getDepartureFlightNumber();
-            if (departure_flight_number.empty()) {
-                file << "\"\",";
-            } else {
-                file << "\"" << departure_flight_number << "\",";
-            }
-            
-            // 航站楼
-            std::string terminal = task.getTerminal();
-            if (terminal.empty()) {
-                file << "\"\",";
-            } else {
-                file << "\"" << terminal << "\",";
-            }
-            
-            // 区域 - 不输出
-            file << "\"\",";
-            
-            // 机位
-            int stand = task.getStand();
-            if (stand == 0) {
-                file << "\"\",";
-            } else {
-                file << "\"" << stand << "\",";
-            }
-            
-            // 其他位置 - 不输出
-            file << "\"\",";
-            
-            // 双机航班号 - 不输出
-            file << "\"\",";
-            
-            // 是否加班 - 全部都是"否"
-            file << "\"否\"\n";
+            writer.writeTask(*task_slot.task_ptr, task_slot.start_time, task_slot.end_time);
         }
     }
     
-    file.close();
+    if (!writer.close()) {
+        std::cerr << "错误：写入CSV文件失败 " << filename << std::endl;
+        return;
+    }
     std::cout << "员工时间表已导出到: " << filename << std::endl;
 }
 
@@ -481,6 +320,7 @@ static int getTimePosition(int64_t seconds) {
 static void exportGanttChartText(const std::vector<TaskDefinition>& tasks,
                                   const std::vector<Shift>& shifts,
                                   const std::string& filename) {
+    PROFILE_SCOPE_DETAIL("output.write", filename);
     std::ofstream file(filename);
     if (!file.is_open()) {
         std::cerr << "错误：无法创建文件 " << filename << std::endl;
@@ -638,6 +478,56 @@ static void exportGanttChartText(const std::vector<TaskDefinition>& tasks,
     std::cout << "甘特图文本时间表已导出到: " << filename << std::endl;
 }
 
+// 辅助函数：多日窗口并行调度与逐日调度的结果是否一致（在非默认任务配置下检查，
+// 确认工作线程看到的是调用线程的配置和员工信息）
+static bool checkRollingWindows(const std::vector<TaskDefinition>& tasks, const std::vector<Shift>& shifts) {
+    std::vector<EmployeeInfo> employees;
+    for (const auto& pair : EmployeeManager::getInstance().getAllEmployees()) {
+        employees.push_back(pair.second);
+    }
+    DayLoader loader = [&](const std::string& day, DayInput& input) {
+        input.tasks = tasks;
+        input.shifts = shifts;
+        input.employees = employees;
+        return true;
+    };
+
+    // 非默认配置：调度任务改为固定副1、国际前台晚班优先级最高
+    TaskConfig& config = TaskConfig::getInstance();
+    config.addFixedPersonByType(TaskType::DISPATCH, FixedPersonInfo(ShiftCategory::SUB, 1));
+    config.setTaskPriority(TaskType::INTERNATIONAL_FRONT_DESK_LATE, 1000);
+
+    std::vector<std::string> days;
+    for (int d = 1; d <= 6; ++d) {
+        days.push_back("day" + std::to_string(d));
+    }
+    RollingHorizonScheduler sequential;
+    sequential.setDayLoader(loader);
+    sequential.setInitialState(FairnessState());
+    std::vector<DayResult> expected = sequential.run(days);
+
+    RollingHorizonScheduler windowed;
+    windowed.setDayLoader(loader);
+    windowed.setInitialState(FairnessState());
+    std::vector<DayResult> actual = windowed.runWindows(days, 2, 3);
+    AirportStaffScheduler::Logging::flush();
+
+    bool same = expected.size() == actual.size();
+    for (size_t d = 0; same && d < expected.size(); ++d) {
+        same = expected[d].tasks.size() == actual[d].tasks.size();
+        for (size_t t = 0; same && t < expected[d].tasks.size(); ++t) {
+            const TaskDefinition& a = expected[d].tasks[t];
+            const TaskDefinition& b = actual[d].tasks[t];
+            same = a.getTaskId() == b.getTaskId() && a.getStartTime() == b.getStartTime() &&
+                   a.getAssignedEmployeeIds() == b.getAssignedEmployeeIds();
+        }
+        if (!same) {
+            std::cerr << "ERROR: 窗口并行调度与逐日调度结果不一致: " << expected[d].day << std::endl;
+        }
+    }
+    return same;
+}
+
 int main() {
     std::cout << "开始任务调度测试..." << std::endl;
     
@@ -755,8 +645,10 @@ int main() {
     std::cout << "Total shifts: " << shifts.size() << std::endl;
     std::cout << "Total employees in manager: " << EmployeeManager::getInstance().getEmployeeCount() << std::endl;
     
+    std::vector<TaskDefinition> original_tasks = tasks;
     TaskScheduler scheduler;
     scheduler.scheduleTasks(tasks, shifts);
+    AirportStaffScheduler::Logging::flush();
     
     // 检查任务分配情况
     int assigned_count = 0;
@@ -790,6 +682,21 @@ int main() {
     std::cout << "  2. result.csv - 员工时间表（soln_shift.csv格式）" << std::endl;
     std::cout << "  3. employee_schedule_gantt.txt - 员工时间表（甘特图文本）" << std::endl;
     
+    // 6. 多日窗口并行调度一致性检查
+    std::cout << "\nStep 5: Checking windowed rolling-horizon scheduling..." << std::endl;
+    if (!checkRollingWindows(original_tasks, shifts)) {
+        return 1;
+    }
+    std::cout << "窗口并行调度与逐日调度结果一致" << std::endl;
+    
+    // 8. 性能剖析结果（以-DAIRPORT_SCHEDULER_PROFILING编译时）
+    if (AirportStaffScheduler::Profiling::isEnabled()) {
+        AirportStaffScheduler::Profiling::writeChromeTrace("vip_profile_trace.json");
+        std::cout << "  4. vip_profile_trace.json - 各阶段耗时（Chrome trace格式）" << std::endl;
+        std::cout << "\n=== 阶段耗时 ===" << std::endl;
+        AirportStaffScheduler::Profiling::printSummary(std::cout);
+    }
+    
     return 0;
 }
 
@@ -0,0 +1,146 @@
+/**
+ * @file vip_model_view.cpp
+ * @brief VIP/头等舱模块的单日模型视图实现
+ */
+
+#include "vip_model_view.h"
+#include "employee_manager.h"
+#include "../CommonAdapterUtils.h"
+#include <iostream>
+
+namespace vip_first_class {
+
+using namespace std;
+using AirportStaffScheduler::Model::DayModel;
+
+VipModelView::VipModelView(DayModel& model)
+    : model_(model)
+{
+}
+
+VipModelView::~VipModelView()
+{
+}
+
+bool VipModelView::buildTasks(vector<TaskDefinition>& tasks) const
+{
+    tasks.clear();
+    const auto& t = model_.tasks;
+    const auto& pool = model_.strings;
+    tasks.reserve(t.size());
+    
+    for (size_t row = 0; row < t.size(); ++row) {
+        TaskDefinition task;
+        task.setTaskId(pool.get(t.task_id[row]));
+        task.setTaskName(pool.get(t.task_name[row]));
+        task.setTaskDate(pool.get(t.task_date[row]));
+        task.setArrivalFlightId(pool.get(t.arrival_flight_id[row]));
+        task.setDepartureFlightId(pool.get(t.departure_flight_id[row]));
+        task.setArrivalFlightNumber(pool.get(t.arrival_flight_number[row]));
+        task.setDepartureFlightNumber(pool.get(t.departure_flight_number[row]));
+        task.setTerminal(pool.get(t.terminal[row]));
+        
+        // 时长为0时使用默认值（1小时）
+        long duration = t.duration[row] > 0 ? t.duration[row] : 60 * 60;
+        task.setStartTime(t.start_time[row]);
+        task.setDuration(duration);
+        task.setActualStartTime(0);
+        
+        int stand_num = 0;
+        const string& stand_str = pool.get(t.stand[row]);
+        if (!stand_str.empty()) {
+            try {
+                stand_num = stoi(stand_str);
+            } catch (...) {
+                stand_num = 0;
+            }
+        }
+        task.setStand(stand_num);
+        task.setRequiredCount(t.required_count[row] > 0 ? t.required_count[row] : 1);
+        
+        task.setPreferMainShift(true);
+        task.setCanNewEmployee(false);
+        task.setAssigned(false);
+        task.setShortStaffed(false);
+        // 任务允许重叠，最大重叠时间为任务本身的时间
+        task.setAllowOverlap(true);
+        task.setDuration(duration);
+        task.setRequiredQualification(0);
+        task.setTaskType(TaskType::DISPATCH);
+        
+        tasks.push_back(task);
+    }
+    return !tasks.empty();
+}
+
+void VipModelView::buildShifts(vector<Shift>& shifts) const
+{
+    shifts.clear();
+    const auto& g = model_.groups;
+    const auto& pool = model_.strings;
+    
+    for (size_t group = 0; group < g.size() && group < 8; ++group) {
+        Shift shift;
+        shift.setShiftType(g.shift_type[group]);
+        int position = 1;
+        for (int i = g.member_begin[group]; i < g.member_begin[group + 1]; ++i) {
+            shift.setEmployeeIdAtPosition(position++, pool.get(model_.staff.staff_id[g.members[i]]));
+        }
+        shifts.push_back(shift);
+    }
+}
+
+void VipModelView::buildBreaks(vector<AirportStaffScheduler::Breaks::StaffBreak>& breaks) const
+{
+    breaks.clear();
+    const auto& b = model_.breaks;
+    const auto& pool = model_.strings;
+    breaks.reserve(b.size());
+    for (size_t row = 0; row < b.size(); ++row) {
+        AirportStaffScheduler::Breaks::StaffBreak item;
+        item.staff_id = pool.get(b.staff_id[row]);
+        item.name = pool.get(b.name[row]);
+        item.start = b.start_time[row];
+        item.end = b.end_time[row];
+        item.locked = b.locked[row] != 0;
+        breaks.push_back(item);
+    }
+}
+
+void VipModelView::registerEmployees() const
+{
+    EmployeeManager& emp_manager = EmployeeManager::getInstance();
+    const auto& s = model_.staff;
+    const auto& pool = model_.strings;
+    
+    for (size_t row = 0; row < s.size(); ++row) {
+        EmployeeInfo emp_info;
+        emp_info.setEmployeeId(pool.get(s.staff_id[row]));
+        emp_info.setEmployeeName(pool.get(s.staff_name[row]));
+        emp_info.setQualificationMask(
+            AirportStaffScheduler::Adapter::QualificationStringToMask(pool.get(s.qualification[row])));
+        emp_manager.addOrUpdateEmployee(emp_info.getEmployeeId(), emp_info);
+    }
+}
+
+void VipModelView::commitAssignments(const vector<TaskDefinition>& tasks)
+{
+    for (const auto& task : tasks) {
+        int row = model_.findTaskRow(task.getTaskId());
+        if (row < 0) {
+            // 调度过程中生成的任务（如操作间任务）不在模型中
+            continue;
+        }
+        model_.tasks.actual_start_time[row] = task.getActualStartTime();
+        vector<int>& assigned = model_.tasks.assigned_staff[row];
+        assigned.clear();
+        for (const auto& emp_id : task.getAssignedEmployeeIds()) {
+            int staff_row = model_.findStaffRow(emp_id);
+            if (staff_row >= 0) {
+                assigned.push_back(staff_row);
+            }
+        }
+    }
+}
+
+}  // namespace vip_first_class
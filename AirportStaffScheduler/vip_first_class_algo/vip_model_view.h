@@ -0,0 +1,77 @@
+/**
+ * @file vip_model_view.h
+ * @brief VIP/头等舱模块的单日模型视图
+ * 
+ * 从统一的单日模型（AirportStaffScheduler::Model::DayModel）直接生成任务、班次和员工信息，
+ * 调度完成后把分配结果回写到模型
+ */
+
+#ifndef VIP_FIRST_CLASS_VIP_MODEL_VIEW_H
+#define VIP_FIRST_CLASS_VIP_MODEL_VIEW_H
+
+#include "task_definition.h"
+#include "shift.h"
+#include "../DayModel.h"
+#include "../BreakTimeline.h"
+#include <vector>
+#include <string>
+
+namespace vip_first_class {
+
+using namespace std;
+
+/**
+ * @brief VIP/头等舱模块的单日模型视图
+ * 
+ * 只持有模型引用，不复制模型数据
+ */
+class VipModelView {
+public:
+    /**
+     * @brief 构造函数
+     * @param model 单日模型
+     */
+    explicit VipModelView(AirportStaffScheduler::Model::DayModel& model);
+    
+    /**
+     * @brief 析构函数
+     */
+    ~VipModelView();
+    
+    /**
+     * @brief 生成任务列表（与CSVLoader::loadVIPTasksFromCSV的规则一致）
+     * @param tasks 输出参数，任务列表（按模型行顺序）
+     * @return 模型中有任务返回true
+     */
+    bool buildTasks(vector<TaskDefinition>& tasks) const;
+    
+    /**
+     * @brief 生成班次列表（最多8组，按班组首次出现顺序）
+     * @param shifts 输出参数，班次列表
+     */
+    void buildShifts(vector<Shift>& shifts) const;
+    
+    /**
+     * @brief 生成员工休息列表（break.csv，按文件顺序）
+     * @param breaks 输出参数，休息列表（没有休息文件时为空）
+     */
+    void buildBreaks(vector<AirportStaffScheduler::Breaks::StaffBreak>& breaks) const;
+    
+    /**
+     * @brief 把模型中的人员注册到EmployeeManager
+     */
+    void registerEmployees() const;
+    
+    /**
+     * @brief 把分配结果回写到模型
+     * @param tasks 调度后的任务列表
+     */
+    void commitAssignments(const vector<TaskDefinition>& tasks);
+
+private:
+    AirportStaffScheduler::Model::DayModel& model_;  ///< 单日模型
+};
+
+}  // namespace vip_first_class
+
+#endif  // VIP_FIRST_CLASS_VIP_MODEL_VIEW_H
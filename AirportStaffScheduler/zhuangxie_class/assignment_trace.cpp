@@ -0,0 +1,295 @@
+/**
+ * @file assignment_trace.cpp
+ * @brief 装卸派工解释记录实现
+ */
+
+#include "assignment_trace.h"
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+
+namespace zhuangxie_class {
+
+using namespace std;
+
+namespace {
+
+const char TRACE_MAGIC[4] = {'L', 'D', 'T', 'R'};
+const uint32_t TRACE_VERSION = 7;
+
+// 辅助函数：按内存布局写入/读取定长字段（文件只在同一字节序的机器间交换）
+template <typename T>
+void writeValue(ofstream& file, const T& value) {
+    file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+bool readValue(ifstream& file, T& value) {
+    return static_cast<bool>(file.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
+
+}  // namespace
+
+AssignmentTrace::AssignmentTrace(size_t capacity)
+    : ring_(capacity > 0 ? capacity : 1)
+    , written_(0)
+{
+    clear();
+}
+
+void AssignmentTrace::clear() {
+    written_ = 0;
+    memset(&current_, 0, sizeof(current_));
+    current_.selected_group = -1;
+    memset(&totals_, 0, sizeof(totals_));
+}
+
+void AssignmentTrace::beginTask(size_t task_index) {
+    memset(&current_, 0, sizeof(current_));
+    current_.task_index = static_cast<uint32_t>(task_index);
+    current_.selected_group = -1;
+}
+
+void AssignmentTrace::endRound(size_t available_groups, int selected_group, bool forced) {
+    size_t available = current_.available_groups + available_groups;
+    current_.available_groups = static_cast<uint16_t>(available < UINT16_MAX ? available : UINT16_MAX);
+    totals_.available_groups += available_groups;
+    current_.selected_group = static_cast<int16_t>(selected_group);
+    if (current_.rounds < UINT8_MAX) {
+        current_.rounds++;
+    }
+    if (forced && current_.forced_rounds < UINT8_MAX) {
+        current_.forced_rounds++;
+    }
+}
+
+void AssignmentTrace::endTask(TraceOutcome outcome) {
+    current_.outcome = static_cast<uint8_t>(outcome);
+    ring_[written_ % ring_.size()] = current_;
+    written_++;
+    totals_.outcomes[static_cast<int>(outcome)]++;
+}
+
+vector<TraceRecord> AssignmentTrace::getRecords() const {
+    vector<TraceRecord> records;
+    uint64_t kept = written_ < ring_.size() ? written_ : ring_.size();
+    records.reserve(static_cast<size_t>(kept));
+    for (uint64_t i = written_ - kept; i < written_; ++i) {
+        records.push_back(ring_[i % ring_.size()]);
+    }
+    return records;
+}
+
+bool AssignmentTrace::writeToFile(const string& filename, const vector<LoadTask>& tasks) const {
+    ofstream file(filename, ios::out | ios::binary | ios::trunc);
+    if (!file.is_open()) {
+        return false;
+    }
+    vector<TraceRecord> records = getRecords();
+
+    file.write(TRACE_MAGIC, sizeof(TRACE_MAGIC));
+    writeValue(file, TRACE_VERSION);
+    writeValue(file, static_cast<uint32_t>(sizeof(TraceRecord)));
+    writeValue(file, static_cast<uint32_t>(tasks.size()));
+    writeValue(file, written_);
+    writeValue(file, static_cast<uint32_t>(records.size()));
+    writeValue(file, totals_);
+
+    // 任务ID表：记录中只保存下标
+    for (const auto& task : tasks) {
+        const string& task_id = task.getTaskId();
+        uint16_t length = static_cast<uint16_t>(task_id.size() < UINT16_MAX ? task_id.size() : UINT16_MAX);
+        writeValue(file, length);
+        file.write(task_id.data(), length);
+    }
+    if (!records.empty()) {
+        file.write(reinterpret_cast<const char*>(&records[0]), records.size() * sizeof(TraceRecord));
+    }
+    return file.good();
+}
+
+bool AssignmentTrace::readFromFile(const string& filename, vector<string>& task_ids,
+                                   vector<TraceRecord>& records, uint64_t& written_count, TraceTotals& totals) {
+    task_ids.clear();
+    records.clear();
+    written_count = 0;
+    memset(&totals, 0, sizeof(totals));
+
+    ifstream file(filename, ios::in | ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+    char magic[4];
+    uint32_t version = 0;
+    uint32_t record_size = 0;
+    uint32_t task_count = 0;
+    uint32_t record_count = 0;
+    if (!file.read(magic, sizeof(magic)) || memcmp(magic, TRACE_MAGIC, sizeof(magic)) != 0 ||
+        !readValue(file, version) || version != TRACE_VERSION ||
+        !readValue(file, record_size) || record_size != sizeof(TraceRecord) ||
+        !readValue(file, task_count) || !readValue(file, written_count) || !readValue(file, record_count) ||
+        !readValue(file, totals)) {
+        return false;
+    }
+
+    task_ids.reserve(task_count);
+    for (uint32_t i = 0; i < task_count; ++i) {
+        uint16_t length = 0;
+        if (!readValue(file, length)) {
+            return false;
+        }
+        string task_id(length, '\0');
+        if (length > 0 && !file.read(&task_id[0], length)) {
+            return false;
+        }
+        task_ids.push_back(task_id);
+    }
+
+    records.resize(record_count);
+    if (record_count > 0 &&
+        !file.read(reinterpret_cast<char*>(&records[0]), static_cast<streamsize>(record_count) * sizeof(TraceRecord))) {
+        records.clear();
+        return false;
+    }
+    return true;
+}
+
+const char* AssignmentTrace::reasonName(RejectReason reason) {
+    switch (reason) {
+        case RejectReason::GROUP_INCOMPLETE: return "incomplete";
+        case RejectReason::ALREADY_ON_TASK: return "already-on-task";
+        case RejectReason::BUSY: return "busy";
+        case RejectReason::TRAVEL_INFEASIBLE: return "travel-infeasible";
+        case RejectReason::REUSE_FAILED: return "reuse-failed";
+        case RejectReason::CONTINUOUS_WORK: return "continuous-work";
+        case RejectReason::REMOTE_STREAK: return "remote-streak";
+        case RejectReason::DOUBLE_OPERATION: return "double-operation";
+        case RejectReason::BREAK: return "break";
+        case RejectReason::PROFICIENCY: return "proficiency";
+        case RejectReason::OFF_SHIFT: return "off-shift";
+        default: return "unknown";
+    }
+}
+
+const char* AssignmentTrace::outcomeName(TraceOutcome outcome) {
+    switch (outcome) {
+        case TraceOutcome::ASSIGNED: return "assigned";
+        case TraceOutcome::FORCED: return "forced";
+        case TraceOutcome::SHORT_STAFFED: return "short-staffed";
+        case TraceOutcome::REUSED: return "reused";
+        case TraceOutcome::INVALID_TIME: return "invalid-time";
+        case TraceOutcome::SKIPPED: return "skipped";
+        default: return "unknown";
+    }
+}
+
+string AssignmentTrace::describe(const TraceRecord& record, const string& task_id) {
+    ostringstream oss;
+    oss << "task " << task_id << ": ";
+
+    const uint16_t* counts = record.rejections;
+    bool first = true;
+    auto separator = [&]() -> ostream& {
+        if (!first) {
+            oss << ", ";
+        }
+        first = false;
+        return oss;
+    };
+    if (counts[static_cast<int>(RejectReason::REUSE_FAILED)] > 0) {
+        separator() << "previous plan not reusable";
+    }
+    if (counts[static_cast<int>(RejectReason::GROUP_INCOMPLETE)] > 0) {
+        uint16_t count = counts[static_cast<int>(RejectReason::GROUP_INCOMPLETE)];
+        separator() << count << (count == 1 ? " group" : " groups") << " incomplete";
+    }
+    if (counts[static_cast<int>(RejectReason::ALREADY_ON_TASK)] > 0) {
+        uint16_t count = counts[static_cast<int>(RejectReason::ALREADY_ON_TASK)];
+        separator() << count << (count == 1 ? " group" : " groups") << " already on task";
+    }
+    if (counts[static_cast<int>(RejectReason::BUSY)] > 0) {
+        uint16_t count = counts[static_cast<int>(RejectReason::BUSY)];
+        separator() << count << (count == 1 ? " group" : " groups") << " busy";
+    }
+    if (counts[static_cast<int>(RejectReason::TRAVEL_INFEASIBLE)] > 0) {
+        separator() << counts[static_cast<int>(RejectReason::TRAVEL_INFEASIBLE)] << " travel-infeasible";
+    }
+    if (counts[static_cast<int>(RejectReason::CONTINUOUS_WORK)] > 0) {
+        separator() << counts[static_cast<int>(RejectReason::CONTINUOUS_WORK)] << " over continuous work limit";
+    }
+    if (counts[static_cast<int>(RejectReason::REMOTE_STREAK)] > 0) {
+        separator() << counts[static_cast<int>(RejectReason::REMOTE_STREAK)] << " over remote-stand streak";
+    }
+    if (counts[static_cast<int>(RejectReason::DOUBLE_OPERATION)] > 0) {
+        separator() << counts[static_cast<int>(RejectReason::DOUBLE_OPERATION)] << " double operation too soon";
+    }
+    if (counts[static_cast<int>(RejectReason::BREAK)] > 0) {
+        separator() << counts[static_cast<int>(RejectReason::BREAK)] << " blocked by break";
+    }
+    if (counts[static_cast<int>(RejectReason::PROFICIENCY)] > 0) {
+        separator() << counts[static_cast<int>(RejectReason::PROFICIENCY)] << " below proficiency";
+    }
+    if (counts[static_cast<int>(RejectReason::OFF_SHIFT)] > 0) {
+        separator() << counts[static_cast<int>(RejectReason::OFF_SHIFT)] << " off shift";
+    }
+
+    switch (static_cast<TraceOutcome>(record.outcome)) {
+        case TraceOutcome::ASSIGNED:
+            separator() << "assigned to group " << record.selected_group;
+            break;
+        case TraceOutcome::FORCED:
+            separator() << "forced to group " << record.selected_group;
+            break;
+        case TraceOutcome::SHORT_STAFFED:
+            separator() << "short-staffed";
+            if (record.selected_group >= 0) {
+                oss << " (last group " << record.selected_group << ")";
+            }
+            break;
+        case TraceOutcome::REUSED:
+            separator() << "kept previous group";
+            break;
+        case TraceOutcome::INVALID_TIME:
+            separator() << "invalid time window, not dispatched";
+            break;
+        case TraceOutcome::SKIPPED:
+            separator() << "skipped (already processed)";
+            break;
+        default:
+            separator() << "unknown outcome " << static_cast<int>(record.outcome);
+    }
+    if (record.rounds > 1) {
+        oss << " after " << static_cast<int>(record.rounds) << " rounds";
+    }
+    return oss.str();
+}
+
+void AssignmentTrace::printTotals(const TraceTotals& totals, ostream& os) {
+    os << "Group rejections:" << "\n";
+    for (int i = 0; i < static_cast<int>(RejectReason::COUNT); ++i) {
+        os << "  " << left << setw(20) << reasonName(static_cast<RejectReason>(i)) << right << totals.rejections[i] << "\n";
+    }
+    os << "  " << left << setw(20) << "available" << right << totals.available_groups << "\n";
+    os << "Task outcomes:" << "\n";
+    for (int i = 0; i < static_cast<int>(TraceOutcome::COUNT); ++i) {
+        os << "  " << left << setw(20) << outcomeName(static_cast<TraceOutcome>(i)) << right << totals.outcomes[i] << "\n";
+    }
+}
+
+void AssignmentTrace::printTotals(const vector<TraceRecord>& records, ostream& os) {
+    TraceTotals totals;
+    memset(&totals, 0, sizeof(totals));
+    for (const auto& record : records) {
+        for (int i = 0; i < static_cast<int>(RejectReason::COUNT); ++i) {
+            totals.rejections[i] += record.rejections[i];
+        }
+        if (record.outcome < static_cast<int>(TraceOutcome::COUNT)) {
+            totals.outcomes[record.outcome]++;
+        }
+        totals.available_groups += record.available_groups;
+    }
+    printTotals(totals, os);
+}
+
+}  // namespace zhuangxie_class
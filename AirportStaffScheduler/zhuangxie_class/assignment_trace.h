@@ -0,0 +1,211 @@
+/**
+ * @file assignment_trace.h
+ * @brief 装卸派工解释记录（拒绝原因计数 + 定长二进制环形记录）
+ *
+ * 派工时按任务累计每个小组被排除的原因（不完整、已在本任务、时间冲突、无法按时到达、
+ * 预排方案无法沿用、超过最大连续工作时长、超过最大连续远机位个数、双机作业间隔过短、
+ * 休息、熟练度、不在班期内），每个任务处理完后写入一条36字节的定长记录。
+ * 记录保存在固定容量的环形缓冲区中，调度结束后可写成二进制文件，
+ * 由assignment_trace_decoder离线解码为"task X: 5 groups busy, 2 travel-infeasible, forced to group 4"。
+ */
+
+#ifndef ZHUANGXIE_CLASS_ASSIGNMENT_TRACE_H
+#define ZHUANGXIE_CLASS_ASSIGNMENT_TRACE_H
+
+#include "load_task.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <ostream>
+
+namespace zhuangxie_class {
+
+using namespace std;
+
+/**
+ * @brief 小组被排除的原因
+ */
+enum class RejectReason : uint8_t {
+    GROUP_INCOMPLETE = 0,      ///< 小组不足3人
+    ALREADY_ON_TASK = 1,       ///< 小组成员已全部分配到当前任务
+    BUSY = 2,                  ///< 组内有成员在任务时间段内有其他任务
+    TRAVEL_INFEASIBLE = 3,     ///< 上一任务结束 + 路程时间 + 衔接间隔晚于任务开始
+    REUSE_FAILED = 4,          ///< 上一次预排方案的小组无法沿用
+    CONTINUOUS_WORK = 5,       ///< 放入后超过最大连续工作时长
+    REMOTE_STREAK = 6,         ///< 放入后超过最大连续远机位任务个数
+    DOUBLE_OPERATION = 7,      ///< 强制分配形成的双机作业与上一次间隔过短
+    BREAK = 8,                 ///< 占用组员的锁定休息，或组员的用餐在浮动窗口内找不到空档
+    PROFICIENCY = 9,           ///< 小组达到熟练度下限的人数不足
+    OFF_SHIFT = 10,            ///< 任务不在小组班期内（早于班期开始或晚于可加班到的时刻）
+    COUNT = 11
+};
+
+/**
+ * @brief 任务派工结果
+ */
+enum class TraceOutcome : uint8_t {
+    ASSIGNED = 0,              ///< 正常轮转分配
+    FORCED = 1,                ///< 至少一轮为强制分配（没有可用小组）
+    SHORT_STAFFED = 2,         ///< 缺少人手
+    REUSED = 3,                ///< 沿用上一次预排方案
+    INVALID_TIME = 4,          ///< 任务时间无效，未派工
+    SKIPPED = 5,               ///< 已处理或已分配，跳过
+    COUNT = 6
+};
+
+/**
+ * @brief 单个任务的解释记录（定长36字节，直接按内存布局写入文件）
+ */
+struct TraceRecord {
+    uint32_t task_index;                                              ///< 任务在排序后任务列表中的下标
+    uint16_t rejections[static_cast<int>(RejectReason::COUNT)];       ///< 各原因被排除的小组次数（所有轮次累计）
+    uint16_t available_groups;                                        ///< 可用小组次数（所有轮次累计）
+    int16_t selected_group;                                           ///< 最后一轮选中的小组ID（-1表示无）
+    uint8_t outcome;                                                  ///< 派工结果（TraceOutcome）
+    uint8_t rounds;                                                   ///< 选组轮次
+    uint8_t forced_rounds;                                            ///< 其中强制分配的轮次
+    uint8_t reserved[3];                                              ///< 保留
+};
+
+static_assert(sizeof(TraceRecord) == 36, "TraceRecord must stay 36 bytes");
+
+/**
+ * @brief 汇总计数（所有任务累计，不受环形缓冲区容量限制，随文件头写出）
+ */
+struct TraceTotals {
+    uint64_t rejections[static_cast<int>(RejectReason::COUNT)];       ///< 各原因被排除的小组次数
+    uint64_t outcomes[static_cast<int>(TraceOutcome::COUNT)];         ///< 各结果的任务数
+    uint64_t available_groups;                                        ///< 可用小组次数
+};
+
+/**
+ * @brief 装卸派工解释记录
+ *
+ * 记录写入环形缓冲区，超出容量后覆盖最早的记录；汇总计数不受容量限制。
+ */
+class AssignmentTrace {
+public:
+    static const size_t DEFAULT_CAPACITY = 8192;     ///< 默认记录条数
+
+    /**
+     * @brief 构造函数
+     * @param capacity 环形缓冲区容量（记录条数）
+     */
+    explicit AssignmentTrace(size_t capacity = DEFAULT_CAPACITY);
+
+    /**
+     * @brief 清空记录和汇总计数
+     */
+    void clear();
+
+    /**
+     * @brief 开始记录一个任务（清零当前任务的计数）
+     * @param task_index 任务在任务列表中的下标
+     */
+    void beginTask(size_t task_index);
+
+    /**
+     * @brief 当前任务记一次小组排除
+     */
+    void reject(RejectReason reason) {
+        uint16_t& count = current_.rejections[static_cast<int>(reason)];
+        if (count < UINT16_MAX) {
+            count++;
+        }
+        totals_.rejections[static_cast<int>(reason)]++;
+    }
+
+    /**
+     * @brief 当前任务完成一轮选组
+     * @param available_groups 本轮可用小组数
+     * @param selected_group 本轮选中的小组ID（-1表示无）
+     * @param forced 是否为强制分配
+     */
+    void endRound(size_t available_groups, int selected_group, bool forced);
+
+    /**
+     * @brief 结束当前任务，写入环形缓冲区
+     * @param outcome 派工结果
+     */
+    void endTask(TraceOutcome outcome);
+
+    /**
+     * @brief 已写入的记录总数（可能大于容量）
+     */
+    uint64_t getWrittenCount() const { return written_; }
+
+    /**
+     * @brief 按写入顺序返回环形缓冲区中仍保留的记录
+     */
+    vector<TraceRecord> getRecords() const;
+
+    /**
+     * @brief 某原因的累计排除次数
+     */
+    uint64_t getRejectTotal(RejectReason reason) const { return totals_.rejections[static_cast<int>(reason)]; }
+
+    /**
+     * @brief 某结果的任务数
+     */
+    uint64_t getOutcomeTotal(TraceOutcome outcome) const { return totals_.outcomes[static_cast<int>(outcome)]; }
+
+    /**
+     * @brief 所有任务的汇总计数（包括已被环形缓冲区覆盖的任务）
+     */
+    const TraceTotals& getTotals() const { return totals_; }
+
+    /**
+     * @brief 写入二进制文件（文件头 + 汇总计数 + 任务ID表 + 记录）
+     * @param filename 输出文件名
+     * @param tasks 调度后的任务列表（记录中的task_index指向该列表）
+     * @return 写入成功返回true
+     */
+    bool writeToFile(const string& filename, const vector<LoadTask>& tasks) const;
+
+    /**
+     * @brief 读取writeToFile写出的文件
+     * @param filename 文件名
+     * @param task_ids 输出参数，任务ID表
+     * @param records 输出参数，记录（按写入顺序）
+     * @param written_count 输出参数，调度时写入的记录总数
+     * @param totals 输出参数，所有任务的汇总计数
+     * @return 文件格式正确返回true
+     */
+    static bool readFromFile(const string& filename, vector<string>& task_ids,
+                             vector<TraceRecord>& records, uint64_t& written_count, TraceTotals& totals);
+
+    /**
+     * @brief 把一条记录格式化为可读文本
+     * @param record 记录
+     * @param task_id 任务ID
+     * @return 如"task X: 5 groups busy, 2 travel-infeasible, forced to group 4"
+     */
+    static string describe(const TraceRecord& record, const string& task_id);
+
+    /**
+     * @brief 输出按原因和结果汇总的计数
+     * @param totals 汇总计数（getTotals或readFromFile的结果）
+     * @param os 输出流
+     */
+    static void printTotals(const TraceTotals& totals, ostream& os);
+
+    /**
+     * @brief 输出给定记录按原因和结果汇总的计数
+     * @param records 记录
+     * @param os 输出流
+     */
+    static void printTotals(const vector<TraceRecord>& records, ostream& os);
+
+    static const char* reasonName(RejectReason reason);
+    static const char* outcomeName(TraceOutcome outcome);
+
+private:
+    vector<TraceRecord> ring_;                                         ///< 环形缓冲区
+    uint64_t written_;                                                 ///< 已写入记录数
+    TraceRecord current_;                                              ///< 当前任务的记录
+    TraceTotals totals_;                                               ///< 汇总计数
+};
+
+}  // namespace zhuangxie_class
+
+#endif  // ZHUANGXIE_CLASS_ASSIGNMENT_TRACE_H
@@ -0,0 +1,70 @@
+/**
+ * @file assignment_trace_decoder.cpp
+ * @brief 装卸派工解释记录离线解码工具
+ *
+ * 用法：assignment_trace_decoder [load_assignment_trace.bin] [--all] [--task 任务ID]
+ * 默认只输出强制分配、缺少人手和预排方案未能沿用的任务，以及全部任务的汇总计数；
+ * --all输出全部任务，--task只输出指定任务。
+ */
+
+#include "assignment_trace.h"
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace zhuangxie_class;
+using namespace std;
+
+int main(int argc, char* argv[]) {
+    string filename = "load_assignment_trace.bin";
+    bool show_all = false;
+    string task_filter;
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        if (arg == "--all") {
+            show_all = true;
+        } else if (arg == "--task" && i + 1 < argc) {
+            task_filter = argv[++i];
+        } else {
+            filename = arg;
+        }
+    }
+
+    vector<string> task_ids;
+    vector<TraceRecord> records;
+    uint64_t written_count = 0;
+    TraceTotals totals;
+    if (!AssignmentTrace::readFromFile(filename, task_ids, records, written_count, totals)) {
+        cerr << "错误：无法读取派工解释记录文件 " << filename << endl;
+        return 1;
+    }
+
+    cout << filename << ": " << records.size() << " records";
+    if (written_count > records.size()) {
+        cout << " (oldest " << written_count - records.size() << " overwritten)";
+    }
+    cout << endl;
+
+    for (const auto& record : records) {
+        string task_id = record.task_index < task_ids.size() ? task_ids[record.task_index]
+                                                             : "#" + to_string(record.task_index);
+        if (!task_filter.empty()) {
+            if (task_id != task_filter) {
+                continue;
+            }
+        } else if (!show_all) {
+            TraceOutcome outcome = static_cast<TraceOutcome>(record.outcome);
+            bool interesting = outcome == TraceOutcome::FORCED || outcome == TraceOutcome::SHORT_STAFFED ||
+                               record.rejections[static_cast<int>(RejectReason::REUSE_FAILED)] > 0;
+            if (!interesting) {
+                continue;
+            }
+        }
+        cout << AssignmentTrace::describe(record, task_id) << endl;
+    }
+
+    // 汇总计数取自文件头，包括已被覆盖的任务
+    cout << endl;
+    AssignmentTrace::printTotals(totals, cout);
+    return 0;
+}
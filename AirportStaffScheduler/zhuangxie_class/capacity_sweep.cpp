@@ -0,0 +1,178 @@
+/**
+ * @file capacity_sweep.cpp
+ * @brief 派工前的人力需求/供给预判实现
+ */
+
+#include "capacity_sweep.h"
+#include "group_kernels.h"
+#include "../Logger.h"
+#include <algorithm>
+#include <climits>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <unordered_map>
+#include <utility>
+
+namespace zhuangxie_class {
+
+using namespace std;
+
+namespace {
+
+const long DAY = 24 * 3600;
+
+// 时间 → 时段下标（负数时间归入第0个时段）
+long bucketOf(long time) {
+    return time <= 0 ? 0 : time / CapacitySweep::BUCKET_SECONDS;
+}
+
+string formatTime(long seconds) {
+    ostringstream oss;
+    oss << setfill('0') << setw(2) << seconds / 3600 << ":" << setw(2) << (seconds % 3600) / 60;
+    return oss.str();
+}
+
+}  // namespace
+
+CapacitySweep::CapacitySweep()
+    : peak_demand_(0), group_count_(0)
+{
+}
+
+CapacitySweep::~CapacitySweep()
+{
+}
+
+void CapacitySweep::analyze(const vector<LoadTask>& tasks,
+                            const map<string, vector<string>>& group_name_to_employees,
+                            const vector<StaffShiftWindow>& windows)
+{
+    demand_.clear();
+    capacity_.clear();
+    shortfalls_.clear();
+    peak_demand_ = 0;
+    group_count_ = 0;
+
+    // 1. 任务的开始/结束事件（同一时刻先结束后开始，首尾相接的任务不算同时进行）
+    vector<pair<long, int>> events;
+    events.reserve(tasks.size() * 2);
+    long horizon = 0;
+    for (const auto& task : tasks) {
+        long duration = task.getDuration();
+        if (duration <= 0) {
+            continue;
+        }
+        int groups = (max(task.getRequiredCount(), 1) + GROUP_SIZE - 1) / GROUP_SIZE;
+        long start = task.getEarliestStartTime();
+        events.push_back(make_pair(start, groups));
+        events.push_back(make_pair(start + duration, -groups));
+        horizon = max(horizon, start + duration);
+    }
+    sort(events.begin(), events.end());
+
+    // 2. 小组的在班时间：组员班期的交集（没有班期的组员不限制）
+    unordered_map<string, const StaffShiftWindow*> window_of;
+    window_of.reserve(windows.size());
+    for (const auto& window : windows) {
+        window_of[window.employee_id] = &window;
+    }
+    vector<pair<long, long>> group_spans;
+    for (const auto& g_pair : group_name_to_employees) {
+        const vector<string>& emp_list = g_pair.second;
+        for (size_t i = 0; i + GROUP_SIZE <= emp_list.size(); i += GROUP_SIZE) {
+            long start = 0;
+            long end = LONG_MAX;
+            for (size_t m = i; m < i + GROUP_SIZE; ++m) {
+                auto it = window_of.find(emp_list[m]);
+                if (it == window_of.end()) {
+                    continue;
+                }
+                const StaffShiftWindow& window = *it->second;
+                start = max(start, window.start);
+                end = min(end, window.end > window.start ? window.end : window.end + DAY);
+            }
+            group_spans.push_back(make_pair(start, end));
+            if (end != LONG_MAX) {
+                horizon = max(horizon, end);
+            }
+        }
+    }
+    group_count_ = static_cast<int>(group_spans.size());
+
+    size_t bucket_count = static_cast<size_t>((horizon + BUCKET_SECONDS - 1) / BUCKET_SECONDS);
+    demand_.assign(bucket_count, 0);
+    capacity_.assign(bucket_count, 0);
+    if (bucket_count == 0) {
+        return;
+    }
+
+    // 3. 需求：扫描事件，相邻两个事件之间的占用小组数不变，更新所跨时段的峰值
+    int level = 0;
+    for (size_t e = 0; e < events.size(); ++e) {
+        level += events[e].second;
+        if (level <= 0 || e + 1 == events.size() || events[e + 1].first == events[e].first) {
+            continue;
+        }
+        size_t first = static_cast<size_t>(bucketOf(events[e].first));
+        size_t last = min(static_cast<size_t>(bucketOf(events[e + 1].first - 1)), bucket_count - 1);
+        for (size_t b = first; b <= last; ++b) {
+            demand_[b] = max(demand_[b], level);
+        }
+    }
+
+    // 4. 供给：小组完整覆盖的时段差分计数，再做前缀和
+    vector<int> delta(bucket_count + 1, 0);
+    for (const auto& span : group_spans) {
+        long first = span.first <= 0 ? 0 : (span.first + BUCKET_SECONDS - 1) / BUCKET_SECONDS;
+        long last = span.second == LONG_MAX ? static_cast<long>(bucket_count) : span.second / BUCKET_SECONDS;
+        last = min(last, static_cast<long>(bucket_count));
+        if (first < last) {
+            delta[first]++;
+            delta[last]--;
+        }
+    }
+    int running = 0;
+    for (size_t b = 0; b < bucket_count; ++b) {
+        running += delta[b];
+        capacity_[b] = running;
+    }
+
+    // 5. 合并相邻的紧张时段
+    for (size_t b = 0; b < bucket_count; ++b) {
+        peak_demand_ = max(peak_demand_, demand_[b]);
+        int shortfall = demand_[b] - capacity_[b];
+        if (shortfall <= 0) {
+            continue;
+        }
+        long start = static_cast<long>(b) * BUCKET_SECONDS;
+        if (shortfalls_.empty() || shortfalls_.back().end != start) {
+            CapacityShortfall window;
+            window.start = start;
+            window.end = start;
+            shortfalls_.push_back(window);
+        }
+        CapacityShortfall& window = shortfalls_.back();
+        window.end = start + BUCKET_SECONDS;
+        window.peak_demand = max(window.peak_demand, demand_[b]);
+        window.max_shortfall = max(window.max_shortfall, shortfall);
+    }
+}
+
+bool CapacitySweep::exportCurve(const string& filename) const
+{
+    ofstream file(filename);
+    if (!file.is_open()) {
+        LOG_WARN("警告：无法写入人力需求曲线 " << filename);
+        return false;
+    }
+    file << "时段开始,时段结束,需求小组数,在班小组数\n";
+    for (size_t b = 0; b < demand_.size(); ++b) {
+        long start = static_cast<long>(b) * BUCKET_SECONDS;
+        file << formatTime(start) << "," << formatTime(start + BUCKET_SECONDS) << ","
+             << demand_[b] << "," << capacity_[b] << "\n";
+    }
+    return true;
+}
+
+}  // namespace zhuangxie_class
@@ -0,0 +1,119 @@
+/**
+ * @file capacity_sweep.h
+ * @brief 派工前的人力需求/供给预判（按15分钟时段扫描）
+ *
+ * 缺人任务原来要等派工结束后看is_short_staffed_才知道。派工前先做一次扫描：
+ * - 需求：每个任务按最早开始时间 + 作业时长占用 ceil(所需最少人数 / 3) 个小组，
+ *   任务的开始/结束按时间排序后扫描一遍，得到每个时段内同时进行的任务占用小组数的峰值；
+ * - 供给：小组与派工一致，按shift.csv的班组名3人一组切分，组员班期的交集为小组的在班时间
+ *   （结束不晚于开始表示跨零点，不计加班），完整覆盖某时段的小组才计入该时段，
+ *   用差分数组加前缀和得到每个时段的在班小组数；
+ * - 需求峰值超过在班小组数的连续时段合并为一个紧张时段。
+ *
+ * 排序O(n log n)，其余与任务数、小组数和时段数成线性。结果只是估计：
+ * 同一时段内不重叠的任务可以由同一小组先后完成，双机作业和加班也能临时补足人手，
+ * 紧张时段不一定出现缺人任务，但不在紧张时段内的任务一般不会因为人手不足而缺人。
+ */
+
+#ifndef ZHUANGXIE_CLASS_CAPACITY_SWEEP_H
+#define ZHUANGXIE_CLASS_CAPACITY_SWEEP_H
+
+#include "load_task.h"
+#include "group_work_state.h"
+#include <vector>
+#include <string>
+#include <map>
+
+namespace zhuangxie_class {
+
+using namespace std;
+
+/**
+ * @brief 紧张时段（连续若干个需求峰值超过在班小组数的时段）
+ */
+struct CapacityShortfall {
+    long start = 0;                    ///< 开始时间（秒）
+    long end = 0;                      ///< 结束时间（秒）
+    int peak_demand = 0;               ///< 区间内的需求峰值（小组数）
+    int max_shortfall = 0;             ///< 区间内需求峰值超出在班小组数的最大值
+};
+
+/**
+ * @brief 人力需求/供给曲线
+ */
+class CapacitySweep {
+public:
+    static const long BUCKET_SECONDS = 15 * 60;   ///< 时段长度
+
+    /**
+     * @brief 构造函数
+     */
+    CapacitySweep();
+
+    /**
+     * @brief 析构函数
+     */
+    ~CapacitySweep();
+
+    /**
+     * @brief 计算需求/供给曲线和紧张时段（清空之前的结果）
+     * @param tasks 任务列表（没有作业时长的任务忽略）
+     * @param group_name_to_employees 班组名到员工ID列表的映射（与派工相同的3人一组切分）
+     * @param windows 员工班期（没有班期的组员不限制小组的在班时间）
+     */
+    void analyze(const vector<LoadTask>& tasks,
+                 const map<string, vector<string>>& group_name_to_employees,
+                 const vector<StaffShiftWindow>& windows);
+
+    /**
+     * @brief 时段个数（第i个时段为[i * BUCKET_SECONDS, (i + 1) * BUCKET_SECONDS)）
+     */
+    size_t bucketCount() const { return demand_.size(); }
+
+    /**
+     * @brief 每个时段内同时占用小组数的峰值
+     */
+    const vector<int>& getDemand() const { return demand_; }
+
+    /**
+     * @brief 每个时段的在班小组数
+     */
+    const vector<int>& getCapacity() const { return capacity_; }
+
+    /**
+     * @brief 紧张时段（按时间顺序）
+     */
+    const vector<CapacityShortfall>& getShortfalls() const { return shortfalls_; }
+
+    /**
+     * @brief 全天的需求峰值（小组数）
+     */
+    int getPeakDemand() const { return peak_demand_; }
+
+    /**
+     * @brief 小组总数
+     */
+    int getGroupCount() const { return group_count_; }
+
+    /**
+     * @brief 是否没有紧张时段
+     */
+    bool isFeasible() const { return shortfalls_.empty(); }
+
+    /**
+     * @brief 将曲线导出为CSV（时段开始,时段结束,需求,在班小组数）
+     * @return 写入成功返回true
+     */
+    bool exportCurve(const string& filename) const;
+
+private:
+    vector<int> demand_;                        ///< 每个时段的需求峰值
+    vector<int> capacity_;                      ///< 每个时段的在班小组数
+    vector<CapacityShortfall> shortfalls_;      ///< 紧张时段
+    int peak_demand_;                           ///< 全天的需求峰值
+    int group_count_;                           ///< 小组总数
+};
+
+}  // namespace zhuangxie_class
+
+#endif  // ZHUANGXIE_CLASS_CAPACITY_SWEEP_H
@@ -0,0 +1,59 @@
+/**
+ * @file connect_rule_table.cpp
+ * @brief 航班衔接规则表实现
+ */
+
+#include "connect_rule_table.h"
+#include <iostream>
+
+namespace zhuangxie_class {
+
+using namespace std;
+
+ConnectRuleTable& ConnectRuleTable::getInstance() {
+    static ConnectRuleTable instance;
+    return instance;
+}
+
+ConnectRuleTable::ConnectRuleTable()
+    : rule_count_(0)
+{
+    reset();
+}
+
+ConnectRuleTable::~ConnectRuleTable() {
+}
+
+void ConnectRuleTable::reset() {
+    for (int i = 0; i < TABLE_SIZE; ++i) {
+        intervals_[i] = DEFAULT_INTERVAL;
+    }
+    rule_count_ = 0;
+}
+
+void ConnectRuleTable::setRule(ConnectDirection prev_direction, BodyType prev_body_type,
+                               ConnectDirection next_direction, long interval) {
+    if (prev_body_type == BodyType::UNKNOWN) {
+        // 未指定机型：对所有机型生效
+        for (int body = 0; body < BODY_TYPE_COUNT; ++body) {
+            intervals_[index(prev_direction, static_cast<BodyType>(body), next_direction)] = interval;
+        }
+    } else {
+        intervals_[index(prev_direction, prev_body_type, next_direction)] = interval;
+    }
+    rule_count_++;
+}
+
+bool ConnectRuleTable::setRule(const string& prev_direction, const string& prev_body_type,
+                               const string& next_direction, long interval) {
+    ConnectDirection prev_dir = parseDirection(prev_direction);
+    ConnectDirection next_dir = parseDirection(next_direction);
+    if (prev_dir == ConnectDirection::OTHER || next_dir == ConnectDirection::OTHER) {
+        cerr << "警告：无法识别的衔接规则方向: " << prev_direction << " -> " << next_direction << endl;
+        return false;
+    }
+    setRule(prev_dir, parseBodyType(prev_body_type), next_dir, interval);
+    return true;
+}
+
+}  // namespace zhuangxie_class
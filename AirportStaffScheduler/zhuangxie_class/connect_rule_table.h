@@ -0,0 +1,172 @@
+/**
+ * @file connect_rule_table.h
+ * @brief 航班衔接规则表
+ *
+ * 把connectRule.csv（前一个航班进/出港 × 前一个航班机型 × 后一个航班进/出港 → 最小时间间隔）
+ * 编译成按枚举下标访问的定长数组，调度时O(1)查询，不做字符串比较
+ */
+
+#ifndef ZHUANGXIE_CLASS_CONNECT_RULE_TABLE_H
+#define ZHUANGXIE_CLASS_CONNECT_RULE_TABLE_H
+
+#include "load_task.h"
+#include <string>
+
+namespace zhuangxie_class {
+
+using namespace std;
+
+/**
+ * @brief 衔接方向（进/出港）
+ */
+enum class ConnectDirection {
+    ARRIVAL = 0,               ///< 进
+    DEPARTURE = 1,             ///< 出
+    OTHER = 2                  ///< 过站等其他（不匹配任何规则）
+};
+
+/**
+ * @brief 航班衔接规则表
+ *
+ * 未配置的组合返回默认间隔（5分钟，与原缓冲时间一致）
+ */
+class ConnectRuleTable {
+public:
+    static const int DIRECTION_COUNT = 3;                 ///< 方向个数
+    static const int BODY_TYPE_COUNT = 3;                 ///< 机型个数
+    static const int TABLE_SIZE = DIRECTION_COUNT * BODY_TYPE_COUNT * DIRECTION_COUNT;
+    static const long DEFAULT_INTERVAL = 5 * 60;          ///< 默认最小间隔（秒）
+
+    /**
+     * @brief 获取单例实例
+     * @return ConnectRuleTable单例引用
+     */
+    static ConnectRuleTable& getInstance();
+
+    /**
+     * @brief 计算表下标
+     */
+    static constexpr int index(ConnectDirection prev_direction, BodyType prev_body_type,
+                               ConnectDirection next_direction) {
+        return (static_cast<int>(prev_direction) * BODY_TYPE_COUNT + static_cast<int>(prev_body_type))
+                   * DIRECTION_COUNT + static_cast<int>(next_direction);
+    }
+
+    /**
+     * @brief 航班类型转衔接方向
+     * @param flight_type 航班类型（FlightType的整数值）
+     */
+    static ConnectDirection directionOf(int flight_type) {
+        switch (static_cast<FlightType>(flight_type)) {
+            case FlightType::DOMESTIC_ARRIVAL:
+            case FlightType::INTERNATIONAL_ARRIVAL:
+                return ConnectDirection::ARRIVAL;
+            case FlightType::DOMESTIC_DEPARTURE:
+            case FlightType::INTERNATIONAL_DEPARTURE:
+                return ConnectDirection::DEPARTURE;
+            default:
+                return ConnectDirection::OTHER;
+        }
+    }
+
+    /**
+     * @brief 解析进/出港字符串（"进"/"进港"、"出"/"出港"）
+     */
+    static ConnectDirection parseDirection(const string& direction) {
+        if (direction.find("进") != string::npos) {
+            return ConnectDirection::ARRIVAL;
+        }
+        if (direction.find("出") != string::npos) {
+            return ConnectDirection::DEPARTURE;
+        }
+        return ConnectDirection::OTHER;
+    }
+
+    /**
+     * @brief 解析机型类型字符串（"窄体"、"宽体"）
+     */
+    static BodyType parseBodyType(const string& body_type) {
+        if (body_type.find("窄体") != string::npos) {
+            return BodyType::NARROW;
+        }
+        if (body_type.find("宽体") != string::npos) {
+            return BodyType::WIDE;
+        }
+        return BodyType::UNKNOWN;
+    }
+
+    /**
+     * @brief 查询最小间隔
+     * @return 最小时间间隔（秒，可为负）
+     */
+    long getMinInterval(ConnectDirection prev_direction, BodyType prev_body_type,
+                        ConnectDirection next_direction) const {
+        return intervals_[index(prev_direction, prev_body_type, next_direction)];
+    }
+
+    /**
+     * @brief 查询两个任务之间的最小间隔
+     * @param prev 前一个任务
+     * @param next 后一个任务
+     * @return 最小时间间隔（秒，可为负）
+     */
+    long getMinInterval(const LoadTask& prev, const LoadTask& next) const {
+        return intervals_[index(directionOf(prev.getFlightType()), prev.getBodyType(),
+                                directionOf(next.getFlightType()))];
+    }
+
+    /**
+     * @brief 设置规则（后设置的覆盖先设置的）
+     * @param prev_direction 前一个航班进/出港
+     * @param prev_body_type 前一个航班机型，UNKNOWN表示规则对所有机型生效
+     * @param next_direction 后一个航班进/出港
+     * @param interval 最小时间间隔（秒）
+     */
+    void setRule(ConnectDirection prev_direction, BodyType prev_body_type,
+                 ConnectDirection next_direction, long interval);
+
+    /**
+     * @brief 按字符串设置规则（connectRule.csv一行），无法识别的方向忽略
+     * @return 规则有效返回true
+     */
+    bool setRule(const string& prev_direction, const string& prev_body_type,
+                 const string& next_direction, long interval);
+
+    /**
+     * @brief 恢复为全部默认间隔
+     */
+    void reset();
+
+    /**
+     * @brief 已配置的规则条数
+     */
+    int getRuleCount() const { return rule_count_; }
+
+private:
+    /**
+     * @brief 私有构造函数（单例模式）
+     */
+    ConnectRuleTable();
+
+    /**
+     * @brief 私有析构函数
+     */
+    ~ConnectRuleTable();
+
+    /**
+     * @brief 禁止拷贝构造
+     */
+    ConnectRuleTable(const ConnectRuleTable&) = delete;
+
+    /**
+     * @brief 禁止赋值操作
+     */
+    ConnectRuleTable& operator=(const ConnectRuleTable&) = delete;
+
+    long intervals_[TABLE_SIZE];   ///< 下标为index()的最小间隔表（秒）
+    int rule_count_;               ///< 已配置的规则条数
+};
+
+}  // namespace zhuangxie_class
+
+#endif  // ZHUANGXIE_CLASS_CONNECT_RULE_TABLE_H
@@ -0,0 +1,169 @@
+/**
+ * @file dispatch_client.cpp
+ * @brief 装卸派工守护进程命令行客户端
+ *
+ * 用法：dispatch_client [--socket 套接字路径] 命令 [参数]
+ *   flight 航班ID 延误秒数    航班时间变化（提前为负数）
+ *   sick 员工ID              员工病假
+ *   lock 任务ID / unlock 任务ID
+ *   query [任务ID或员工ID]    查询当前方案
+ *   export 文件名            导出当前方案（soln_shift.csv格式，路径相对守护进程工作目录）
+ *   shutdown                 停止守护进程
+ *   bench 航班ID 次数         交替发送+60s/-60s航班变化，统计每个事件的耗时
+ */
+
+#include "dispatch_protocol.h"
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <cstring>
+#endif
+
+using namespace zhuangxie_class;
+using namespace std;
+
+// 辅助函数：秒数转当日HH:MM（0表示未分配）
+static string formatClock(int64_t seconds) {
+    if (seconds <= 0) {
+        return "--:--";
+    }
+    int64_t in_day = seconds % (24 * 3600);
+    ostringstream oss;
+    oss << setfill('0') << setw(2) << in_day / 3600 << ":" << setw(2) << (in_day % 3600) / 60;
+    return oss.str();
+}
+
+// 辅助函数：员工ID列表转字符串
+static string formatStaff(const vector<string>& staff) {
+    string text = "[";
+    for (size_t i = 0; i < staff.size(); ++i) {
+        text += (i > 0 ? " " : "") + staff[i];
+    }
+    return text + "]";
+}
+
+int main(int argc, char* argv[]) {
+#ifdef _WIN32
+    (void)argc;
+    (void)argv;
+    cerr << "错误：派工守护进程使用Unix域套接字，Windows下暂不支持" << endl;
+    return 1;
+#else
+    string socket_path = "/tmp/load_dispatch.sock";
+    vector<string> args;
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        if (arg == "--socket" && i + 1 < argc) {
+            socket_path = argv[++i];
+        } else {
+            args.push_back(arg);
+        }
+    }
+    if (args.empty()) {
+        cerr << "用法：dispatch_client [--socket 路径] flight|sick|lock|unlock|query|export|shutdown|bench [参数]" << endl;
+        return 1;
+    }
+
+    const string& command = args[0];
+    string target = args.size() > 1 ? args[1] : "";
+    DispatchRequest request;
+    request.target = target;
+    int bench_count = 0;
+    if (command == "flight" && args.size() > 2) {
+        request.command = DispatchCommand::FLIGHT_UPDATE;
+        request.value = stoi(args[2]);
+    } else if (command == "sick" && args.size() > 1) {
+        request.command = DispatchCommand::STAFF_SICK;
+    } else if ((command == "lock" || command == "unlock") && args.size() > 1) {
+        request.command = DispatchCommand::LOCK_TASK;
+        request.value = command == "lock" ? 1 : 0;
+    } else if (command == "query") {
+        request.command = DispatchCommand::QUERY_PLAN;
+    } else if (command == "export" && args.size() > 1) {
+        request.command = DispatchCommand::EXPORT;
+    } else if (command == "shutdown") {
+        request.command = DispatchCommand::SHUTDOWN;
+    } else if (command == "bench" && args.size() > 2) {
+        request.command = DispatchCommand::FLIGHT_UPDATE;
+        bench_count = max(1, stoi(args[2]));
+    } else {
+        cerr << "错误：无法识别的命令或缺少参数: " << command << endl;
+        return 1;
+    }
+
+    sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    strncpy(address.sun_path, socket_path.c_str(), sizeof(address.sun_path) - 1);
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0 || connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+        cerr << "错误：无法连接派工守护进程 " << socket_path << endl;
+        return 1;
+    }
+
+    if (bench_count > 0) {
+        // 往返延迟（含协议和套接字开销）与服务端处理耗时分别统计
+        vector<double> round_trip_us;
+        vector<double> service_us;
+        for (int i = 0; i < bench_count; ++i) {
+            request.value = (i % 2 == 0) ? 60 : -60;
+            auto start = chrono::steady_clock::now();
+            DispatchResponse response;
+            string payload;
+            if (!writeFrame(fd, encodeRequest(request)) || !readFrame(fd, payload) ||
+                !decodeResponse(payload, response) || response.status != DispatchStatus::OK) {
+                cerr << "错误：第 " << i << " 个事件失败 " << response.message << endl;
+                close(fd);
+                return 1;
+            }
+            round_trip_us.push_back(
+                chrono::duration<double, micro>(chrono::steady_clock::now() - start).count());
+            service_us.push_back(response.elapsed_us);
+        }
+        close(fd);
+        sort(round_trip_us.begin(), round_trip_us.end());
+        sort(service_us.begin(), service_us.end());
+        auto percentile = [](const vector<double>& values, double p) {
+            return values[static_cast<size_t>(p * (values.size() - 1))];
+        };
+        cout << fixed << setprecision(0);
+        cout << bench_count << " flight updates on " << target << endl;
+        cout << "  round trip us: p50 " << percentile(round_trip_us, 0.5) << "  p99 " << percentile(round_trip_us, 0.99)
+             << "  max " << round_trip_us.back() << endl;
+        cout << "  service us:    p50 " << percentile(service_us, 0.5) << "  p99 " << percentile(service_us, 0.99)
+             << "  max " << service_us.back() << endl;
+        return 0;
+    }
+
+    DispatchResponse response;
+    string payload;
+    if (!writeFrame(fd, encodeRequest(request)) || !readFrame(fd, payload) || !decodeResponse(payload, response)) {
+        cerr << "错误：与派工守护进程通信失败" << endl;
+        close(fd);
+        return 1;
+    }
+    close(fd);
+
+    cout << (response.status == DispatchStatus::OK ? "OK" : "ERROR") << ": " << response.message
+         << " (" << response.elapsed_us << " us)" << endl;
+    for (const auto& change : response.changes) {
+        if (request.command == DispatchCommand::QUERY_PLAN) {
+            cout << "  " << change.task_id << "  " << formatClock(change.new_start) << "  "
+                 << formatStaff(change.new_staff) << endl;
+        } else {
+            cout << "  " << change.task_id << "  " << formatClock(change.old_start) << " " << formatStaff(change.old_staff)
+                 << " -> " << formatClock(change.new_start) << " " << formatStaff(change.new_staff) << endl;
+        }
+    }
+    return response.status == DispatchStatus::OK ? 0 : 2;
+#endif
+}
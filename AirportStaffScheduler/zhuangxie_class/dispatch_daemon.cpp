@@ -0,0 +1,115 @@
+/**
+ * @file dispatch_daemon.cpp
+ * @brief 装卸派工守护进程
+ *
+ * 用法：dispatch_daemon [输入目录] [--socket 套接字路径]
+ * 启动时加载一次输入目录并完成首次派工，然后在本地（Unix域）套接字上逐条处理
+ * dispatch_client发来的事件，协议见dispatch_protocol.h。事件按到达顺序串行处理，
+ * 同一时间只服务一个连接。每个事件的处理结果经日志（LOG_INFO）输出。
+ */
+
+#include "dispatch_service.h"
+#include "dispatch_protocol.h"
+#include "../Logger.h"
+#include <iostream>
+#include <string>
+
+#ifndef _WIN32
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <csignal>
+#include <cerrno>
+#include <cstring>
+#endif
+
+using namespace zhuangxie_class;
+using namespace std;
+
+int main(int argc, char* argv[]) {
+#ifdef _WIN32
+    (void)argc;
+    (void)argv;
+    cerr << "错误：派工守护进程使用Unix域套接字，Windows下暂不支持" << endl;
+    return 1;
+#else
+    string input_dir = "../input/";
+    string socket_path = "/tmp/load_dispatch.sock";
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        if (arg == "--socket" && i + 1 < argc) {
+            socket_path = argv[++i];
+        } else {
+            input_dir = arg;
+            if (input_dir.back() != '/' && input_dir.back() != '\\') {
+                input_dir += "/";
+            }
+        }
+    }
+
+    DispatchService service;
+    bool loaded = service.load(input_dir);
+    AirportStaffScheduler::Logging::flush();
+    if (!loaded) {
+        cerr << "错误：无法从 " << input_dir << " 加载单日模型" << endl;
+        return 1;
+    }
+    cout << "Loaded " << service.getPlan().size() << " tasks, " << service.getPlanEmployees().size()
+         << " employees from " << input_dir << endl;
+
+    sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if (socket_path.size() >= sizeof(address.sun_path)) {
+        cerr << "错误：套接字路径过长 " << socket_path << endl;
+        return 1;
+    }
+    strncpy(address.sun_path, socket_path.c_str(), sizeof(address.sun_path) - 1);
+
+    int server = socket(AF_UNIX, SOCK_STREAM, 0);
+    unlink(socket_path.c_str());
+    if (server < 0 || bind(server, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 ||
+        listen(server, 8) != 0) {
+        cerr << "错误：无法监听套接字 " << socket_path << ": " << strerror(errno) << endl;
+        return 1;
+    }
+    signal(SIGPIPE, SIG_IGN);  // 客户端提前断开时不终止进程
+    cout << "Listening on " << socket_path << endl;
+
+    bool running = true;
+    while (running) {
+        int client = accept(server, nullptr, nullptr);
+        if (client < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            AirportStaffScheduler::Logging::flush();
+            cerr << "错误：accept失败: " << strerror(errno) << endl;
+            break;
+        }
+        string payload;
+        while (running && readFrame(client, payload)) {
+            DispatchRequest request;
+            DispatchResponse response;
+            if (decodeRequest(payload, request)) {
+                response = service.handle(request);
+                running = request.command != DispatchCommand::SHUTDOWN;
+            } else {
+                response.status = DispatchStatus::ERROR;
+                response.message = "malformed request";
+            }
+            LOG_INFO(commandName(request.command) << " " << request.target << ": " << response.message
+                     << " (" << response.elapsed_us << " us)");
+            if (!writeFrame(client, encodeResponse(response))) {
+                break;
+            }
+        }
+        close(client);
+    }
+
+    close(server);
+    unlink(socket_path.c_str());
+    AirportStaffScheduler::Logging::flush();
+    return 0;
+#endif
+}
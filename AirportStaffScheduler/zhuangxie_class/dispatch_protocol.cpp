@@ -0,0 +1,221 @@
+/**
+ * @file dispatch_protocol.cpp
+ * @brief 装卸派工守护进程的本地套接字协议实现
+ */
+
+#include "dispatch_protocol.h"
+#include <cerrno>
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+namespace zhuangxie_class {
+
+using namespace std;
+
+namespace {
+
+const uint32_t MAX_FRAME_BYTES = 64u * 1024u * 1024u;  ///< 单帧上限，防止错误长度导致超大分配
+
+// 辅助函数：按小端写入/读取定长整数（与机器字节序无关）
+void putInt(string& out, uint64_t value, int bytes) {
+    for (int i = 0; i < bytes; ++i) {
+        out.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+    }
+}
+
+void putString(string& out, const string& value) {
+    size_t length = value.size() < UINT16_MAX ? value.size() : UINT16_MAX;
+    putInt(out, length, 2);
+    out.append(value, 0, length);
+}
+
+void putStaff(string& out, const vector<string>& staff) {
+    putInt(out, staff.size(), 2);
+    for (const auto& id : staff) {
+        putString(out, id);
+    }
+}
+
+/**
+ * @brief 载荷读取游标（越界时置失败标志，后续读取都返回0/空）
+ */
+class PayloadReader {
+public:
+    explicit PayloadReader(const string& payload) : payload_(payload), pos_(0), failed_(false) {}
+
+    uint64_t getInt(int bytes) {
+        if (failed_ || pos_ + bytes > payload_.size()) {
+            failed_ = true;
+            return 0;
+        }
+        uint64_t value = 0;
+        for (int i = 0; i < bytes; ++i) {
+            value |= static_cast<uint64_t>(static_cast<unsigned char>(payload_[pos_ + i])) << (8 * i);
+        }
+        pos_ += bytes;
+        return value;
+    }
+
+    string getString() {
+        size_t length = static_cast<size_t>(getInt(2));
+        if (failed_ || pos_ + length > payload_.size()) {
+            failed_ = true;
+            return string();
+        }
+        string value = payload_.substr(pos_, length);
+        pos_ += length;
+        return value;
+    }
+
+    vector<string> getStaff() {
+        size_t count = static_cast<size_t>(getInt(2));
+        vector<string> staff;
+        for (size_t i = 0; i < count && !failed_; ++i) {
+            staff.push_back(getString());
+        }
+        return staff;
+    }
+
+    bool failed() const { return failed_; }
+
+    /// 读取成功且恰好读完整个载荷
+    bool ok() const { return !failed_ && pos_ == payload_.size(); }
+
+private:
+    const string& payload_;
+    size_t pos_;
+    bool failed_;
+};
+
+#ifndef _WIN32
+// 辅助函数：阻塞读写指定字节数（被信号打断时重试）
+bool writeAll(int fd, const char* data, size_t size) {
+    while (size > 0) {
+        ssize_t written = ::write(fd, data, size);
+        if (written < 0 && errno == EINTR) {
+            continue;
+        }
+        if (written <= 0) {
+            return false;
+        }
+        data += written;
+        size -= static_cast<size_t>(written);
+    }
+    return true;
+}
+
+bool readAll(int fd, char* data, size_t size) {
+    while (size > 0) {
+        ssize_t received = ::read(fd, data, size);
+        if (received < 0 && errno == EINTR) {
+            continue;
+        }
+        if (received <= 0) {
+            return false;
+        }
+        data += received;
+        size -= static_cast<size_t>(received);
+    }
+    return true;
+}
+#endif
+
+}  // namespace
+
+string encodeRequest(const DispatchRequest& request) {
+    string payload;
+    putInt(payload, static_cast<uint8_t>(request.command), 1);
+    putString(payload, request.target);
+    putInt(payload, static_cast<uint32_t>(request.value), 4);
+    return payload;
+}
+
+bool decodeRequest(const string& payload, DispatchRequest& request) {
+    PayloadReader reader(payload);
+    request.command = static_cast<DispatchCommand>(reader.getInt(1));
+    request.target = reader.getString();
+    request.value = static_cast<int32_t>(static_cast<uint32_t>(reader.getInt(4)));
+    return reader.ok();
+}
+
+string encodeResponse(const DispatchResponse& response) {
+    string payload;
+    putInt(payload, static_cast<uint8_t>(response.status), 1);
+    putString(payload, response.message);
+    putInt(payload, response.elapsed_us, 4);
+    putInt(payload, response.changes.size(), 4);
+    for (const auto& change : response.changes) {
+        putString(payload, change.task_id);
+        putInt(payload, static_cast<uint64_t>(change.old_start), 8);
+        putInt(payload, static_cast<uint64_t>(change.new_start), 8);
+        putStaff(payload, change.old_staff);
+        putStaff(payload, change.new_staff);
+    }
+    return payload;
+}
+
+bool decodeResponse(const string& payload, DispatchResponse& response) {
+    PayloadReader reader(payload);
+    response.status = static_cast<DispatchStatus>(reader.getInt(1));
+    response.message = reader.getString();
+    response.elapsed_us = static_cast<uint32_t>(reader.getInt(4));
+    size_t count = static_cast<size_t>(reader.getInt(4));
+    response.changes.clear();
+    for (size_t i = 0; i < count && !reader.failed(); ++i) {
+        PlanChange change;
+        change.task_id = reader.getString();
+        change.old_start = static_cast<int64_t>(reader.getInt(8));
+        change.new_start = static_cast<int64_t>(reader.getInt(8));
+        change.old_staff = reader.getStaff();
+        change.new_staff = reader.getStaff();
+        response.changes.push_back(change);
+    }
+    return reader.ok() && response.changes.size() == count;
+}
+
+bool writeFrame(int fd, const string& payload) {
+#ifndef _WIN32
+    string header;
+    putInt(header, payload.size(), 4);
+    return writeAll(fd, header.data(), header.size()) && writeAll(fd, payload.data(), payload.size());
+#else
+    (void)fd;
+    (void)payload;
+    return false;
+#endif
+}
+
+bool readFrame(int fd, string& payload) {
+#ifndef _WIN32
+    unsigned char header[4];
+    if (!readAll(fd, reinterpret_cast<char*>(header), sizeof(header))) {
+        return false;
+    }
+    uint32_t length = header[0] | (header[1] << 8) | (header[2] << 16) | (static_cast<uint32_t>(header[3]) << 24);
+    if (length > MAX_FRAME_BYTES) {
+        return false;
+    }
+    payload.assign(length, '\0');
+    return length == 0 || readAll(fd, &payload[0], length);
+#else
+    (void)fd;
+    (void)payload;
+    return false;
+#endif
+}
+
+const char* commandName(DispatchCommand command) {
+    switch (command) {
+        case DispatchCommand::FLIGHT_UPDATE: return "flight-update";
+        case DispatchCommand::STAFF_SICK: return "staff-sick";
+        case DispatchCommand::LOCK_TASK: return "lock-task";
+        case DispatchCommand::QUERY_PLAN: return "query-plan";
+        case DispatchCommand::EXPORT: return "export";
+        case DispatchCommand::SHUTDOWN: return "shutdown";
+        default: return "unknown";
+    }
+}
+
+}  // namespace zhuangxie_class
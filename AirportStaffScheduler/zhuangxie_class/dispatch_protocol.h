@@ -0,0 +1,98 @@
+/**
+ * @file dispatch_protocol.h
+ * @brief 装卸派工守护进程的本地套接字协议
+ *
+ * 每条消息是一个帧：4字节小端长度 + 载荷。
+ * 请求载荷：1字节命令 + 字符串参数 + 4字节整数参数；
+ * 应答载荷：1字节状态 + 字符串说明 + 4字节处理耗时（微秒）+ 方案变化列表。
+ * 字符串一律为2字节小端长度 + 原始字节。
+ */
+
+#ifndef ZHUANGXIE_CLASS_DISPATCH_PROTOCOL_H
+#define ZHUANGXIE_CLASS_DISPATCH_PROTOCOL_H
+
+#include <cstdint>
+#include <vector>
+#include <string>
+
+namespace zhuangxie_class {
+
+using namespace std;
+
+/**
+ * @brief 请求命令
+ */
+enum class DispatchCommand : uint8_t {
+    FLIGHT_UPDATE = 1,   ///< 航班时间变化：target=航班ID，value=相对当前时间的延误秒数（提前为负）
+    STAFF_SICK = 2,      ///< 员工病假：target=员工ID
+    LOCK_TASK = 3,       ///< 锁定/解锁任务当前分配：target=任务ID，value=1锁定、0解锁
+    QUERY_PLAN = 4,      ///< 查询当前方案：target=任务ID或员工ID（为空返回全部任务）
+    EXPORT = 5,          ///< 导出当前方案：target=文件名（soln_shift.csv格式）
+    SHUTDOWN = 6         ///< 停止守护进程
+};
+
+/**
+ * @brief 应答状态
+ */
+enum class DispatchStatus : uint8_t {
+    OK = 0,              ///< 处理成功
+    ERROR = 1            ///< 参数错误或处理失败，说明见message
+};
+
+/**
+ * @brief 请求
+ */
+struct DispatchRequest {
+    DispatchCommand command = DispatchCommand::QUERY_PLAN;
+    string target;       ///< 字符串参数（航班ID/员工ID/任务ID/文件名）
+    int32_t value = 0;   ///< 整数参数（延误秒数/锁定标志）
+};
+
+/**
+ * @brief 单个任务的方案变化（查询时为当前分配，旧值与新值相同）
+ */
+struct PlanChange {
+    string task_id;
+    int64_t old_start = 0;          ///< 原实际开始时间（0表示原来未分配）
+    int64_t new_start = 0;          ///< 新实际开始时间（0表示现在未分配）
+    vector<string> old_staff;       ///< 原分配员工
+    vector<string> new_staff;       ///< 新分配员工
+};
+
+/**
+ * @brief 应答
+ */
+struct DispatchResponse {
+    DispatchStatus status = DispatchStatus::OK;
+    string message;
+    uint32_t elapsed_us = 0;        ///< 守护进程处理本次请求的耗时
+    vector<PlanChange> changes;     ///< 方案变化（查询时为当前方案）
+};
+
+/**
+ * @brief 编码/解码请求载荷
+ */
+string encodeRequest(const DispatchRequest& request);
+bool decodeRequest(const string& payload, DispatchRequest& request);
+
+/**
+ * @brief 编码/解码应答载荷
+ */
+string encodeResponse(const DispatchResponse& response);
+bool decodeResponse(const string& payload, DispatchResponse& response);
+
+/**
+ * @brief 在已连接的套接字上写/读一个帧（阻塞直到完整读写）
+ * @return 连接断开或出错返回false
+ */
+bool writeFrame(int fd, const string& payload);
+bool readFrame(int fd, string& payload);
+
+/**
+ * @brief 命令名（用于日志和命令行工具）
+ */
+const char* commandName(DispatchCommand command);
+
+}  // namespace zhuangxie_class
+
+#endif  // ZHUANGXIE_CLASS_DISPATCH_PROTOCOL_H
@@ -0,0 +1,314 @@
+/**
+ * @file dispatch_service.cpp
+ * @brief 装卸派工常驻服务实现
+ */
+
+#include "dispatch_service.h"
+#include "load_scheduler.h"
+#include "load_model_view.h"
+#include "load_plan_export.h"
+#include "stable_redispatch.h"
+#include "connect_rule_table.h"
+#include "group_kernels.h"
+#include "../DayModelSnapshot.h"
+#include <algorithm>
+#include <chrono>
+
+namespace zhuangxie_class {
+
+using namespace std;
+
+namespace {
+
+// 辅助函数：员工ID列表是否包含指定员工
+bool containsStaff(const vector<string>& staff, const string& staff_id) {
+    return find(staff.begin(), staff.end(), staff_id) != staff.end();
+}
+
+// 辅助函数：员工编号转员工ID
+vector<string> staffIds(const AirportStaffScheduler::Output::PlanDiff& diff, const vector<int>& staff) {
+    vector<string> ids;
+    ids.reserve(staff.size());
+    for (int id : staff) {
+        ids.push_back(diff.getIds().get(id));
+    }
+    return ids;
+}
+
+}  // namespace
+
+DispatchService::DispatchService()
+{
+}
+
+DispatchService::~DispatchService()
+{
+}
+
+bool DispatchService::load(const string& input_dir) {
+    if (!AirportStaffScheduler::Model::loadDayModelCached(input_dir, model_)) {
+        return false;
+    }
+    LoadModelView model_view(model_);
+    model_view.buildConnectRules(ConnectRuleTable::getInstance());
+    model_view.buildShifts(shifts_);
+    model_view.buildWorkRules(work_rules_);
+    model_view.buildShiftWindows(shift_windows_);
+    VehicleRules vehicle_rules;
+    model_view.buildVehicleRules(vehicle_rules);
+    vector<LoadVehicle> vehicles;
+    model_view.buildVehicles(vehicles);
+    vehicle_pool_ = VehiclePool(vehicle_rules);
+    vehicle_pool_.setVehicles(vehicles);
+    model_view.buildBreaks(breaks_);
+    model_view.buildSkillRules(skill_rules_);
+    model_view.buildSkillLevels(skill_levels_);
+    if (!model_view.buildEmployees(base_employees_, group_name_to_employees_) || !model_view.buildTasks(base_tasks_)) {
+        return false;
+    }
+    redispatch(nullptr);
+    return true;
+}
+
+DispatchResponse DispatchService::handle(const DispatchRequest& request) {
+    auto start = chrono::steady_clock::now();
+    DispatchResponse response;
+    bool ok = true;
+    bool changed = false;
+    switch (request.command) {
+        case DispatchCommand::FLIGHT_UPDATE:
+            ok = applyFlightUpdate(request.target, request.value, response.message);
+            changed = ok;
+            break;
+        case DispatchCommand::STAFF_SICK:
+            ok = applyStaffSick(request.target, response.message);
+            changed = ok;
+            break;
+        case DispatchCommand::LOCK_TASK:
+            ok = applyLock(request.target, request.value != 0, response.message);
+            break;
+        case DispatchCommand::QUERY_PLAN:
+            queryPlan(request.target, response.changes);
+            response.message = to_string(response.changes.size()) + " tasks";
+            break;
+        case DispatchCommand::EXPORT:
+            ok = !request.target.empty() && exportLoadPlan(plan_, plan_employees_, request.target, &vehicle_pool_,
+                                                                 &break_placements_);
+            response.message = ok ? "exported to " + request.target : "cannot write " + request.target;
+            break;
+        case DispatchCommand::SHUTDOWN:
+            response.message = "shutting down";
+            break;
+        default:
+            ok = false;
+            response.message = "unknown command";
+    }
+    if (changed) {
+        redispatch(&response.changes);
+        response.message += ", " + to_string(response.changes.size()) + " tasks changed";
+    }
+    response.status = ok ? DispatchStatus::OK : DispatchStatus::ERROR;
+    response.elapsed_us = static_cast<uint32_t>(
+        chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start).count());
+    return response;
+}
+
+bool DispatchService::applyFlightUpdate(const string& flight_id, long delay, string& message) {
+    int matched = 0;
+    for (auto& task : base_tasks_) {
+        bool arrival = !flight_id.empty() && task.getArrivalFlightId() == flight_id;
+        bool departure = !flight_id.empty() && task.getDepartureFlightId() == flight_id;
+        if (!arrival && !departure) {
+            continue;
+        }
+        // 任务时间窗随航班整体平移
+        task.setEarliestStartTime(task.getEarliestStartTime() + delay);
+        task.setLatestEndTime(task.getLatestEndTime() + delay);
+        if (arrival) {
+            task.setArrivalTime(task.getArrivalTime() + delay);
+        }
+        if (departure) {
+            task.setDepartureTime(task.getDepartureTime() + delay);
+        }
+        auto locked = locked_.find(task.getTaskId());
+        if (locked != locked_.end()) {
+            locked->second.start_time += delay;
+        }
+        matched++;
+    }
+    if (matched == 0) {
+        message = "unknown flight " + flight_id;
+        return false;
+    }
+    message = "flight " + flight_id + " moved " + to_string(delay) + "s on " + to_string(matched) + " tasks";
+    return true;
+}
+
+bool DispatchService::applyStaffSick(const string& staff_id, string& message) {
+    auto employee = find_if(base_employees_.begin(), base_employees_.end(),
+                            [&](const LoadEmployeeInfo& emp) { return emp.getEmployeeId() == staff_id; });
+    if (employee == base_employees_.end()) {
+        message = "unknown staff " + staff_id;
+        return false;
+    }
+    base_employees_.erase(employee);
+    // 班组映射保留该员工的位置：小组按位置3人一组切分，删掉一人会让同班组后面的小组整体错位。
+    // 员工不在员工列表中，所在小组在重新派工时整组不可用，只有这个小组的任务会换人
+    string crew;
+    for (const auto& g_pair : group_name_to_employees_) {
+        const auto& members = g_pair.second;
+        auto member = find(members.begin(), members.end(), staff_id);
+        if (member == members.end()) {
+            continue;
+        }
+        size_t first = static_cast<size_t>(member - members.begin()) / GROUP_SIZE * GROUP_SIZE;
+        for (size_t m = first; m < first + GROUP_SIZE && m < members.size(); ++m) {
+            if (members[m] != staff_id) {
+                crew += crew.empty() ? members[m] : "|" + members[m];
+            }
+        }
+        break;
+    }
+    // 含该员工的锁定分配失效
+    int released = 0;
+    for (auto it = locked_.begin(); it != locked_.end();) {
+        if (containsStaff(it->second.staff, staff_id)) {
+            it = locked_.erase(it);
+            released++;
+        } else {
+            ++it;
+        }
+    }
+    message = "staff " + staff_id + " off duty";
+    if (!crew.empty()) {
+        message += ", crew " + crew + " idle";
+    }
+    if (released > 0) {
+        message += ", " + to_string(released) + " locks released";
+    }
+    return true;
+}
+
+bool DispatchService::applyLock(const string& task_id, bool lock, string& message) {
+    if (!lock) {
+        bool erased = locked_.erase(task_id) > 0;
+        message = erased ? "task " + task_id + " unlocked" : "task " + task_id + " was not locked";
+        return erased;
+    }
+    const LoadTask* task = findPlanTask(task_id);
+    if (task == nullptr || !task->isAssigned() || task->getAssignedEmployeeCount() == 0) {
+        message = task == nullptr ? "unknown task " + task_id : "task " + task_id + " is not assigned";
+        return false;
+    }
+    LockedAssignment assignment;
+    assignment.start_time = task->getActualStartTime();
+    assignment.staff = task->getAssignedEmployeeIds();
+    locked_[task_id] = assignment;
+    message = "task " + task_id + " locked";
+    return true;
+}
+
+void DispatchService::queryPlan(const string& filter, vector<PlanChange>& records) const {
+    for (const auto& task : plan_) {
+        if (!filter.empty() && task.getTaskId() != filter && !task.isAssignedToEmployee(filter)) {
+            continue;
+        }
+        PlanChange record;
+        record.task_id = task.getTaskId();
+        if (task.isAssigned()) {
+            record.old_start = record.new_start = task.getActualStartTime();
+            record.old_staff = record.new_staff = task.getAssignedEmployeeIds();
+        }
+        records.push_back(record);
+    }
+}
+
+void DispatchService::redispatch(vector<PlanChange>* changes) {
+    vector<LoadTask> tasks = base_tasks_;
+    vector<LoadEmployeeInfo> employees = base_employees_;
+
+    // 锁定的分配先写入任务和员工，调度时作为已分配任务跳过
+    if (!locked_.empty()) {
+        unordered_map<string, size_t> employee_index;
+        for (size_t i = 0; i < employees.size(); ++i) {
+            employee_index[employees[i].getEmployeeId()] = i;
+        }
+        for (auto& task : tasks) {
+            auto locked = locked_.find(task.getTaskId());
+            if (locked == locked_.end()) {
+                continue;
+            }
+            long start_time = locked->second.start_time;
+            if (start_time < task.getEarliestStartTime() ||
+                start_time + task.getDuration() > task.getLatestEndTime()) {
+                start_time = task.getEarliestStartTime();
+            }
+            task.setActualStartTime(start_time);
+            for (const auto& staff_id : locked->second.staff) {
+                task.addAssignedEmployeeId(staff_id);
+                auto employee = employee_index.find(staff_id);
+                if (employee != employee_index.end()) {
+                    employees[employee->second].getEmployeeInfo().addAssignedTaskId(task.getTaskId());
+                }
+            }
+            task.setAssigned(true);
+        }
+    }
+
+    if (plan_.empty()) {
+        // 首次派工与批处理测试程序一致
+        LoadScheduler scheduler;
+        scheduler.setWorkRules(work_rules_);
+        scheduler.setShiftWindows(shift_windows_);
+        scheduler.setBreaks(breaks_);
+        scheduler.setSkillRules(skill_rules_);
+        scheduler.setSkillLevels(skill_levels_);
+        scheduler.scheduleLoadTasks(employees, tasks, shifts_, vector<LoadScheduler::ShiftBlockPeriod>(),
+                                    nullptr, &group_name_to_employees_);
+        break_placements_ = scheduler.getBreakPlacements();
+    } else {
+        // 事件派工以当前方案为参考方案热启动，只修复冲突
+        StableRedispatcher redispatcher;
+        redispatcher.setWorkRules(work_rules_);
+        redispatcher.setShiftWindows(shift_windows_);
+        redispatcher.setBreaks(breaks_);
+        redispatcher.setSkillRules(skill_rules_);
+        redispatcher.setSkillLevels(skill_levels_);
+        redispatcher.redispatch(employees, tasks, StableRedispatcher::referenceFromTasks(plan_),
+                                group_name_to_employees_);
+        break_placements_ = redispatcher.getBreakPlacements();
+    }
+
+    AirportStaffScheduler::Output::PlanTable next_table;
+    plan_diff_.addTasks(next_table, tasks);
+    if (changes != nullptr) {
+        for (const auto& diff : plan_diff_.compare(plan_table_, next_table)) {
+            PlanChange record;
+            record.task_id = plan_diff_.getIds().get(diff.task);
+            record.old_start = diff.old_start;
+            record.new_start = diff.new_start;
+            record.old_staff = staffIds(plan_diff_, plan_diff_.getOldStaff(diff));
+            record.new_staff = staffIds(plan_diff_, plan_diff_.getNewStaff(diff));
+            changes->push_back(record);
+        }
+    }
+    plan_table_.swap(next_table);
+
+    plan_.swap(tasks);
+    plan_employees_.swap(employees);
+    plan_index_.clear();
+    plan_index_.reserve(plan_.size());
+    for (size_t i = 0; i < plan_.size(); ++i) {
+        plan_index_[plan_[i].getTaskId()] = i;
+    }
+    if (!vehicle_pool_.getVehicles().empty()) {
+        vehicle_pool_.assignVehicles(plan_);
+    }
+}
+
+const LoadTask* DispatchService::findPlanTask(const string& task_id) const {
+    auto it = plan_index_.find(task_id);
+    return it != plan_index_.end() ? &plan_[it->second] : nullptr;
+}
+
+}  // namespace zhuangxie_class
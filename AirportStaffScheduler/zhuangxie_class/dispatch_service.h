@@ -0,0 +1,119 @@
+/**
+ * @file dispatch_service.h
+ * @brief 装卸派工常驻服务（内存中保存单日模型和当前方案，逐条处理现场事件）
+ *
+ * 启动时加载一次单日模型并完成首次派工（结果与批处理测试程序一致），之后每个事件
+ * （航班时间变化、员工病假、锁定任务）只修改内存中的任务/员工状态，再以当前方案为
+ * 参考方案做稳定性优先的重新派工（stable_redispatch.h）：仍然可行的小组原样保留，
+ * 只有冲突的任务按改动代价重新选组，应答中返回前后两版方案的差异。
+ */
+
+#ifndef ZHUANGXIE_CLASS_DISPATCH_SERVICE_H
+#define ZHUANGXIE_CLASS_DISPATCH_SERVICE_H
+
+#include "dispatch_protocol.h"
+#include "load_employee_info.h"
+#include "load_task.h"
+#include "group_work_state.h"
+#include "skill_tiers.h"
+#include "vehicle_pool.h"
+#include "../BreakTimeline.h"
+#include "../DayModel.h"
+#include "../PlanDiff.h"
+#include "../vip_first_class_algo/shift.h"
+#include <vector>
+#include <string>
+#include <map>
+#include <unordered_map>
+
+namespace zhuangxie_class {
+
+using namespace std;
+
+/**
+ * @brief 装卸派工常驻服务
+ */
+class DispatchService {
+public:
+    /**
+     * @brief 构造函数
+     */
+    DispatchService();
+
+    /**
+     * @brief 析构函数
+     */
+    ~DispatchService();
+
+    /**
+     * @brief 加载单日模型并完成首次派工
+     * @param input_dir 输入目录（以/结尾）
+     * @return 模型中有任务和员工返回true
+     */
+    bool load(const string& input_dir);
+
+    /**
+     * @brief 处理一个请求
+     * @param request 请求
+     * @return 应答（含处理耗时和方案变化）
+     */
+    DispatchResponse handle(const DispatchRequest& request);
+
+    /**
+     * @brief 当前方案（按调度顺序）
+     */
+    const vector<LoadTask>& getPlan() const { return plan_; }
+
+    /**
+     * @brief 当前方案对应的员工列表（含已分配任务ID）
+     */
+    const vector<LoadEmployeeInfo>& getPlanEmployees() const { return plan_employees_; }
+
+private:
+    /**
+     * @brief 锁定的分配（重新派工时原样保留）
+     */
+    struct LockedAssignment {
+        long start_time;              ///< 锁定时的实际开始时间
+        vector<string> staff;         ///< 锁定时的分配员工
+    };
+
+    bool applyFlightUpdate(const string& flight_id, long delay, string& message);
+    bool applyStaffSick(const string& staff_id, string& message);
+    bool applyLock(const string& task_id, bool lock, string& message);
+    void queryPlan(const string& filter, vector<PlanChange>& records) const;
+
+    /**
+     * @brief 以当前方案为参考方案重新派工（首次派工走LoadScheduler），并输出前后方案的差异
+     * @param changes 输出参数，方案变化
+     */
+    void redispatch(vector<PlanChange>* changes);
+
+    /**
+     * @brief 按任务ID查找当前方案中的任务
+     */
+    const LoadTask* findPlanTask(const string& task_id) const;
+
+    AirportStaffScheduler::Model::DayModel model_;       ///< 单日模型（只加载一次）
+    vector<LoadTask> base_tasks_;                        ///< 未分配的任务（已应用航班时间变化）
+    vector<LoadEmployeeInfo> base_employees_;            ///< 在岗员工（不含病假员工，无已分配任务）
+    map<string, vector<string>> group_name_to_employees_;  ///< 班组映射（病假员工保留位置）
+    vector<vip_first_class::Shift> shifts_;              ///< 班次列表
+    LoadWorkRules work_rules_;                           ///< 连续工作规则
+    vector<StaffShiftWindow> shift_windows_;             ///< 员工班期（shift.csv）
+    VehiclePool vehicle_pool_;                           ///< 车辆池（当前方案的派车结果）
+    vector<AirportStaffScheduler::Breaks::StaffBreak> breaks_;  ///< 员工休息（break.csv）
+    vector<AirportStaffScheduler::Breaks::BreakPlacement> break_placements_;  ///< 当前方案的休息位置
+    LoadSkillRules skill_rules_;                         ///< 熟练度规则（parameter.csv + skill.csv）
+    vector<EmployeeSkill> skill_levels_;                 ///< 员工资质熟练度（qualLevel.csv）
+    map<string, LockedAssignment> locked_;               ///< 任务ID -> 锁定的分配
+    vector<LoadTask> plan_;                              ///< 当前方案（按调度顺序）
+    vector<LoadEmployeeInfo> plan_employees_;            ///< 当前方案的员工状态
+    unordered_map<string, size_t> plan_index_;           ///< 任务ID -> plan_下标
+    AirportStaffScheduler::Output::PlanDiff plan_diff_;  ///< 方案差异计算器
+    AirportStaffScheduler::Output::PlanTable plan_table_;  ///< 当前方案的（任务, 员工, 时间）行
+};
+
+}  // namespace zhuangxie_class
+
+#endif  // ZHUANGXIE_CLASS_DISPATCH_SERVICE_H
@@ -0,0 +1,70 @@
+/**
+ * @file group_kernels.h
+ * @brief 按小组人数展开的组员检查
+ *
+ * 派工过滤小组时要对每名组员做同样的检查（是否已分配到当前任务、是否空闲）。
+ * 小组人数GROUP_SIZE是编译期常量，分组、派工、重排和产能扫描都用这一个定义；
+ * 按它检查时用模板展开成固定次数的检查，其他人数走运行时循环；
+ * 检查按组员顺序进行，遇到第一个不满足的组员即返回。
+ */
+
+#ifndef ZHUANGXIE_CLASS_GROUP_KERNELS_H
+#define ZHUANGXIE_CLASS_GROUP_KERNELS_H
+
+namespace zhuangxie_class {
+
+/**
+ * @brief 每个小组的人数（按班组名切分员工列表时每GROUP_SIZE人一组）
+ */
+constexpr int GROUP_SIZE = 3;
+
+/**
+ * @brief N人小组的组员检查（编译期展开）
+ */
+template <int N>
+struct GroupKernel {
+    /**
+     * @brief 组员0..N-1是否都满足条件
+     * @param pred 以组员下标为参数的检查
+     */
+    template <typename Pred>
+    static bool all(Pred& pred) {
+        return GroupKernel<N - 1>::all(pred) && pred(N - 1);
+    }
+};
+
+template <>
+struct GroupKernel<0> {
+    template <typename Pred>
+    static bool all(Pred&) {
+        return true;
+    }
+};
+
+/**
+ * @brief N人小组的组员是否都满足条件（编译期展开，一般用 allMembers<GROUP_SIZE>）
+ * @param pred 以组员下标为参数的检查
+ */
+template <int N, typename Pred>
+inline bool allMembers(Pred pred) {
+    return GroupKernel<N>::all(pred);
+}
+
+/**
+ * @brief 小组的组员是否都满足条件（人数只在运行时知道时使用）
+ * @param group_size 小组人数
+ * @param pred 以组员下标为参数的检查
+ */
+template <typename Pred>
+inline bool allMembers(int group_size, Pred pred) {
+    for (int m = 0; m < group_size; ++m) {
+        if (!pred(m)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace zhuangxie_class
+
+#endif  // ZHUANGXIE_CLASS_GROUP_KERNELS_H
@@ -0,0 +1,211 @@
+/**
+ * @file group_work_state.cpp
+ * @brief 装卸小组的连续工作状态实现
+ */
+
+#include "group_work_state.h"
+#include <algorithm>
+
+namespace zhuangxie_class {
+
+using namespace std;
+
+GroupWorkTracker::GroupWorkTracker(const LoadWorkRules& rules)
+    : rules_(rules)
+{
+}
+
+GroupWorkTracker::~GroupWorkTracker()
+{
+}
+
+void GroupWorkTracker::reset(size_t group_count) {
+    groups_.assign(group_count, GroupState());
+}
+
+void GroupWorkTracker::addMemberShift(int group, const StaffShiftWindow& window) {
+    const long DAY = 24 * 3600;
+    GroupState& state = groups_[group];
+    long end = window.end > window.start ? window.end : window.end + DAY;
+    state.shift_start = max(state.shift_start, window.start);
+    state.shift_end = min(state.shift_end, end);
+    state.overtime_end = min(state.overtime_end, end + (window.allow_overtime ? rules_.max_overtime : 0));
+}
+
+void GroupWorkTracker::findMerge(const vector<Span>& chains, long start, long end,
+                                 size_t& first, size_t& last) const {
+    long rest = rules_.min_continuous_rest;
+    last = chains.size();
+    if (chains.empty() || chains.back().end + rest <= start) {
+        // 追加在最后一条链之后且空档足够休息
+        first = last;
+        return;
+    }
+    if (chains.back().start < end + rest &&
+        (chains.size() == 1 || chains[chains.size() - 2].end + rest <= start)) {
+        // 并入最后一条链
+        first = last - 1;
+        return;
+    }
+    // 乱序插入：链按开始时间有序且互不相连，结束时间同样有序
+    first = lower_bound(chains.begin(), chains.end(), start,
+                        [rest](const Span& chain, long value) { return chain.end + rest <= value; }) - chains.begin();
+    last = lower_bound(chains.begin() + first, chains.end(), end,
+                       [rest](const Span& chain, long value) { return chain.start < value + rest; }) - chains.begin();
+}
+
+size_t GroupWorkTracker::entryPosition(const vector<Entry>& entries, long start) {
+    if (entries.empty() || entries.back().start <= start) {
+        return entries.size();
+    }
+    return upper_bound(entries.begin(), entries.end(), start,
+                       [](long value, const Entry& entry) { return value < entry.start; }) - entries.begin();
+}
+
+bool GroupWorkTracker::overlapWithNeighbors(const vector<Entry>& entries, size_t position,
+                                            long start, long end, Span& overlap) {
+    bool found = false;
+    if (position > 0 && entries[position - 1].end > start) {
+        overlap.start = start;
+        overlap.end = min(end, entries[position - 1].end);
+        found = true;
+    }
+    if (position < entries.size() && entries[position].start < end) {
+        long overlap_start = entries[position].start;
+        long overlap_end = min(end, entries[position].end);
+        overlap.start = found ? min(overlap.start, overlap_start) : overlap_start;
+        overlap.end = found ? max(overlap.end, overlap_end) : overlap_end;
+        found = true;
+    }
+    return found;
+}
+
+long GroupWorkTracker::continuousWork(int group, long start, long end) const {
+    const vector<Span>& chains = groups_[group].chains;
+    size_t first = 0;
+    size_t last = 0;
+    findMerge(chains, start, end, first, last);
+    if (first == last) {
+        return end - start;
+    }
+    return max(end, chains[last - 1].end) - min(start, chains[first].start);
+}
+
+int GroupWorkTracker::remoteStreak(int group, long start, long end, bool remote) const {
+    if (!remote) {
+        return 0;
+    }
+    const GroupState& state = groups_[group];
+    const vector<Entry>& entries = state.entries;
+    int limit = rules_.max_remote_streak > 0 ? rules_.max_remote_streak + 1 : static_cast<int>(entries.size()) + 1;
+    size_t position = entryPosition(entries, start);
+    if (position == entries.size() && rules_.max_remote_streak > 0) {
+        // 追加在末尾：直接用末尾的连续个数（只在规则生效时维护）
+        if (!entries.empty() && remoteLinked(entries.back().end, entries.back().remote, start, true)) {
+            return min(state.tail_remote_streak + 1, limit);
+        }
+        return 1;
+    }
+
+    int count = 1;
+    long linked_start = start;
+    for (size_t i = position; i > 0 && count < limit; --i) {
+        const Entry& prev = entries[i - 1];
+        if (!remoteLinked(prev.end, prev.remote, linked_start, true)) {
+            break;
+        }
+        linked_start = prev.start;
+        count++;
+    }
+    long linked_end = end;
+    for (size_t i = position; i < entries.size() && count < limit; ++i) {
+        const Entry& next = entries[i];
+        if (!remoteLinked(linked_end, true, next.start, next.remote)) {
+            break;
+        }
+        linked_end = next.end;
+        count++;
+    }
+    return count;
+}
+
+bool GroupWorkTracker::canDoubleOperate(int group, long start, long end) const {
+    if (rules_.min_double_interval <= 0) {
+        return true;
+    }
+    const GroupState& state = groups_[group];
+    Span overlap;
+    if (!overlapWithNeighbors(state.entries, entryPosition(state.entries, start), start, end, overlap)) {
+        return true;
+    }
+    long interval = rules_.min_double_interval;
+    if (state.doubles.empty() || state.doubles.back().end + interval <= overlap.start) {
+        return true;
+    }
+    // 双机作业只由强制分配产生，数量很少，逐个检查
+    for (const auto& previous : state.doubles) {
+        if (previous.end + interval > overlap.start && previous.start < overlap.end + interval) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void GroupWorkTracker::addTask(int group, long start, long end, bool remote) {
+    GroupState& state = groups_[group];
+
+    // 连续工作链
+    vector<Span>& chains = state.chains;
+    size_t first = 0;
+    size_t last = 0;
+    findMerge(chains, start, end, first, last);
+    Span merged;
+    merged.start = start;
+    merged.end = end;
+    if (first == last) {
+        chains.insert(chains.begin() + first, merged);
+    } else {
+        merged.start = min(start, chains[first].start);
+        merged.end = max(end, chains[last - 1].end);
+        chains[first] = merged;
+        chains.erase(chains.begin() + first + 1, chains.begin() + last);
+    }
+
+    // 双机作业时段
+    vector<Entry>& entries = state.entries;
+    size_t position = entryPosition(entries, start);
+    Span overlap;
+    if (overlapWithNeighbors(entries, position, start, end, overlap)) {
+        auto it = upper_bound(state.doubles.begin(), state.doubles.end(), overlap.start,
+                              [](long value, const Span& span) { return value < span.start; });
+        state.doubles.insert(it, overlap);
+    }
+
+    // 远机位连续个数
+    int streak = rules_.max_remote_streak > 0 ? remoteStreak(group, start, end, remote) : 0;
+    Entry entry;
+    entry.start = start;
+    entry.end = end;
+    entry.remote = remote;
+    bool append = position == entries.size();
+    entries.insert(entries.begin() + position, entry);
+    if (rules_.max_remote_streak <= 0) {
+        state.tail_remote_streak = 0;
+    } else if (append) {
+        state.tail_remote_streak = streak;
+    } else if (entries.back().remote) {
+        // 乱序插入可能改变末尾所在的连续段，从末尾向前重新数到上限
+        int count = 1;
+        for (size_t i = entries.size() - 1; i > 0 && count <= rules_.max_remote_streak; --i) {
+            if (!remoteLinked(entries[i - 1].end, entries[i - 1].remote, entries[i].start, true)) {
+                break;
+            }
+            count++;
+        }
+        state.tail_remote_streak = count;
+    } else {
+        state.tail_remote_streak = 0;
+    }
+}
+
+}  // namespace zhuangxie_class
@@ -0,0 +1,214 @@
+/**
+ * @file group_work_state.h
+ * @brief 装卸小组的连续工作状态（增量维护，O(1)查询连续工作时长、远机位连续个数和双机作业间隔）
+ *
+ * 每个小组按时间顺序保存若干段"连续工作链"：相邻两个任务之间的空档短于
+ * 最小连续休息时长时算作连续工作，属于同一条链；空档达到最小连续休息时长才算休息，
+ * 开始新的一条链。派工时只需找到候选任务会并入的链，就能得到放入后的连续工作时长，
+ * 不必再收集、排序小组成员的全部已分配任务。
+ *
+ * 同时按时间顺序保存小组的任务，维护末尾的远机位连续个数和双机作业时段：
+ * - 远机位连续：按时间相邻的两个任务都是远机位、且后一个任务开始距前一个任务结束
+ *   不足"远机位连续任务结束后的最小间隔"时属于同一段连续，连续个数不能超过上限；
+ * - 双机作业：小组同时保障两个任务（时间重叠，只会由强制分配产生），重叠时段即一次
+ *   双机作业，相邻两次双机作业之间的间隔不能小于"双机作业最小间隔"。
+ *
+ * 班期：每名组员的班期开始/结束时间（shift.csv）取交集后缓存在小组上，作为硬边界：
+ * 任务不能早于小组班期开始，也不能晚于小组可加班到的时刻（组员都允许加班时为班期结束
+ * 加最大加班时间，否则为班期结束）；超出班期结束的部分是加班，只作为选组得分的软约束。
+ * 班期跨零点时，早于班期开始的任务时间按次日计。
+ *
+ * 任务大多按时间顺序追加到末尾，此时查询和更新都是O(1)；乱序插入时二分查找所在位置，
+ * 远机位连续个数只向前后各数到上限为止。
+ */
+
+#ifndef ZHUANGXIE_CLASS_GROUP_WORK_STATE_H
+#define ZHUANGXIE_CLASS_GROUP_WORK_STATE_H
+
+#include <vector>
+#include <string>
+#include <climits>
+
+namespace zhuangxie_class {
+
+using namespace std;
+
+/**
+ * @brief 连续工作规则（来自parameter.csv，时长单位：秒；0表示不限制）
+ */
+struct LoadWorkRules {
+    long max_continuous_work = 0;      ///< 最大连续工作时长
+    long min_continuous_rest = 0;      ///< 最小连续休息时长，短于该时长的空档不算休息
+    int max_remote_streak = 0;         ///< 最大连续远机位任务个数
+    long min_remote_rest = 0;          ///< 下一次远机位任务开始与上次连续远机位任务结束的最小间隔
+    long min_double_interval = 0;      ///< 下一次双机作业与上一次双机作业的最小间隔
+    long max_overtime = 0;             ///< 最大加班时间（班期结束后允许加班的员工最多延长的时长）
+};
+
+/**
+ * @brief 员工班期（shift.csv的班期开始/结束时间，单位秒；结束不晚于开始表示跨零点）
+ */
+struct StaffShiftWindow {
+    string employee_id;                ///< 员工编号
+    long start = 0;                    ///< 班期开始时间
+    long end = 0;                      ///< 班期结束时间
+    bool allow_overtime = false;       ///< 是否允许加班
+};
+
+/**
+ * @brief 所有小组的连续工作状态
+ */
+class GroupWorkTracker {
+public:
+    /**
+     * @brief 构造函数
+     * @param rules 连续工作规则
+     */
+    explicit GroupWorkTracker(const LoadWorkRules& rules = LoadWorkRules());
+
+    /**
+     * @brief 析构函数
+     */
+    ~GroupWorkTracker();
+
+    /**
+     * @brief 清空状态
+     * @param group_count 小组个数（小组编号为0 ~ group_count-1）
+     */
+    void reset(size_t group_count);
+
+    /**
+     * @brief 小组执行[start, end)任务后，该任务所在连续工作链的时长
+     */
+    long continuousWork(int group, long start, long end) const;
+
+    /**
+     * @brief 小组执行[start, end)任务是否不超过最大连续工作时长
+     */
+    bool canWork(int group, long start, long end) const {
+        return rules_.max_continuous_work <= 0 || continuousWork(group, start, end) <= rules_.max_continuous_work;
+    }
+
+    /**
+     * @brief 小组执行[start, end)任务后，该任务所在远机位连续段的任务个数（近机位任务为0；最多数到上限+1）
+     */
+    int remoteStreak(int group, long start, long end, bool remote) const;
+
+    /**
+     * @brief 小组执行[start, end)任务是否不超过最大连续远机位任务个数
+     */
+    bool canWorkRemote(int group, long start, long end, bool remote) const {
+        return !remote || rules_.max_remote_streak <= 0 || remoteStreak(group, start, end, remote) <= rules_.max_remote_streak;
+    }
+
+    /**
+     * @brief 小组执行[start, end)任务是否满足双机作业最小间隔（不与已有任务重叠时总是满足）
+     */
+    bool canDoubleOperate(int group, long start, long end) const;
+
+    /**
+     * @brief 小组已有的双机作业次数
+     */
+    size_t doubleCount(int group) const { return groups_[group].doubles.size(); }
+
+    /**
+     * @brief 把一名组员的班期并入小组班期（取交集；没有并入任何班期的小组全天可用）
+     */
+    void addMemberShift(int group, const StaffShiftWindow& window);
+
+    /**
+     * @brief 小组执行[start, end)任务是否在班期内（含允许的加班）
+     */
+    bool inShift(int group, long start, long end) const {
+        const GroupState& state = groups_[group];
+        long offset = dayOffset(state, start);
+        return start + offset >= state.shift_start && end + offset <= state.overtime_end;
+    }
+
+    /**
+     * @brief 小组执行[start, end)任务的加班时长（超出班期结束的部分，不超出为0）
+     */
+    long overtime(int group, long start, long end) const {
+        const GroupState& state = groups_[group];
+        long over = end + dayOffset(state, start) - state.shift_end;
+        return over > 0 ? over : 0;
+    }
+
+    /**
+     * @brief 记录小组执行[start, end)任务（合并相邻的连续工作链，更新远机位连续个数和双机作业时段）
+     */
+    void addTask(int group, long start, long end, bool remote);
+
+    /**
+     * @brief 获取连续工作规则
+     */
+    const LoadWorkRules& getRules() const { return rules_; }
+
+private:
+    /**
+     * @brief 一段时间（连续工作链或双机作业时段）
+     */
+    struct Span {
+        long start;                    ///< 开始时间
+        long end;                      ///< 结束时间
+    };
+
+    /**
+     * @brief 小组已执行的一个任务
+     */
+    struct Entry {
+        long start;                    ///< 开始时间
+        long end;                      ///< 结束时间
+        bool remote;                   ///< 是否远机位
+    };
+
+    /**
+     * @brief 单个小组的状态
+     */
+    struct GroupState {
+        vector<Span> chains;           ///< 按开始时间有序、互不相连的连续工作链
+        vector<Entry> entries;         ///< 按开始时间有序的任务
+        vector<Span> doubles;          ///< 按开始时间有序的双机作业时段
+        int tail_remote_streak = 0;    ///< 末尾任务所在远机位连续段的个数
+        long shift_start = LONG_MIN;   ///< 小组班期开始（组员班期的交集）
+        long shift_end = LONG_MAX;     ///< 小组班期结束
+        long overtime_end = LONG_MAX;  ///< 小组最晚可加班到的时刻
+    };
+
+    /**
+     * @brief 班期跨零点时，早于班期开始的任务按次日计的时间偏移（0或一天）
+     */
+    static long dayOffset(const GroupState& state, long start) {
+        const long DAY = 24 * 3600;
+        return start < state.shift_start && state.shift_end > DAY && start + DAY <= state.overtime_end ? DAY : 0;
+    }
+
+    /**
+     * @brief 查找[start, end)会并入的链的下标范围[first, last)
+     */
+    void findMerge(const vector<Span>& chains, long start, long end, size_t& first, size_t& last) const;
+
+    /**
+     * @brief 任务在entries中的插入位置（开始时间相同的排在后面）
+     */
+    static size_t entryPosition(const vector<Entry>& entries, long start);
+
+    /**
+     * @brief 按时间相邻的两个任务是否属于同一段远机位连续
+     */
+    bool remoteLinked(long prev_end, bool prev_remote, long next_start, bool next_remote) const {
+        return prev_remote && next_remote && (rules_.min_remote_rest <= 0 || next_start - prev_end < rules_.min_remote_rest);
+    }
+
+    /**
+     * @brief [start, end)与插入位置前后相邻任务的重叠时段，没有重叠返回false
+     */
+    static bool overlapWithNeighbors(const vector<Entry>& entries, size_t position, long start, long end, Span& overlap);
+
+    LoadWorkRules rules_;              ///< 连续工作规则
+    vector<GroupState> groups_;        ///< 每个小组的状态
+};
+
+}  // namespace zhuangxie_class
+
+#endif  // ZHUANGXIE_CLASS_GROUP_WORK_STATE_H
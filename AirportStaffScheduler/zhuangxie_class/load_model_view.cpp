@@ -0,0 +1,325 @@
+/**
+ * @file load_model_view.cpp
+ * @brief 装卸模块的单日模型视图实现
+ */
+
+#include "load_model_view.h"
+#include "connect_rule_table.h"
+#include "../vip_first_class_algo/employee_info.h"
+#include <iostream>
+
+namespace zhuangxie_class {
+
+using namespace std;
+using AirportStaffScheduler::Model::DayModel;
+
+namespace {
+
+/**
+ * @brief 按冒号（半角或全角）切分参数值
+ */
+vector<string> splitColon(const string& value) {
+    const string full_width = "：";
+    vector<string> parts(1);
+    for (size_t i = 0; i < value.size(); ++i) {
+        if (value[i] == ':') {
+            parts.push_back(string());
+        } else if (value.compare(i, full_width.size(), full_width) == 0) {
+            parts.push_back(string());
+            i += full_width.size() - 1;
+        } else {
+            parts.back() += value[i];
+        }
+    }
+    return parts;
+}
+
+}  // namespace
+
+LoadModelView::LoadModelView(DayModel& model)
+    : model_(model)
+{
+}
+
+LoadModelView::~LoadModelView()
+{
+}
+
+bool LoadModelView::buildTasks(vector<LoadTask>& tasks) const
+{
+    tasks.clear();
+    const auto& t = model_.tasks;
+    const auto& pool = model_.strings;
+    tasks.reserve(t.size());
+
+    for (size_t row = 0; row < t.size(); ++row) {
+        LoadTask task;
+        const string& task_name = pool.get(t.task_name[row]);
+        const string& flight_attribute = pool.get(t.flight_attribute[row]);
+        const string& stand_str = pool.get(t.stand[row]);
+
+        task.setTaskId(pool.get(t.task_id[row]));
+        task.setTaskName(task_name);
+        task.setTaskDate(pool.get(t.task_date[row]));
+        task.setArrivalFlightId(pool.get(t.arrival_flight_id[row]));
+        task.setDepartureFlightId(pool.get(t.departure_flight_id[row]));
+        task.setArrivalFlightNumber(pool.get(t.arrival_flight_number[row]));
+        task.setDepartureFlightNumber(pool.get(t.departure_flight_number[row]));
+        task.setTerminal(pool.get(t.terminal[row]));
+
+        // 任务时长即保障时间
+        task.setEarliestStartTime(t.start_time[row]);
+        task.setLatestEndTime(t.start_time[row] + t.duration[row]);
+        task.setDuration(t.duration[row]);
+        task.setArrivalTime(t.arrival_time[row]);
+        task.setDepartureTime(t.departure_time[row]);
+
+        // 航班类型（全部按国内处理）
+        FlightType flight_type = FlightType::DOMESTIC_ARRIVAL;
+        if (task_name.find("进港") != string::npos) {
+            flight_type = FlightType::DOMESTIC_ARRIVAL;
+        } else if (task_name.find("出港") != string::npos) {
+            flight_type = FlightType::DOMESTIC_DEPARTURE;
+        } else if (flight_attribute.find("过站") != string::npos) {
+            flight_type = FlightType::DOMESTIC_TRANSIT;
+        }
+        task.setFlightTypeEnum(flight_type);
+        task.setBodyType(ConnectRuleTable::parseBodyType(pool.get(t.body_type[row])));
+
+        int stand_num = 0;
+        if (!stand_str.empty()) {
+            try {
+                stand_num = stoi(stand_str);
+            } catch (...) {
+                stand_num = 0;
+            }
+        }
+        task.setStand(stand_num);
+        task.setRemoteStand(model_.isRemoteStand(t.stand[row]));
+        task.setTravelTime(8 * 60);
+        task.setRequiredVehicleType(pool.get(t.vehicle_type[row]));
+
+        // 人数：优先读取人数，无人数根据吨位判断（2.5吨以上6人，否则3人）
+        int required_count = t.required_count[row];
+        if (required_count <= 0 && t.cargo_weight[row] >= 0.0) {
+            required_count = t.cargo_weight[row] >= 2.5 ? 6 : 3;
+        }
+        if (required_count <= 0) {
+            required_count = 3;
+        }
+        task.setRequiredCount(required_count);
+
+        task.setPreferMainShift(true);
+        task.setCanNewEmployee(false);
+        task.setAssigned(false);
+        task.setShortStaffed(false);
+        task.setRequiredQualification(0);
+
+        tasks.push_back(task);
+    }
+    return !tasks.empty();
+}
+
+bool LoadModelView::buildEmployees(vector<LoadEmployeeInfo>& employees,
+                                   map<string, vector<string>>& group_name_to_employees) const
+{
+    employees.clear();
+    group_name_to_employees.clear();
+    const auto& s = model_.staff;
+    const auto& g = model_.groups;
+    const auto& pool = model_.strings;
+
+    // 员工按编号排序输出（与CSVLoader::loadEmployeesFromShiftCSV一致）
+    map<string, size_t> sorted_rows;
+    for (size_t row = 0; row < s.size(); ++row) {
+        sorted_rows[pool.get(s.staff_id[row])] = row;
+    }
+    employees.reserve(sorted_rows.size());
+    for (const auto& pair : sorted_rows) {
+        LoadEmployeeInfo emp;
+        emp.setEmployeeId(pair.first);
+        emp.setEmployeeName(pool.get(s.staff_name[pair.second]));
+        // 装卸员工默认给予外场资质
+        emp.setQualificationMask(static_cast<int>(vip_first_class::QualificationMask::EXTERNAL));
+        employees.push_back(emp);
+    }
+
+    for (size_t group = 0; group < g.size(); ++group) {
+        vector<string>& members = group_name_to_employees[pool.get(g.group_name[group])];
+        for (int i = g.member_begin[group]; i < g.member_begin[group + 1]; ++i) {
+            members.push_back(pool.get(s.staff_id[g.members[i]]));
+        }
+    }
+    return !employees.empty();
+}
+
+void LoadModelView::buildShifts(vector<vip_first_class::Shift>& shifts) const
+{
+    shifts.clear();
+    const auto& g = model_.groups;
+    const auto& pool = model_.strings;
+
+    for (size_t group = 0; group < g.size() && group < 8; ++group) {
+        vip_first_class::Shift shift;
+        shift.setShiftType(g.shift_type[group]);
+        int position = 1;
+        for (int i = g.member_begin[group]; i < g.member_begin[group + 1]; ++i) {
+            shift.setEmployeeIdAtPosition(position++, pool.get(model_.staff.staff_id[g.members[i]]));
+        }
+        shifts.push_back(shift);
+    }
+}
+
+int LoadModelView::buildConnectRules(ConnectRuleTable& table) const
+{
+    const auto& pool = model_.strings;
+    table.reset();
+    for (const auto& rule : model_.rules.connect_rules) {
+        table.setRule(pool.get(rule.prev_direction), pool.get(rule.prev_body_type),
+                      pool.get(rule.next_direction), rule.min_interval);
+    }
+    return table.getRuleCount();
+}
+
+void LoadModelView::buildWorkRules(LoadWorkRules& rules) const
+{
+    rules = LoadWorkRules();
+    rules.max_continuous_work = model_.rules.getLong("最大连续工作时长", 0) * 60;
+    rules.min_continuous_rest = model_.rules.getLong("最小连续休息时长", 0) * 60;
+    rules.max_remote_streak = static_cast<int>(model_.rules.getLong("最大连续远机位任务个数", 0));
+    rules.min_remote_rest = model_.rules.getLong("下一次远机位任务开始时间和上次连续远机位任务结束的最小时间间隔", 0) * 60;
+    rules.min_double_interval = model_.rules.getLong("下一次双机作业和上一次双机作业最小时间间隔", 0) * 60;
+    rules.max_overtime = model_.rules.getLong("最大加班时间", 0) * 60;
+}
+
+void LoadModelView::buildShiftWindows(vector<StaffShiftWindow>& windows) const
+{
+    windows.clear();
+    const auto& s = model_.staff;
+    const auto& pool = model_.strings;
+    windows.reserve(s.size());
+    for (size_t row = 0; row < s.size(); ++row) {
+        if (s.shift_start[row] == 0 && s.shift_end[row] == 0) {
+            continue;
+        }
+        StaffShiftWindow window;
+        window.employee_id = pool.get(s.staff_id[row]);
+        window.start = s.shift_start[row];
+        window.end = s.shift_end[row];
+        window.allow_overtime = s.allow_overtime[row] != 0;
+        windows.push_back(window);
+    }
+}
+
+void LoadModelView::buildVehicles(vector<LoadVehicle>& vehicles) const
+{
+    vehicles.clear();
+    const auto& v = model_.vehicles;
+    const auto& pool = model_.strings;
+    vehicles.reserve(v.size());
+    for (size_t row = 0; row < v.size(); ++row) {
+        LoadVehicle vehicle;
+        vehicle.plate = pool.get(v.plate[row]);
+        vehicle.vehicle_type = pool.get(v.vehicle_type[row]);
+        vehicle.available = v.available[row] != 0;
+        vehicle.bound_employee_id = pool.get(v.bound_staff[row]);
+        vehicles.push_back(vehicle);
+    }
+}
+
+void LoadModelView::buildVehicleRules(VehicleRules& rules) const
+{
+    rules = VehicleRules();
+    auto it = model_.rules.parameters.find("车辆衔接偏好");
+    if (it != model_.rules.parameters.end()) {
+        const string& value = it->second;
+        rules.follow_crew = !(value == "N" || value == "n" || value == "否" || value == "0");
+    }
+}
+
+void LoadModelView::buildBreaks(vector<AirportStaffScheduler::Breaks::StaffBreak>& breaks) const
+{
+    breaks.clear();
+    const auto& b = model_.breaks;
+    const auto& pool = model_.strings;
+    breaks.reserve(b.size());
+    for (size_t row = 0; row < b.size(); ++row) {
+        AirportStaffScheduler::Breaks::StaffBreak item;
+        item.staff_id = pool.get(b.staff_id[row]);
+        item.name = pool.get(b.name[row]);
+        item.start = b.start_time[row];
+        item.end = b.end_time[row];
+        item.locked = b.locked[row] != 0;
+        breaks.push_back(item);
+    }
+}
+
+void LoadModelView::buildSkillRules(LoadSkillRules& rules) const
+{
+    using AirportStaffScheduler::Model::parseLongOr;
+    rules = LoadSkillRules();
+    auto it = model_.rules.parameters.find("航班人员资质熟练度限制");
+    if (it != model_.rules.parameters.end() && !it->second.empty()) {
+        vector<string> parts = splitColon(it->second);
+        size_t level_part = parts.size() == 1 ? 0 : 1;
+        long level = parseLongOr(parts[level_part], -1);
+        long members = parts.size() > 2 ? parseLongOr(parts[2], -1) : 1;
+        if (parts.size() > 3 || level < 0 || members < 1 || (level_part == 1 && parts[0].empty())) {
+            cerr << "警告：航班人员资质熟练度限制无法解析，不限制熟练度: " << it->second << endl;
+        } else {
+            if (level_part == 1) {
+                rules.qualification = parts[0];
+            }
+            rules.min_level = static_cast<int>(level);
+            rules.min_members = static_cast<int>(members);
+        }
+    }
+
+    const auto& k = model_.skills;
+    const auto& pool = model_.strings;
+    rules.priorities.reserve(k.size());
+    for (size_t row = 0; row < k.size(); ++row) {
+        QualificationPriority item;
+        item.qualification = pool.get(k.qualification[row]);
+        item.double_priority = k.double_priority[row];
+        item.continuous_double_priority = k.continuous_double_priority[row];
+        rules.priorities.push_back(item);
+    }
+}
+
+void LoadModelView::buildSkillLevels(vector<EmployeeSkill>& levels) const
+{
+    levels.clear();
+    const auto& p = model_.proficiency;
+    const auto& pool = model_.strings;
+    levels.reserve(p.size());
+    for (size_t row = 0; row < p.size(); ++row) {
+        EmployeeSkill item;
+        item.employee_id = pool.get(model_.staff.staff_id[p.staff[row]]);
+        item.qualification = pool.get(p.qualification[row]);
+        item.level = p.level[row];
+        levels.push_back(item);
+    }
+}
+
+void LoadModelView::commitAssignments(const vector<LoadTask>& tasks)
+{
+    for (const auto& task : tasks) {
+        int row = model_.findTaskRow(task.getTaskId());
+        if (row < 0) {
+            cerr << "警告：模型中找不到任务，分配结果未回写: " << task.getTaskId() << endl;
+            continue;
+        }
+        model_.tasks.actual_start_time[row] = task.getActualStartTime();
+        vector<int>& assigned = model_.tasks.assigned_staff[row];
+        assigned.clear();
+        for (const auto& emp_id : task.getAssignedEmployeeIds()) {
+            int staff_row = model_.findStaffRow(emp_id);
+            if (staff_row >= 0) {
+                assigned.push_back(staff_row);
+            }
+        }
+    }
+}
+
+}  // namespace zhuangxie_class
@@ -0,0 +1,135 @@
+/**
+ * @file load_model_view.h
+ * @brief 装卸模块的单日模型视图
+ *
+ * 从统一的单日模型（AirportStaffScheduler::Model::DayModel）直接生成装卸调度输入，
+ * 调度完成后把分配结果回写到模型，供其他模块串联使用
+ */
+
+#ifndef ZHUANGXIE_CLASS_LOAD_MODEL_VIEW_H
+#define ZHUANGXIE_CLASS_LOAD_MODEL_VIEW_H
+
+#include "load_employee_info.h"
+#include "load_task.h"
+#include "group_work_state.h"
+#include "vehicle_pool.h"
+#include "skill_tiers.h"
+#include "../DayModel.h"
+#include "../BreakTimeline.h"
+#include "../vip_first_class_algo/shift.h"
+#include <vector>
+#include <string>
+#include <map>
+
+namespace zhuangxie_class {
+
+using namespace std;
+
+class ConnectRuleTable;
+
+/**
+ * @brief 装卸模块的单日模型视图
+ *
+ * 只持有模型引用，不复制模型数据
+ */
+class LoadModelView {
+public:
+    /**
+     * @brief 构造函数
+     * @param model 单日模型
+     */
+    explicit LoadModelView(AirportStaffScheduler::Model::DayModel& model);
+
+    /**
+     * @brief 析构函数
+     */
+    ~LoadModelView();
+
+    /**
+     * @brief 生成装卸任务列表
+     * @param tasks 输出参数，任务列表（按模型行顺序）
+     * @return 模型中有任务返回true
+     */
+    bool buildTasks(vector<LoadTask>& tasks) const;
+
+    /**
+     * @brief 生成员工列表和班组映射
+     * @param employees 输出参数，员工列表（按员工编号排序）
+     * @param group_name_to_employees 输出参数，班组名到员工ID列表的映射
+     * @return 模型中有员工返回true
+     */
+    bool buildEmployees(vector<LoadEmployeeInfo>& employees,
+                        map<string, vector<string>>& group_name_to_employees) const;
+
+    /**
+     * @brief 生成班次列表（最多8组，按班组首次出现顺序）
+     * @param shifts 输出参数，班次列表
+     */
+    void buildShifts(vector<vip_first_class::Shift>& shifts) const;
+
+    /**
+     * @brief 把模型中的航班衔接规则编译到规则表（先清空规则表）
+     * @param table 输出参数，规则表
+     * @return 编译的规则条数
+     */
+    int buildConnectRules(ConnectRuleTable& table) const;
+
+    /**
+     * @brief 从模型参数（parameter.csv，时长单位分钟）生成连续工作、远机位连续、双机作业和加班规则
+     * @param rules 输出参数，连续工作规则（未配置的参数为0，表示不限制）
+     */
+    void buildWorkRules(LoadWorkRules& rules) const;
+
+    /**
+     * @brief 生成员工班期列表（shift.csv的班期开始/结束时间和是否允许加班，按模型行顺序）
+     * @param windows 输出参数，班期列表（班期开始和结束都为空的员工不输出，即不限制班期）
+     */
+    void buildShiftWindows(vector<StaffShiftWindow>& windows) const;
+
+    /**
+     * @brief 生成车辆列表（vehicle.csv，按文件顺序）
+     * @param vehicles 输出参数，车辆列表（没有车辆文件时为空）
+     */
+    void buildVehicles(vector<LoadVehicle>& vehicles) const;
+
+    /**
+     * @brief 从模型参数（parameter.csv的车辆衔接偏好，N/否/0表示不沿用小组车辆）生成派车规则
+     * @param rules 输出参数，派车规则
+     */
+    void buildVehicleRules(VehicleRules& rules) const;
+
+    /**
+     * @brief 生成员工休息列表（break.csv，按文件顺序）
+     * @param breaks 输出参数，休息列表（没有休息文件时为空）
+     */
+    void buildBreaks(vector<AirportStaffScheduler::Breaks::StaffBreak>& breaks) const;
+
+    /**
+     * @brief 从模型参数（parameter.csv的航班人员资质熟练度限制）和skill.csv生成熟练度规则
+     *
+     * 熟练度限制的取值为"熟练度"、"资质:熟练度"或"资质:熟练度:人数"（冒号可为全角），
+     * 省略时资质为装卸资质、人数为1；为空或无法解析时不限制。
+     * 例如"3"表示小组中至少1人的装卸资质达到3级，"装卸资质:3:2"表示至少2人达到3级
+     * @param rules 输出参数，熟练度规则
+     */
+    void buildSkillRules(LoadSkillRules& rules) const;
+
+    /**
+     * @brief 生成员工资质熟练度列表（qualLevel.csv，按文件顺序）
+     * @param levels 输出参数，熟练度列表（没有熟练度文件时为空）
+     */
+    void buildSkillLevels(vector<EmployeeSkill>& levels) const;
+
+    /**
+     * @brief 把分配结果回写到模型
+     * @param tasks 调度后的任务列表
+     */
+    void commitAssignments(const vector<LoadTask>& tasks);
+
+private:
+    AirportStaffScheduler::Model::DayModel& model_;  ///< 单日模型
+};
+
+}  // namespace zhuangxie_class
+
+#endif  // ZHUANGXIE_CLASS_LOAD_MODEL_VIEW_H
@@ -0,0 +1,150 @@
+/**
+ * @file load_plan_export.cpp
+ * @brief 装卸排班结果导出实现
+ */
+
+#include "load_plan_export.h"
+#include "../PlanWriter.h"
+#include <unordered_map>
+#include <algorithm>
+#include <cstdio>
+
+namespace zhuangxie_class {
+
+using namespace std;
+using AirportStaffScheduler::Output::SolnShiftWriter;
+using AirportStaffScheduler::Breaks::BreakPlacement;
+
+namespace {
+
+/**
+ * @brief 休息行的任务ID：MEAL_日期 时:分:秒 + 员工编号
+ */
+string breakTaskId(const string& date, const BreakPlacement& item) {
+    char time_text[16];
+    long seconds = ((item.start % 86400) + 86400) % 86400;
+    snprintf(time_text, sizeof(time_text), " %02ld:%02ld:%02ld", seconds / 3600, seconds / 60 % 60, seconds % 60);
+    return "MEAL_" + date + time_text + item.staff_id;
+}
+
+}  // namespace
+
+bool exportLoadPlan(const vector<LoadTask>& tasks,
+                    const vector<LoadEmployeeInfo>& employees,
+                    const string& filename,
+                    const VehiclePool* vehicles,
+                    const vector<BreakPlacement>* breaks)
+{
+    // 装卸结果历史格式：跨天时间推进日期，行末多一个逗号
+    SolnShiftWriter writer(SolnShiftWriter::Format(true, true));
+    if (!writer.open(filename)) {
+        return false;
+    }
+    
+    // 创建任务ID到任务的映射
+    unordered_map<string, const LoadTask*> task_map;
+    task_map.reserve(tasks.size());
+    for (const auto& task : tasks) {
+        task_map[task.getTaskId()] = &task;
+    }
+    
+    // 员工ID到休息的映射
+    unordered_map<string, vector<const BreakPlacement*>> break_map;
+    if (breaks) {
+        for (const auto& item : *breaks) {
+            break_map[item.staff_id].push_back(&item);
+        }
+    }
+    
+    // 遍历所有员工，每个员工的任务行排好序后立即写出
+    vector<pair<const LoadTask*, long>> task_times;  // {task, start_time}
+    for (const auto& emp : employees) {
+        const auto& assigned_task_ids = emp.getEmployeeInfo().getAssignedTaskIds();
+        
+        if (assigned_task_ids.empty()) {
+            // 如果没有分配任务（休息），不输出
+            continue;
+        }
+        
+        // 按任务开始时间排序
+        task_times.clear();
+        for (const string& task_id : assigned_task_ids) {
+            auto it = task_map.find(task_id);
+            if (it != task_map.end() && it->second != nullptr) {
+                long start_time = it->second->getActualStartTime();
+                if (start_time > 0) {
+                    task_times.push_back({it->second, start_time});
+                }
+            }
+        }
+        
+        if (task_times.empty()) {
+            continue;
+        }
+        
+        sort(task_times.begin(), task_times.end(),
+             [](const pair<const LoadTask*, long>& a, const pair<const LoadTask*, long>& b) {
+                 return a.second < b.second;
+             });
+        
+        // 计算班期开始时间（第一个任务的开始时间）和结束时间（最晚的任务结束时间）
+        long shift_start_time = task_times.front().second;
+        long shift_end_time = 0;
+        for (const auto& task_time : task_times) {
+            const LoadTask* task = task_time.first;
+            long end_time = task->getActualEndTime();
+            // 如果实际结束时间为0，尝试使用实际开始时间 + 时长
+            if (end_time == 0) {
+                long actual_start = task->getActualStartTime();
+                long duration = task->getDuration();
+                if (actual_start > 0 && duration > 0) {
+                    end_time = actual_start + duration;
+                }
+            }
+            if (end_time > shift_end_time) {
+                shift_end_time = end_time;
+            }
+        }
+        
+        // 休息：班期延伸到覆盖休息，休息行与任务行按开始时间合并
+        const string& shift_date = task_times.front().first->getTaskDate();
+        vector<const BreakPlacement*> staff_breaks;
+        auto break_it = break_map.find(emp.getEmployeeId());
+        if (break_it != break_map.end()) {
+            staff_breaks = break_it->second;
+            sort(staff_breaks.begin(), staff_breaks.end(),
+                 [](const BreakPlacement* a, const BreakPlacement* b) { return a->start < b->start; });
+            for (const BreakPlacement* item : staff_breaks) {
+                shift_start_time = min(shift_start_time, item->start);
+                shift_end_time = max(shift_end_time, item->end);
+            }
+        }
+        
+        // 班期日期使用第一个任务的日期
+        writer.beginStaff(shift_date, shift_start_time, shift_end_time,
+                          emp.getEmployeeId(), emp.getEmployeeName());
+        size_t next_break = 0;
+        for (const auto& task_time : task_times) {
+            const LoadTask& task = *task_time.first;
+            for (; next_break < staff_breaks.size() && staff_breaks[next_break]->start < task_time.second; ++next_break) {
+                const BreakPlacement& item = *staff_breaks[next_break];
+                writer.writeBreak(breakTaskId(shift_date, item), item.name, shift_date, item.start, item.end);
+            }
+            const LoadVehicle* vehicle = vehicles ? vehicles->getTaskVehicle(task.getTaskId()) : nullptr;
+            if (vehicle) {
+                writer.writeTask(task, task.getActualStartTime(), task.getActualEndTime(),
+                                 vehicle->plate, vehicle->vehicle_type);
+            } else {
+                writer.writeTask(task, task.getActualStartTime(), task.getActualEndTime());
+            }
+        }
+        for (; next_break < staff_breaks.size(); ++next_break) {
+            const BreakPlacement& item = *staff_breaks[next_break];
+            writer.writeBreak(breakTaskId(shift_date, item), item.name, shift_date, item.start, item.end);
+        }
+    }
+    
+    return writer.close();
+}
+
+}  // namespace zhuangxie_class
@@ -0,0 +1,40 @@
+/**
+ * @file load_plan_export.h
+ * @brief 装卸排班结果导出（soln_shift.csv格式）
+ *
+ * 测试程序和派工守护进程共用，输出格式与原测试程序逐字节一致
+ */
+
+#ifndef ZHUANGXIE_CLASS_LOAD_PLAN_EXPORT_H
+#define ZHUANGXIE_CLASS_LOAD_PLAN_EXPORT_H
+
+#include "load_employee_info.h"
+#include "load_task.h"
+#include "vehicle_pool.h"
+#include "../BreakTimeline.h"
+#include <vector>
+#include <string>
+
+namespace zhuangxie_class {
+
+using namespace std;
+
+/**
+ * @brief 按员工导出任务时间表（每个员工的任务按实际开始时间排序，无任务的员工不输出）
+ * @param tasks 调度后的任务列表
+ * @param employees 员工列表（调度后，含已分配任务ID）
+ * @param filename 输出文件名
+ * @param vehicles 派车结果（为空时车辆列留空）
+ * @param breaks 休息位置（为空时不输出休息行）；有任务的员工的休息按开始时间插在任务行之间，
+ *               写成MEAL_行，日期取该员工第一个任务的日期
+ * @return 文件写入成功返回true
+ */
+bool exportLoadPlan(const vector<LoadTask>& tasks,
+                    const vector<LoadEmployeeInfo>& employees,
+                    const string& filename,
+                    const VehiclePool* vehicles = nullptr,
+                    const vector<AirportStaffScheduler::Breaks::BreakPlacement>* breaks = nullptr);
+
+}  // namespace zhuangxie_class
+
+#endif  // ZHUANGXIE_CLASS_LOAD_PLAN_EXPORT_H
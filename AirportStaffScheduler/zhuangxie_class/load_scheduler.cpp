@@ -5,18 +5,32 @@
 
 #include "load_scheduler.h"
 #include "stand_distance.h"
+#include "connect_rule_table.h"
+#include "group_work_state.h"
+#include "group_kernels.h"
+#include "../Profiler.h"
+#include "../Logger.h"
+#include "../ScratchArena.h"
 #include <algorithm>
 #include <map>
-#include <set>
-#include <tuple>
 #include <climits>
-#include <iostream>
 #include <sstream>
 
 namespace zhuangxie_class {
 
 using namespace std;
 using namespace vip_first_class;
+using AirportStaffScheduler::Breaks::BreakTimeline;
+using AirportStaffScheduler::Ids::IdRegistry;
+using AirportStaffScheduler::Ids::IdNames;
+using AirportStaffScheduler::Memory::MonotonicArena;
+using AirportStaffScheduler::Memory::ArenaVector;
+using AirportStaffScheduler::Memory::ArenaUnorderedMap;
+using AirportStaffScheduler::Memory::ArenaUnorderedSet;
+
+// 派工临时映射表（从本次派工的存储区分配）
+typedef ArenaUnorderedMap<int, LoadTask*> TaskPtrMap;                        // 任务ID编号 -> 任务
+typedef ArenaUnorderedMap<string, const LoadEmployeeInfo*> EmployeeMap;      // 员工ID -> 员工
 
 LoadScheduler::LoadScheduler()
 {
@@ -33,6 +47,9 @@ void LoadScheduler::scheduleLoadTasks(const vector<LoadEmployeeInfo>& employees,
                                      const vector<LoadTask>* previous_tasks,
                                      const map<string, vector<string>>* group_name_to_employees)
 {
+    PROFILE_SCOPE("load.schedule");
+    trace_.clear();
+    
     // 1. 验证任务时间约束：任务必须在起飞和落地之间完成
     // 注意：现在使用最早开始时间和最晚结束时间，不再需要调整
     // 约束检查在分配时进行：actual_start_time >= earliest_start_time && actual_start_time + duration <= latest_end_time
@@ -48,6 +65,8 @@ void LoadScheduler::scheduleLoadTasks(const vector<LoadEmployeeInfo>& employees,
 
 void LoadScheduler::sortTasksByPriority(vector<LoadTask>& tasks)
 {
+    PROFILE_SCOPE("load.sort");
+    
     // 任务保障优先级排序规则：
     // 1. 进港 > 出港
     // 2. 落地时间早的 > 落地时间晚的
@@ -89,8 +108,8 @@ void LoadScheduler::sortTasksByPriority(vector<LoadTask>& tasks)
 
 // 辅助函数：检查员工在指定时间段是否空闲
 static bool isEmployeeAvailable(const string& employee_id, long task_actual_start, long task_duration,
-                                const map<string, LoadTask*>& task_ptr_map,
-                                const map<string, const LoadEmployeeInfo*>& employee_map)
+                                const TaskPtrMap& task_ptr_map,
+                                const EmployeeMap& employee_map)
 {
     auto emp_it = employee_map.find(employee_id);
     if (emp_it == employee_map.end()) {
@@ -98,12 +117,12 @@ static bool isEmployeeAvailable(const string& employee_id, long task_actual_star
     }
     
     const LoadEmployeeInfo* emp = emp_it->second;
-    const auto& assigned_task_ids = emp->getEmployeeInfo().getAssignedTaskIds();
+    const auto& assigned_task_keys = emp->getEmployeeInfo().getAssignedTaskKeys();
     
     long task_actual_end = task_actual_start + task_duration;
     
-    for (const string& assigned_task_id : assigned_task_ids) {
-        auto task_it = task_ptr_map.find(assigned_task_id);
+    for (int assigned_task_key : assigned_task_keys) {
+        auto task_it = task_ptr_map.find(assigned_task_key);
         if (task_it == task_ptr_map.end() || task_it->second == nullptr) {
             continue;
         }
@@ -127,9 +146,9 @@ static bool isEmployeeAvailable(const string& employee_id, long task_actual_star
 }
 
 // 辅助函数：计算组的当日任务总时长
-static long calculateGroupDailyTaskTime(const vector<string>& group_members, long current_task_start,
-                                           const map<string, LoadTask*>& task_ptr_map,
-                                           const map<string, const LoadEmployeeInfo*>& employee_map)
+static long calculateGroupDailyTaskTime(const IdNames& group_members, long current_task_start,
+                                           const TaskPtrMap& task_ptr_map,
+                                           const EmployeeMap& employee_map)
 {
     const long SECONDS_PER_DAY = 24 * 3600;
     long current_day = current_task_start / SECONDS_PER_DAY;
@@ -142,10 +161,10 @@ static long calculateGroupDailyTaskTime(const vector<string>& group_members, lon
         }
         
         const LoadEmployeeInfo* emp = emp_it->second;
-        const auto& assigned_task_ids = emp->getEmployeeInfo().getAssignedTaskIds();
+        const auto& assigned_task_keys = emp->getEmployeeInfo().getAssignedTaskKeys();
         
-        for (const string& assigned_task_id : assigned_task_ids) {
-            auto task_it = task_ptr_map.find(assigned_task_id);
+        for (int assigned_task_key : assigned_task_keys) {
+            auto task_it = task_ptr_map.find(assigned_task_key);
             if (task_it == task_ptr_map.end() || task_it->second == nullptr) {
                 continue;
             }
@@ -179,25 +198,32 @@ void LoadScheduler::assignTasksToEmployees(vector<LoadTask>& tasks,
                                           const vector<LoadTask>* previous_tasks,
                                           const map<string, vector<string>>& group_name_to_employees)
 {
-    const int GROUP_SIZE = 3;  // 每个组3个人
+    PROFILE_TIMER(build_groups_timer, "load.build_groups");
     
-    // 创建任务ID到LoadTask指针的映射
-    map<string, LoadTask*> task_ptr_map;
+    // 本次派工的临时容器都从存储区分配，函数返回时一次性释放
+    MonotonicArena scratch;
+    
+    // 创建任务ID编号到LoadTask指针的映射（员工的已分配任务按编号保存，查找时不比较字符串）
+    TaskPtrMap task_ptr_map(scratch);
+    task_ptr_map.reserve(tasks.size());
     for (auto& task : tasks) {
-        task_ptr_map[task.getTaskId()] = &task;
+        task_ptr_map[IdRegistry::intern(task.getTaskId())] = &task;
     }
     
     // 创建员工ID到LoadEmployeeInfo的映射
-    map<string, const LoadEmployeeInfo*> employee_map;
+    EmployeeMap employee_map(scratch);
+    employee_map.reserve(employees.size());
     for (const auto& emp : employees) {
         employee_map[emp.getEmployeeId()] = &emp;
     }
     
     // 直接从group_name_to_employees构建组到员工的映射
-    // 班组名一致的就是一个小组
-    map<int, vector<string>> groups;  // 内部组ID -> 员工ID列表
-    map<int, string> group_id_to_name;  // 内部组ID -> 班组名
-    int internal_group_id = 1;
+    // 班组名一致的就是一个小组；组员的IdRegistry编号按小组下标连续存放（每组GROUP_SIZE个），
+    // 过滤小组时按编号检查是否已分配到当前任务，不逐个比较字符串；其余结构通过IdNames视图引用
+    ArenaVector<int> group_member_keys(scratch);       // 小组下标 * GROUP_SIZE + 组员序号 -> 员工编号
+    ArenaVector<const string*> group_id_to_name(scratch);  // 小组下标 -> 班组名
+    ArenaVector<size_t> group_name_rank(scratch);      // 小组下标 -> 班组名出现的顺序
+    size_t name_rank = 0;
     
     // 从group_name_to_employees中提取员工，按班组名分组
     for (const auto& g_pair : group_name_to_employees) {
@@ -205,65 +231,156 @@ void LoadScheduler::assignTasksToEmployees(vector<LoadTask>& tasks,
         const vector<string>& emp_list = g_pair.second;
         
         // 按3人一组分割
-            for (size_t i = 0; i < emp_list.size(); i += GROUP_SIZE) {
-                vector<string> group_members;
-                for (size_t j = i; j < emp_list.size() && j < i + GROUP_SIZE; ++j) {
-                    group_members.push_back(emp_list[j]);
-                }
-                
-                if (group_members.size() == GROUP_SIZE) {
-                    // 完整的3人组，分配一个新的内部组ID
-                    groups[internal_group_id] = group_members;
-                group_id_to_name[internal_group_id] = group_name;
-                    internal_group_id++;
-                }
+        for (size_t i = 0; i + GROUP_SIZE <= emp_list.size(); i += GROUP_SIZE) {
+            // 完整的3人组，分配一个新的内部组ID
+            for (size_t j = i; j < i + GROUP_SIZE; ++j) {
+                group_member_keys.push_back(IdRegistry::intern(emp_list[j]));
             }
+            group_id_to_name.push_back(&group_name);
+            group_name_rank.push_back(name_rank);
+        }
+        name_rank++;
+    }
+    
+    // 内部组ID（从1开始，按组ID升序） -> 员工ID列表（组员编号的视图，groups建好后不再改动编号数组）
+    size_t group_count = group_id_to_name.size();
+    ArenaVector<IdNames> group_members_by_index(scratch);  // 小组下标 -> 员工ID列表
+    group_members_by_index.reserve(group_count);
+    for (size_t g = 0; g < group_count; ++g) {
+        const int* first = group_member_keys.data() + g * GROUP_SIZE;
+        group_members_by_index.push_back(IdNames(first, first + GROUP_SIZE));
+    }
+    ArenaVector<pair<int, const IdNames*>> groups(scratch);
+    groups.reserve(group_count);
+    for (size_t g = 0; g < group_count; ++g) {
+        groups.push_back(make_pair(static_cast<int>(g) + 1, &group_members_by_index[g]));
+    }
+    
+    // 小组连续工作状态：小组下标 = 内部组ID - 1；先写入已分配（锁定）任务
+    ArenaUnorderedMap<string, int> employee_group_index(scratch);  // 员工ID -> 小组下标
+    employee_group_index.reserve(groups.size() * GROUP_SIZE);
+    for (const auto& g_pair : groups) {
+        for (const string& emp_id : *g_pair.second) {
+            employee_group_index[emp_id] = g_pair.first - 1;
         }
+    }
+    GroupWorkTracker work_tracker(work_rules_);
+    work_tracker.reset(groups.size());
+    for (const auto& window : shift_windows_) {
+        auto it = employee_group_index.find(window.employee_id);
+        if (it != employee_group_index.end()) {
+            work_tracker.addMemberShift(it->second, window);
+        }
+    }
+    
+    // 资质熟练度分层：按小组下标编译熟练度限制和双机优先级
+    SkillTiers skill_tiers(skill_rules_);
+    skill_tiers.build(IdNames(group_member_keys.data(), group_member_keys.data() + group_member_keys.size()),
+                      GROUP_SIZE, skill_levels_);
+    
+    // 小组休息时间线：组员同进同出，任一组员的休息都占用整个小组；同组成员的同一次休息只记一次
+    BreakTimeline break_timeline;
+    break_timeline.reset(groups.size());
+    vector<int> break_ids = break_timeline.addStaffBreaks(breaks_, [&](const string& emp_id) {
+        auto it = employee_group_index.find(emp_id);
+        return it == employee_group_index.end() ? -1 : it->second;
+    });
+    
+    ArenaVector<int> tracked_groups(scratch);
+    auto trackAssignment = [&](const IdNames& emp_ids, long start, long end, bool remote) {
+        tracked_groups.clear();
+        for (const string& emp_id : emp_ids) {
+            auto it = employee_group_index.find(emp_id);
+            if (it != employee_group_index.end() &&
+                find(tracked_groups.begin(), tracked_groups.end(), it->second) == tracked_groups.end()) {
+                tracked_groups.push_back(it->second);
+                work_tracker.addTask(it->second, start, end, remote);
+                break_timeline.addWork(it->second, start, end);
+            }
+        }
+    };
+    // 强制分配（没有可用小组时改派最早结束的小组）对候选小组的硬约束：班期、双机作业最小间隔、
+    // 最大连续工作时长、最大连续远机位任务个数、锁定休息（用餐挪不开时保留原位并标记冲突）和熟练度限制，
+    // 不满足时记录拒绝原因
+    auto forcedGroupAllowed = [&](int gid, long start, long end, bool remote) {
+        if (!work_tracker.inShift(gid - 1, start, end)) {
+            trace_.reject(RejectReason::OFF_SHIFT);
+            return false;
+        }
+        if (!work_tracker.canDoubleOperate(gid - 1, start, end)) {
+            trace_.reject(RejectReason::DOUBLE_OPERATION);
+            return false;
+        }
+        if (!work_tracker.canWork(gid - 1, start, end)) {
+            trace_.reject(RejectReason::CONTINUOUS_WORK);
+            return false;
+        }
+        if (!work_tracker.canWorkRemote(gid - 1, start, end, remote)) {
+            trace_.reject(RejectReason::REMOTE_STREAK);
+            return false;
+        }
+        if (break_timeline.hitsLockedBreak(gid - 1, start, end)) {
+            trace_.reject(RejectReason::BREAK);
+            return false;
+        }
+        if (!skill_tiers.meetsProficiency(gid - 1)) {
+            trace_.reject(RejectReason::PROFICIENCY);
+            return false;
+        }
+        return true;
+    };
+    for (const auto& task : tasks) {
+        if (task.isAssigned() && task.getAssignedEmployeeCount() > 0 && task.getActualStartTime() > 0) {
+            trackAssignment(task.getAssignedEmployeeIds(), task.getActualStartTime(), task.getActualEndTime(),
+                            task.isRemoteStand());
+        }
+    }
+    
+    PROFILE_TIMER_STOP(build_groups_timer);
     
     // 调试输出：检查组构建情况
-    cerr << "DEBUG: Built " << groups.size() << " groups from " << group_name_to_employees.size() << " group names" << endl;
+    LOG_DEBUG("DEBUG: Built " << groups.size() << " groups from " << group_name_to_employees.size() << " group names");
+#if AIRPORT_SCHEDULER_LOG_LEVEL <= AIRPORT_LOG_LEVEL_DEBUG
     for (const auto& g_pair : groups) {
-        cerr << "DEBUG: Group " << g_pair.first << " (" << group_id_to_name[g_pair.first] << ") has " << g_pair.second.size() << " members" << endl;
+        LOG_DEBUG("DEBUG: Group " << g_pair.first << " (" << *group_id_to_name[g_pair.first - 1] << ") has " << g_pair.second->size() << " members");
     }
+#endif
     
     // 注意：任务已经按优先级排序，这里不再重新排序，保持优先级顺序
-    // 使用任务ID集合来跟踪已处理的任务
-    set<string> processed_task_ids;
+    // 使用任务ID编号集合来跟踪已处理的任务
+    ArenaUnorderedSet<int> processed_task_keys(scratch);
+    processed_task_keys.reserve(tasks.size());
+    
+    // 上一次预排方案按任务ID编号索引（同一任务ID取第一个已分配的任务）
+    ArenaUnorderedMap<int, const LoadTask*> prev_task_map(scratch);
+    if (previous_tasks != nullptr) {
+        prev_task_map.reserve(previous_tasks->size());
+        for (const auto& prev_task : *previous_tasks) {
+            if (prev_task.isAssigned() && prev_task.getAssignedEmployeeCount() > 0) {
+                prev_task_map.emplace(IdRegistry::intern(prev_task.getTaskId()), &prev_task);
+            }
+        }
+    }
+    
+    PROFILE_TIMER(rotation_setup_timer, "load.rotation_setup");
     
     // 轮转机制：记录当前轮到哪个组
     // 根据班组名出现的顺序，k个小组轮流派工（不固定为8个）
-    vector<int> rotation_order;  // 按轮转顺序存储组ID
+    ArenaVector<int> rotation_order(scratch);  // 按轮转顺序存储组ID
     
-    // 构建轮转顺序：按班组名在group_name_to_employees中出现的顺序
-    vector<string> group_name_order;
-    for (const auto& g_pair : group_name_to_employees) {
-        group_name_order.push_back(g_pair.first);
-    }
-    
-    // 按班组名出现的顺序构建轮转顺序
-    vector<pair<int, string>> temp_groups;  // (group_id, group_name)
+    // 按班组名在group_name_to_employees中出现的顺序构建轮转顺序
+    ArenaVector<pair<int, size_t>> temp_groups(scratch);  // (group_id, 班组名出现的顺序)
     for (const auto& group_pair : groups) {
         int group_id = group_pair.first;
-        if (group_pair.second.empty()) {
+        if (group_pair.second->empty()) {
             continue;
         }
-        
-        // 从group_id_to_name中获取班组名
-        string group_name;
-        if (group_id_to_name.find(group_id) != group_id_to_name.end()) {
-            group_name = group_id_to_name[group_id];
-            temp_groups.push_back({group_id, group_name});
-        }
+        temp_groups.push_back({group_id, group_name_rank[group_id - 1]});
     }
     
     // 按班组名出现的顺序排序
     sort(temp_groups.begin(), temp_groups.end(), 
-         [&group_name_order](const pair<int, string>& a, const pair<int, string>& b) {
-             auto it_a = find(group_name_order.begin(), group_name_order.end(), a.second);
-             auto it_b = find(group_name_order.begin(), group_name_order.end(), b.second);
-             if (it_a != group_name_order.end() && it_b != group_name_order.end()) {
-                 return it_a < it_b;
-             }
+         [](const pair<int, size_t>& a, const pair<int, size_t>& b) {
              return a.second < b.second;
          });
     
@@ -281,7 +398,7 @@ void LoadScheduler::assignTasksToEmployees(vector<LoadTask>& tasks,
     }
     
     // 创建1000个元素的轮换数组，内容是循环的：2,3,4,5,6,7,8,1,2,3,4,5,6,7,8,1,2,3...
-    vector<int> rotation_array(1000);
+    ArenaVector<int> rotation_array(1000, 0, scratch);
     int pattern[] = {2, 3, 4, 5, 6, 7, 8, 1};  // 循环模式
     int pattern_size = 8;
     for (int i = 0; i < 1000; ++i) {
@@ -289,11 +406,12 @@ void LoadScheduler::assignTasksToEmployees(vector<LoadTask>& tasks,
     }
     
     int current_rotation_index = 0;  // 当前轮转索引
+    PROFILE_TIMER_STOP(rotation_setup_timer);
     
     // 小组位置交换逻辑：当某个小组繁忙时，尝试交换轮换数组中两个数字的位置
     auto trySwapInRotationArray = [&](int busy_group_value, long task_actual_start, long task_duration,
-                                     const map<string, LoadTask*>& task_ptr_map,
-                                     const map<string, const LoadEmployeeInfo*>& employee_map) -> bool {
+                                     const TaskPtrMap& task_ptr_map,
+                                     const EmployeeMap& employee_map) -> bool {
         // 在轮换数组中查找一个可用的组值来交换位置
         for (int i = 0; i < 1000; ++i) {
             int candidate_value = rotation_array[i];
@@ -308,7 +426,7 @@ void LoadScheduler::assignTasksToEmployees(vector<LoadTask>& tasks,
                 // 检查组ID是否匹配候选值（这里假设组ID就是值，或者需要建立映射）
                 // 如果组ID范围是1-8，直接比较
                 if (group_id == candidate_value) {
-                    const vector<string>& candidate_members = group_pair.second;
+                    const IdNames& candidate_members = *group_pair.second;
                     bool all_available = true;
                     
                     for (const string& emp_id : candidate_members) {
@@ -346,13 +464,22 @@ void LoadScheduler::assignTasksToEmployees(vector<LoadTask>& tasks,
         return false;  // 没有找到可交换的组
     };
     
+    // 每轮派工的候选小组（循环外创建，每轮清空后复用容量）
+    ArenaVector<pair<int, const IdNames*>> available_groups(scratch);  // (组ID, 组员)
+    ArenaVector<char> group_available(groups.size(), 0, scratch);              // 小组下标 -> 是否在候选中
+    available_groups.reserve(groups.size());
+    const unsigned ALL_ROTATION_GROUPS = 0x1FEu;  // 1-8组对应的位
+    
     // 遍历任务列表，逐个分配任务
     int task_index = 0;
-    cerr << "DEBUG: Total tasks to process: " << tasks.size() << endl;
+    LOG_DEBUG("DEBUG: Total tasks to process: " << tasks.size());
     
     for (auto& task : tasks) {
+        PROFILE_SCOPE("load.task");
+        PROFILE_COUNT("load.tasks", 1);
         task_index++;
         string task_id = task.getTaskId();
+        trace_.beginTask(static_cast<size_t>(task_index - 1));
         
         // 如果任务ID为空，使用索引作为唯一标识符
         if (task_id.empty()) {
@@ -360,26 +487,23 @@ void LoadScheduler::assignTasksToEmployees(vector<LoadTask>& tasks,
             task.setTaskId(task_id);
         }
         
-        // 输出前20个任务的ID，检查是否有重复
-        if (task_index <= 20) {
-            cerr << "DEBUG: Processing task index " << task_index << ", task_id=" << task_id 
-                 << ", name=" << task.getTaskName() << endl;
-        }
+        LOG_DEBUG("DEBUG: Processing task index " << task_index << ", task_id=" << task_id 
+                  << ", name=" << task.getTaskName());
+        
+        int task_key = IdRegistry::intern(task_id);
         
         // 跳过已经处理过的任务
-        if (processed_task_ids.find(task_id) != processed_task_ids.end()) {
-            if (task_index <= 20) {
-                cerr << "DEBUG: Task " << task_id << " (index " << task_index << ") already processed, skipping" << endl;
-            }
+        if (processed_task_keys.count(task_key)) {
+            LOG_DEBUG("DEBUG: Task " << task_id << " (index " << task_index << ") already processed, skipping");
+            trace_.endTask(TraceOutcome::SKIPPED);
             continue;
         }
         
         // 跳过已经分配的任务
         if (task.isAssigned() && task.getAssignedEmployeeCount() > 0) {
-            processed_task_ids.insert(task_id);
-            if (task_index <= 10) {
-                cerr << "DEBUG: Task " << task_id << " already assigned, skipping" << endl;
-            }
+            processed_task_keys.insert(task_key);
+            LOG_DEBUG("DEBUG: Task " << task_id << " already assigned, skipping");
+            trace_.endTask(TraceOutcome::SKIPPED);
             continue;
         }
         
@@ -391,19 +515,16 @@ void LoadScheduler::assignTasksToEmployees(vector<LoadTask>& tasks,
         long duration = task.getDuration();
         
         // 调试输出：检查任务时间
-        if (task_index <= 10) {  // 输出前10个任务的调试信息
-            cerr << "DEBUG: Task " << task_id << " (" << task.getTaskName() << ") earliest_start: " << earliest_start 
-                 << ", latest_end: " << latest_end << ", duration: " << duration
-                 << ", required: " << required_count << ", assigned: " << assigned_count << endl;
-        }
+        LOG_DEBUG("DEBUG: Task " << task_id << " (" << task.getTaskName() << ") earliest_start: " << earliest_start 
+                  << ", latest_end: " << latest_end << ", duration: " << duration
+                  << ", required: " << required_count << ", assigned: " << assigned_count);
         
         // 如果任务时间无效，跳过（但不标记为已处理，因为可能后续可以修复）
         if (earliest_start <= 0 || latest_end <= 0 || duration <= 0 || earliest_start + duration > latest_end) {
-            if (task_index <= 10) {
-                cerr << "DEBUG: Task " << task_id << " has invalid time (earliest_start: " << earliest_start 
-                     << ", latest_end: " << latest_end << ", duration: " << duration << "), skipping" << endl;
-            }
+            LOG_DEBUG("DEBUG: Task " << task_id << " has invalid time (earliest_start: " << earliest_start 
+                      << ", latest_end: " << latest_end << ", duration: " << duration << "), skipping");
             // 不标记为已处理，因为时间可能后续可以修复
+            trace_.endTask(TraceOutcome::INVALID_TIME);
             continue;
         }
         
@@ -421,65 +542,77 @@ void LoadScheduler::assignTasksToEmployees(vector<LoadTask>& tasks,
         int required_groups = (required_count + GROUP_SIZE - 1) / GROUP_SIZE;  // 向上取整
         
         // 检查是否可以在上一次预排方案中保留分配（减少调整）
+        bool reused_previous = false;
+        bool any_forced = false;
         if (previous_tasks != nullptr) {
             // 查找上一次预排方案中相同任务ID的分配
-            for (const auto& prev_task : *previous_tasks) {
-                if (prev_task.getTaskId() == task_id && 
-                    prev_task.isAssigned() && 
-                    prev_task.getAssignedEmployeeCount() > 0) {
-                    // 检查上一次分配的小组是否仍然可用
-                    const auto& prev_assigned = prev_task.getAssignedEmployeeIds();
-                    bool can_reuse = true;
-                    
-                    // 检查组是否仍然完整且在任务时间段空闲
-                    // 注意：需要确保上一次分配的人数是3的倍数（整组）
-                    if (prev_assigned.size() % GROUP_SIZE != 0) {
-                        can_reuse = false;  // 不是整组，不能重用
-                    }
+            auto prev_it = prev_task_map.find(task_key);
+            if (prev_it != prev_task_map.end()) {
+                // 检查上一次分配的小组是否仍然可用
+                const IdNames prev_assigned = prev_it->second->getAssignedEmployeeIds();
+                bool can_reuse = true;
+                
+                // 检查组是否仍然完整且在任务时间段空闲
+                // 注意：需要确保上一次分配的人数是3的倍数（整组）
+                if (prev_assigned.size() % GROUP_SIZE != 0) {
+                    can_reuse = false;  // 不是整组，不能重用
+                }
+                
+                if (can_reuse) {
+                    // 计算实际开始时间（使用最早开始时间）
+                    long actual_start = earliest_start;
+                    long actual_end = actual_start + duration;
                     
-                    if (can_reuse) {
-                        // 计算实际开始时间（使用最早开始时间）
-                        long actual_start = earliest_start;
-                        long actual_end = actual_start + duration;
-                        
-                        // 检查约束：实际开始时间 + 时长 <= 最晚结束时间
-                        if (actual_end > latest_end) {
-                            can_reuse = false;  // 不满足约束
-                        } else {
-                            for (const string& emp_id : prev_assigned) {
-                                if (employee_map.find(emp_id) == employee_map.end() ||
-                                    task.isAssignedToEmployee(emp_id) ||
-                                    !isEmployeeAvailable(emp_id, actual_start, duration, task_ptr_map, employee_map)) {
-                                    can_reuse = false;
-                                    break;
-                                }
+                    // 检查约束：实际开始时间 + 时长 <= 最晚结束时间
+                    if (actual_end > latest_end) {
+                        can_reuse = false;  // 不满足约束
+                    } else {
+                        for (const string& emp_id : prev_assigned) {
+                            if (employee_map.find(emp_id) == employee_map.end() ||
+                                task.isAssignedToEmployee(emp_id) ||
+                                !isEmployeeAvailable(emp_id, actual_start, duration, task_ptr_map, employee_map)) {
+                                can_reuse = false;
+                                break;
+                            }
+                            // 上一次方案之后新增或挪动的休息
+                            auto group_it = employee_group_index.find(emp_id);
+                            if (group_it != employee_group_index.end() &&
+                                (!work_tracker.inShift(group_it->second, actual_start, actual_end) ||
+                                 !break_timeline.canWork(group_it->second, actual_start, actual_end) ||
+                                 !skill_tiers.meetsProficiency(group_it->second))) {
+                                can_reuse = false;
+                                break;
                             }
                         }
                     }
+                }
+                
+                if (!can_reuse) {
+                    trace_.reject(RejectReason::REUSE_FAILED);
+                }
+                
+                if (can_reuse) {
+                    // 重用上一次的分配（整组重用）
+                    reused_previous = true;
+                    // 设置实际开始时间（使用最早开始时间）
+                    long actual_start = earliest_start;
+                    task.setActualStartTime(actual_start);
                     
-                    if (can_reuse) {
-                        // 重用上一次的分配（整组重用）
-                        // 设置实际开始时间（使用最早开始时间）
-                        long actual_start = earliest_start;
-                        task.setActualStartTime(actual_start);
-                        
-                        for (const string& emp_id : prev_assigned) {
-                            task.addAssignedEmployeeId(emp_id);
-                            auto emp_it = employee_map.find(emp_id);
-                            if (emp_it != employee_map.end()) {
-                                const_cast<LoadEmployeeInfo*>(emp_it->second)->getEmployeeInfo()
-                                    .addAssignedTaskId(task_id);
-                            }
-                            assigned_count++;
-                        }
-                        if (assigned_count >= required_count) {
-                            // 已完全分配，跳过后续分配逻辑
-                            task.setAssigned(true);
-                            processed_task_ids.insert(task_id);
-                            continue;  // 继续下一个任务
+                    for (const string& emp_id : prev_assigned) {
+                        task.addAssignedEmployeeId(emp_id);
+                        auto emp_it = employee_map.find(emp_id);
+                        if (emp_it != employee_map.end()) {
+                            const_cast<LoadEmployeeInfo*>(emp_it->second)->getEmployeeInfo()
+                                .addAssignedTaskId(task_id);
                         }
+                        assigned_count++;
+                    }
+                    trackAssignment(prev_assigned, actual_start, actual_start + duration, task.isRemoteStand());
+                    if (assigned_count >= required_count) {
+                        // 已完全分配，跳过后续分配逻辑
+                        task.setAssigned(true);
+                        processed_task_keys.insert(task_key);
                     }
-                    break;
                 }
             }
         }
@@ -487,55 +620,53 @@ void LoadScheduler::assignTasksToEmployees(vector<LoadTask>& tasks,
         // 分配任务给组（不拆组）
         while (assigned_count < required_count) {
             // 找到所有可用的组（组内所有成员都空闲）
-            vector<pair<int, vector<string>>> available_groups;
+            available_groups.clear();
+            PROFILE_TIMER(filter_timer, "load.filter_groups");
             
-            if (task_index <= 10) {
-                cerr << "DEBUG: Task " << task_id << " (" << task.getTaskName() << ") requires " << required_count << " people, currently assigned " << assigned_count << endl;
-                cerr << "DEBUG: Checking " << groups.size() << " groups for availability" << endl;
-            }
+            LOG_DEBUG("DEBUG: Task " << task_id << " (" << task.getTaskName() << ") requires " << required_count << " people, currently assigned " << assigned_count);
+            LOG_DEBUG("DEBUG: Checking " << groups.size() << " groups for availability");
             
             for (const auto& group_pair : groups) {
                 int group_id = group_pair.first;
-                const vector<string>& group_members = group_pair.second;
+                const IdNames& group_members = *group_pair.second;
                 
                 // 检查组是否完整（必须有3个人）
                 if (group_members.size() < GROUP_SIZE) {
+                    trace_.reject(RejectReason::GROUP_INCOMPLETE);
                     continue;
                 }
                 
-                // 检查组内所有成员是否都已分配给当前任务
-                bool all_assigned = true;
-                for (const string& emp_id : group_members) {
-                    if (!task.isAssignedToEmployee(emp_id)) {
-                        all_assigned = false;
-                        break;
-                    }
+                // 班期：小组班期（组员班期的交集，含允许的加班）已缓存，先于逐个成员的检查剔除
+                if (!work_tracker.inShift(group_id - 1, earliest_start, earliest_start + duration)) {
+                    trace_.reject(RejectReason::OFF_SHIFT);
+                    continue;
                 }
+                
+                // 检查组内所有成员是否都已分配给当前任务
+                const int* member_keys = &group_member_keys[(group_id - 1) * GROUP_SIZE];
+                bool all_assigned = allMembers<GROUP_SIZE>([&](int m) {
+                    return task.isAssignedToEmployee(member_keys[m]);
+                });
                 if (all_assigned) {
+                    trace_.reject(RejectReason::ALREADY_ON_TASK);
                     continue;  // 该组已经完全分配给当前任务
                 }
-            
                 
-                // 检查组内所有成员在任务时间段是否都空闲
-                bool all_available = true;
-                string unavailable_reason = "";
-                for (const string& emp_id : group_members) {
-                    // 如果已经分配给当前任务，跳过
-                    if (task.isAssignedToEmployee(emp_id)) {
-                        continue;
-                    }
-                    
-                    // 计算实际开始时间（使用最早开始时间）
-                    long actual_start = earliest_start;
-                    if (!isEmployeeAvailable(emp_id, actual_start, duration, task_ptr_map, employee_map)) {
-                        all_available = false;
-                        unavailable_reason = "employee " + emp_id + " not available";
-                        break;
-                    }
+                // 熟练度限制：小组中达到熟练度下限的人数（预先汇总，一次数组读取）
+                if (!skill_tiers.meetsProficiency(group_id - 1)) {
+                    trace_.reject(RejectReason::PROFICIENCY);
+                    continue;
                 }
+            
+                
+                // 检查组内所有成员在任务时间段（从最早开始时间起）是否都空闲，已经分配给当前任务的成员跳过
+                bool all_available = allMembers<GROUP_SIZE>([&](int m) {
+                    return task.isAssignedToEmployee(member_keys[m]) ||
+                           isEmployeeAvailable(group_members[m], earliest_start, duration, task_ptr_map, employee_map);
+                });
                 
                 if (!all_available) {
-                    // 移除调试输出，减少日志噪音
+                    trace_.reject(RejectReason::BUSY);
                     continue;
                 }
                 
@@ -545,6 +676,7 @@ void LoadScheduler::assignTasksToEmployees(vector<LoadTask>& tasks,
                     // 获取该组最近结束的任务的机位和时间
                     int last_stand = 0;
                     long last_end_time = -1;
+                    const LoadTask* last_task = nullptr;
                     
                     for (const string& emp_id : group_members) {
                         auto emp_it = employee_map.find(emp_id);
@@ -553,11 +685,11 @@ void LoadScheduler::assignTasksToEmployees(vector<LoadTask>& tasks,
                         }
                         
                         const LoadEmployeeInfo* emp = emp_it->second;
-                        const auto& assigned_task_ids = emp->getEmployeeInfo().getAssignedTaskIds();
+                        const auto& assigned_task_keys = emp->getEmployeeInfo().getAssignedTaskKeys();
                         
                         // 找到该成员最近结束的任务（在当前任务开始之前）
-                        for (const string& assigned_task_id : assigned_task_ids) {
-                            auto assigned_task_it = task_ptr_map.find(assigned_task_id);
+                        for (int assigned_task_key : assigned_task_keys) {
+                            auto assigned_task_it = task_ptr_map.find(assigned_task_key);
                             if (assigned_task_it == task_ptr_map.end() || assigned_task_it->second == nullptr) {
                                 continue;
                             }
@@ -569,44 +701,68 @@ void LoadScheduler::assignTasksToEmployees(vector<LoadTask>& tasks,
                                 last_end_time = assigned_end;
                                 // 获取该任务的机位（直接从task中获取）
                                 last_stand = assigned_task.getStand();
+                                last_task = &assigned_task;
                             }
                         }
                     }
                     
                     // 如果找到上次任务，验证是否有足够时间到达当前任务
-                    // 放宽条件：允许有5分钟的缓冲时间（300秒）
+                    // 路程时间之外的间隔按航班衔接规则（connectRule.csv）查表，未配置时为5分钟
                     if (last_stand > 0 && last_end_time > 0) {
                         long travel_time = StandDistance::getInstance().getTravelTime(last_stand, task_stand);
-                        const long BUFFER_TIME = 5 * 60;  // 5分钟缓冲
+                        long min_interval = ConnectRuleTable::getInstance().getMinInterval(*last_task, task);
                         long actual_start = earliest_start;  // 使用最早开始时间
-                        if ((last_end_time + travel_time + BUFFER_TIME) > actual_start) {
+                        if ((last_end_time + travel_time + min_interval) > actual_start) {
                             // 无法按时到达，跳过该组
+                            trace_.reject(RejectReason::TRAVEL_INFEASIBLE);
                             continue;
                         }
                     }
                 }
                 
+                // 最大连续工作时长：放入后所在连续工作链不能超长（空档短于最小连续休息时长不算休息）
+                if (!work_tracker.canWork(group_id - 1, earliest_start, earliest_start + duration)) {
+                    trace_.reject(RejectReason::CONTINUOUS_WORK);
+                    continue;
+                }
+                
+                // 最大连续远机位任务个数（间隔达到远机位最小间隔或中间有近机位任务时重新计数）
+                if (!work_tracker.canWorkRemote(group_id - 1, earliest_start, earliest_start + duration,
+                                                task.isRemoteStand())) {
+                    trace_.reject(RejectReason::REMOTE_STREAK);
+                    continue;
+                }
+                
+                // 休息：不能占用锁定休息，未锁定的用餐在浮动窗口内仍要有空档
+                if (!break_timeline.canWork(group_id - 1, earliest_start, earliest_start + duration)) {
+                    trace_.reject(RejectReason::BREAK);
+                    continue;
+                }
+                
                 // 组可用且能按时到达
-                available_groups.push_back({group_id, group_members});
+                available_groups.push_back({group_id, group_pair.second});
             }
+            PROFILE_TIMER_STOP(filter_timer);
+            PROFILE_COUNT("load.available_groups", static_cast<long long>(available_groups.size()));
             
-            if (task_index <= 10) {
-                cerr << "DEBUG: Found " << available_groups.size() << " available groups for task " << task_id << endl;
-            }
+            LOG_DEBUG("DEBUG: Found " << available_groups.size() << " available groups for task " << task_id);
             
             // 选择最优的组：优先级 1.轮转顺序 2.连续工作时长 3.机位远近
             long best_score = LONG_MAX;
             int selected_group_id = -1;
-            vector<string> selected_group_members;
+            const IdNames* selected_group_members = nullptr;
             bool forced_assignment = false;  // 标记是否是强制分配（时间段被占满）
             
             if (available_groups.empty()) {
                 // 没有可用的组，找到最先结束任务的组进行强制分配
+                PROFILE_SCOPE("load.forced_assignment");
+                PROFILE_COUNT("load.forced_assignments", 1);
                 long earliest_end_time = LONG_MAX;
+                int best_double_priority = INT_MIN;
                 
                 for (const auto& group_pair : groups) {
                     int group_id = group_pair.first;
-                    const vector<string>& group_members = group_pair.second;
+                    const IdNames& group_members = *group_pair.second;
                     
                     // 检查组是否完整（必须有3个人）
                     if (group_members.size() < GROUP_SIZE) {
@@ -614,17 +770,19 @@ void LoadScheduler::assignTasksToEmployees(vector<LoadTask>& tasks,
                     }
                     
                     // 检查组内所有成员是否都已分配给当前任务（如果全部已分配，强制分配也没用）
-                    bool all_assigned_to_current_task = true;
-                    for (const string& emp_id : group_members) {
-                        if (!task.isAssignedToEmployee(emp_id)) {
-                            all_assigned_to_current_task = false;
-                            break;
-                        }
-                    }
+                    const int* member_keys = &group_member_keys[(group_id - 1) * GROUP_SIZE];
+                    bool all_assigned_to_current_task = allMembers<GROUP_SIZE>([&](int m) {
+                        return task.isAssignedToEmployee(member_keys[m]);
+                    });
                     if (all_assigned_to_current_task) {
                         continue;  // 该组已经完全分配给当前任务，跳过
                     }
                     
+                    // 强制分配也要满足班期、双机作业间隔、连续工作时长、连续远机位、锁定休息和熟练度限制
+                    if (!forcedGroupAllowed(group_id, earliest_start, earliest_start + duration, task.isRemoteStand())) {
+                        continue;
+                    }
+                    
                     // 找到该组所有成员中最近结束的任务
                     long group_last_end_time = -1;
                     for (const string& emp_id : group_members) {
@@ -634,10 +792,10 @@ void LoadScheduler::assignTasksToEmployees(vector<LoadTask>& tasks,
                         }
                         
                         const LoadEmployeeInfo* emp = emp_it->second;
-                        const auto& assigned_task_ids = emp->getEmployeeInfo().getAssignedTaskIds();
+                        const auto& assigned_task_keys = emp->getEmployeeInfo().getAssignedTaskKeys();
                         
-                        for (const string& assigned_task_id : assigned_task_ids) {
-                            auto assigned_task_it = task_ptr_map.find(assigned_task_id);
+                        for (int assigned_task_key : assigned_task_keys) {
+                            auto assigned_task_it = task_ptr_map.find(assigned_task_key);
                             if (assigned_task_it == task_ptr_map.end() || assigned_task_it->second == nullptr) {
                                 continue;
                             }
@@ -655,26 +813,31 @@ void LoadScheduler::assignTasksToEmployees(vector<LoadTask>& tasks,
                         group_last_end_time = 0;
                     }
                     
-                    // 选择最先结束任务的组（如果没有任务，则选择最早）
-                    if (group_last_end_time < earliest_end_time) {
+                    // 强制分配即双机作业：双机优先级高的组优先（已有双机作业时按连续双机优先级），
+                    // 同优先级选择最先结束任务的组（如果没有任务，则选择最早）
+                    int double_priority = skill_tiers.doublePriority(group_id - 1, work_tracker.doubleCount(group_id - 1) > 0);
+                    if (double_priority > best_double_priority ||
+                        (double_priority == best_double_priority && group_last_end_time < earliest_end_time)) {
+                        best_double_priority = double_priority;
                         earliest_end_time = group_last_end_time;
                         selected_group_id = group_id;
-                        selected_group_members = group_members;
+                        selected_group_members = &group_members;
                         forced_assignment = true;
                     }
                 }
                 
                 if (selected_group_id < 0) {
                     // 实在找不到组，标记为缺少人手
+                    trace_.endRound(0, -1, true);
                     task.setShortStaffed(true);
                     break;
                 }
             } else {
                 // 有可用组，按正常轮转逻辑选择
-                // 创建可用组的映射，便于查找
-                map<int, vector<string>> available_groups_map;
+                PROFILE_SCOPE("load.score_groups");
+                // 标记候选小组，轮转时按下标查找（本轮结束时清除）
                 for (const auto& group_pair : available_groups) {
-                    available_groups_map[group_pair.first] = group_pair.second;
+                    group_available[group_pair.first - 1] = 1;
                 }
                 
                 // 早出港派工（08:00前）：临近机位尽量同组保障
@@ -686,7 +849,7 @@ void LoadScheduler::assignTasksToEmployees(vector<LoadTask>& tasks,
                     
                     for (const auto& group_pair : available_groups) {
                         int group_id = group_pair.first;
-                        const vector<string>& group_members = group_pair.second;
+                        const IdNames& group_members = *group_pair.second;
                         
                         // 获取该组最近任务的机位
                         int last_stand = 0;
@@ -697,10 +860,10 @@ void LoadScheduler::assignTasksToEmployees(vector<LoadTask>& tasks,
                                 continue;
                             }
                             const LoadEmployeeInfo* emp = emp_it->second;
-                            const auto& assigned_task_ids = emp->getEmployeeInfo().getAssignedTaskIds();
+                            const auto& assigned_task_keys = emp->getEmployeeInfo().getAssignedTaskKeys();
                             
-                            for (const string& assigned_task_id : assigned_task_ids) {
-                                auto assigned_task_it = task_ptr_map.find(assigned_task_id);
+                            for (int assigned_task_key : assigned_task_keys) {
+                                auto assigned_task_it = task_ptr_map.find(assigned_task_key);
                                 if (assigned_task_it == task_ptr_map.end() || assigned_task_it->second == nullptr) {
                                     continue;
                                 }
@@ -742,7 +905,7 @@ void LoadScheduler::assignTasksToEmployees(vector<LoadTask>& tasks,
                     
                     if (best_group_id >= 0) {
                         selected_group_id = best_group_id;
-                        selected_group_members = available_groups_map[best_group_id];
+                        selected_group_members = &group_members_by_index[best_group_id - 1];
                         // 更新轮转索引
                         for (size_t i = 0; i < rotation_order.size(); ++i) {
                             if (rotation_order[i] == best_group_id) {
@@ -759,8 +922,8 @@ void LoadScheduler::assignTasksToEmployees(vector<LoadTask>& tasks,
                     // 计算实际开始时间（使用最早开始时间）
                     long actual_start = earliest_start;
                     
-                    // 维护一个set来记录不可用的小组（1-8组）
-                    set<int> unavailable_groups;
+                    // 用位掩码记录不可用的小组（1-8组）
+                    unsigned unavailable_groups = 0;
                     
                     // 从轮换数组的当前位置开始，依次检查对应的小组是否可用
                     for (int offset = 0; offset < 1000; ++offset) {
@@ -779,24 +942,24 @@ void LoadScheduler::assignTasksToEmployees(vector<LoadTask>& tasks,
                             // 检查组ID是否匹配候选值（假设组ID范围是1-8）
                             if (group_id == candidate_group_value) {
                                 group_found = true;
-                                auto it = available_groups_map.find(group_id);
-                                if (it != available_groups_map.end()) {
+                                if (group_available[group_id - 1]) {
                                     // 找到可用的组，分配任务
                                     selected_group_id = group_id;
-                                    selected_group_members = it->second;
+                                    selected_group_members = group_pair.second;
                                     found_by_rotation = true;
                                     // 更新轮转索引到下一个
                                     current_rotation_index = (idx + 1) % 1000;
                                     break;
                                 } else {
                                     // 组不可用，加入set
-                                    unavailable_groups.insert(group_id);
+                                    unavailable_groups |= 1u << group_id;
                                     
                                     // 如果所有1-8组都不可用，找到最先结束的小组进行强制分配
-                                    if (unavailable_groups.size() == 8) {
+                                    if (unavailable_groups == ALL_ROTATION_GROUPS) {
                                         long earliest_end_time = LONG_MAX;
                                         int earliest_end_group_id = -1;
-                                        vector<string> earliest_end_group_members;
+                                        int best_double_priority = INT_MIN;
+                                        const IdNames* earliest_end_group_members = nullptr;
                                         
                                         for (const auto& group_pair : groups) {
                                             int gid = group_pair.first;
@@ -805,13 +968,17 @@ void LoadScheduler::assignTasksToEmployees(vector<LoadTask>& tasks,
                                                 continue;
                                             }
                                             
-                                            const vector<string>& g_members = group_pair.second;
+                                            const IdNames& g_members = *group_pair.second;
                                             
                                             // 检查组是否完整（必须有3个人）
                                             if (g_members.size() < GROUP_SIZE) {
                                                 continue;
                                             }
                                             
+                                            if (!forcedGroupAllowed(gid, earliest_start, earliest_start + duration, task.isRemoteStand())) {
+                                                continue;
+                                            }
+                                            
                                             // 找到该组所有成员中最近结束的任务
                                             long group_last_end_time = -1;
                                             for (const string& emp_id : g_members) {
@@ -821,10 +988,10 @@ void LoadScheduler::assignTasksToEmployees(vector<LoadTask>& tasks,
                                                 }
                                                 
                                                 const LoadEmployeeInfo* emp = emp_it->second;
-                                                const auto& assigned_task_ids = emp->getEmployeeInfo().getAssignedTaskIds();
+                                                const auto& assigned_task_keys = emp->getEmployeeInfo().getAssignedTaskKeys();
                                                 
-                                                for (const string& assigned_task_id : assigned_task_ids) {
-                                                    auto assigned_task_it = task_ptr_map.find(assigned_task_id);
+                                                for (int assigned_task_key : assigned_task_keys) {
+                                                    auto assigned_task_it = task_ptr_map.find(assigned_task_key);
                                                     if (assigned_task_it == task_ptr_map.end() || assigned_task_it->second == nullptr) {
                                                         continue;
                                                     }
@@ -842,11 +1009,14 @@ void LoadScheduler::assignTasksToEmployees(vector<LoadTask>& tasks,
                                                 group_last_end_time = 0;
                                             }
                                             
-                                            // 选择最先结束任务的组
-                                            if (group_last_end_time < earliest_end_time) {
+                                            // 双机优先级高的组优先，同优先级选择最先结束任务的组
+                                            int double_priority = skill_tiers.doublePriority(gid - 1, work_tracker.doubleCount(gid - 1) > 0);
+                                            if (double_priority > best_double_priority ||
+                                                (double_priority == best_double_priority && group_last_end_time < earliest_end_time)) {
+                                                best_double_priority = double_priority;
                                                 earliest_end_time = group_last_end_time;
                                                 earliest_end_group_id = gid;
-                                                earliest_end_group_members = g_members;
+                                                earliest_end_group_members = &g_members;
                                             }
                                         }
                                         
@@ -870,12 +1040,13 @@ void LoadScheduler::assignTasksToEmployees(vector<LoadTask>& tasks,
                         
                         // 如果组不存在，也加入set（避免无限循环）
                         if (!group_found && candidate_group_value >= 1 && candidate_group_value <= 8) {
-                            unavailable_groups.insert(candidate_group_value);
-                            if (unavailable_groups.size() == 8) {
+                            unavailable_groups |= 1u << candidate_group_value;
+                            if (unavailable_groups == ALL_ROTATION_GROUPS) {
                                 // 所有1-8组都不可用或不存在，找到最先结束的小组
                                 long earliest_end_time = LONG_MAX;
                                 int earliest_end_group_id = -1;
-                                vector<string> earliest_end_group_members;
+                                int best_double_priority = INT_MIN;
+                                const IdNames* earliest_end_group_members = nullptr;
                                 
                                 for (const auto& group_pair : groups) {
                                     int gid = group_pair.first;
@@ -883,11 +1054,15 @@ void LoadScheduler::assignTasksToEmployees(vector<LoadTask>& tasks,
                                         continue;
                                     }
                                     
-                                    const vector<string>& g_members = group_pair.second;
+                                    const IdNames& g_members = *group_pair.second;
                                     if (g_members.size() < GROUP_SIZE) {
                                         continue;
                                     }
                                     
+                                    if (!forcedGroupAllowed(gid, earliest_start, earliest_start + duration, task.isRemoteStand())) {
+                                        continue;
+                                    }
+                                    
                                     long group_last_end_time = -1;
                                     for (const string& emp_id : g_members) {
                                         auto emp_it = employee_map.find(emp_id);
@@ -896,10 +1071,10 @@ void LoadScheduler::assignTasksToEmployees(vector<LoadTask>& tasks,
                                         }
                                         
                                         const LoadEmployeeInfo* emp = emp_it->second;
-                                        const auto& assigned_task_ids = emp->getEmployeeInfo().getAssignedTaskIds();
+                                        const auto& assigned_task_keys = emp->getEmployeeInfo().getAssignedTaskKeys();
                                         
-                                        for (const string& assigned_task_id : assigned_task_ids) {
-                                            auto assigned_task_it = task_ptr_map.find(assigned_task_id);
+                                        for (int assigned_task_key : assigned_task_keys) {
+                                            auto assigned_task_it = task_ptr_map.find(assigned_task_key);
                                             if (assigned_task_it == task_ptr_map.end() || assigned_task_it->second == nullptr) {
                                                 continue;
                                             }
@@ -916,10 +1091,13 @@ void LoadScheduler::assignTasksToEmployees(vector<LoadTask>& tasks,
                                         group_last_end_time = 0;
                                     }
                                     
-                                    if (group_last_end_time < earliest_end_time) {
+                                    int double_priority = skill_tiers.doublePriority(gid - 1, work_tracker.doubleCount(gid - 1) > 0);
+                                    if (double_priority > best_double_priority ||
+                                        (double_priority == best_double_priority && group_last_end_time < earliest_end_time)) {
+                                        best_double_priority = double_priority;
                                         earliest_end_time = group_last_end_time;
                                         earliest_end_group_id = gid;
-                                        earliest_end_group_members = g_members;
+                                        earliest_end_group_members = &g_members;
                                     }
                                 }
                                 
@@ -958,99 +1136,18 @@ void LoadScheduler::assignTasksToEmployees(vector<LoadTask>& tasks,
                     }
                 
                     // 优先级2：临近下班小组任务指派（尽量为小组分配不延误下班时间的机位任务）
-                    // 检查任务结束时间是否在下班时间之后（这里简化处理，假设下班时间为22:00）
-                    const long DEFAULT_OFF_DUTY_TIME = 22 * 3600;  // 22:00 = 79200秒
+                    // 检查任务结束时间是否在小组班期结束之后（超出部分为加班，是否允许已在过滤时检查）
                     long actual_start = earliest_start;
                     long actual_end = actual_start + duration;
-                    long task_day = actual_start / (24 * 3600);
-                    long off_duty_time = task_day * (24 * 3600) + DEFAULT_OFF_DUTY_TIME;
-                    bool task_delays_off_duty = (actual_end > off_duty_time);
+                    long overtime = work_tracker.overtime(group_id - 1, actual_start, actual_end);
+                    bool task_delays_off_duty = (overtime > 0);
                     
                     // 如果任务会延误下班，优先选择当日工时较少的组（这些组可能更早下班）
-                    long group_daily_task_time = calculateGroupDailyTaskTime(group_pair.second, actual_start, task_ptr_map, employee_map);
+                    long group_daily_task_time = calculateGroupDailyTaskTime(*group_pair.second, actual_start, task_ptr_map, employee_map);
                     
-                    // 优先级3：计算连续工作时长
-                    long continuous_work_duration = 0;
-                    if (task_stand > 0) {
-                        // 收集该组所有成员的所有已分配任务（在当前任务开始之前的）
-                        vector<tuple<long, long, int>> prev_tasks;  // (start_time, end_time, stand)
-                        
-                        for (const string& emp_id : group_pair.second) {
-                            auto emp_it = employee_map.find(emp_id);
-                            if (emp_it == employee_map.end()) {
-                                continue;
-                            }
-                            
-                            const LoadEmployeeInfo* emp = emp_it->second;
-                            const auto& assigned_task_ids = emp->getEmployeeInfo().getAssignedTaskIds();
-                            
-                            for (const string& assigned_task_id : assigned_task_ids) {
-                                auto assigned_task_it = task_ptr_map.find(assigned_task_id);
-                                if (assigned_task_it == task_ptr_map.end() || assigned_task_it->second == nullptr) {
-                                    continue;
-                                }
-                                
-                                const LoadTask& assigned_task = *(assigned_task_it->second);
-                                long assigned_end = assigned_task.getActualEndTime();
-                                // 只考虑在当前任务开始之前的任务
-                                if (assigned_end > 0 && assigned_end < earliest_start) {
-                                    // 获取该任务的机位（直接从task中获取）
-                                    int assigned_stand = assigned_task.getStand();
-                                    
-                                    prev_tasks.push_back({assigned_task.getActualStartTime(), 
-                                                          assigned_end, 
-                                                          assigned_stand});
-                                }
-                            }
-                        }
-                        
-                        // 如果有上一个任务，计算连续工作时长
-                        if (!prev_tasks.empty()) {
-                            // 按开始时间排序
-                            sort(prev_tasks.begin(), prev_tasks.end());
-                            
-                            // 从最近的任务开始，向前查找连续的任务链
-                            long actual_start = earliest_start;
-                            long actual_end = actual_start + duration;
-                            long current_end = actual_end;
-                            long current_start = actual_start;
-                            int current_stand = task_stand;
-                            long chain_start = actual_start;
-                            
-                            // 反向遍历，查找连续的任务
-                            for (int i = static_cast<int>(prev_tasks.size()) - 1; i >= 0; --i) {
-                                long prev_start = get<0>(prev_tasks[i]);
-                                long prev_end = get<1>(prev_tasks[i]);
-                                int prev_stand = get<2>(prev_tasks[i]);
-                                
-                                // 计算路程时间
-                                long travel_time = 0;
-                                if (prev_stand > 0 && current_stand > 0) {
-                                    travel_time = StandDistance::getInstance().getTravelTime(prev_stand, current_stand);
-                                } else if (prev_stand > 0) {
-                                    travel_time = 5 * 60;  // 默认5分钟
-                                }
-                                
-                                // 如果上一个任务结束时间 + 路程时间 <= 当前任务开始时间，认为是连续的
-                                if (prev_end + travel_time <= current_start) {
-                                    // 更新连续链的开始时间
-                                    chain_start = prev_start;
-                                    current_start = prev_start;
-                                    current_stand = prev_stand;
-                                    // 继续向前查找
-                                } else {
-                                    // 不连续，停止查找
-                                    break;
-                                }
-                            }
-                            
-                            // 计算连续工作时长
-                            continuous_work_duration = current_end - chain_start;
-                        } else {
-                            // 没有上一个任务，连续工作时长就是当前任务时长
-                            continuous_work_duration = duration;
-                        }
-                    }
+                    // 优先级3：连续工作时长（小组连续工作链增量维护，O(1)查询）
+                    long continuous_work_duration = work_tracker.continuousWork(
+                        group_id - 1, earliest_start, earliest_start + duration);
                     
                     // 优先级4：计算路程时间（机位远近）
                     long travel_time_score = 0;
@@ -1059,18 +1156,18 @@ void LoadScheduler::assignTasksToEmployees(vector<LoadTask>& tasks,
                         int last_stand = 0;
                         long last_end_time = -1;
                         
-                        for (const string& emp_id : group_pair.second) {
+                        for (const string& emp_id : *group_pair.second) {
                             auto emp_it = employee_map.find(emp_id);
                             if (emp_it == employee_map.end()) {
                                 continue;
                             }
                             
                             const LoadEmployeeInfo* emp = emp_it->second;
-                            const auto& assigned_task_ids = emp->getEmployeeInfo().getAssignedTaskIds();
+                            const auto& assigned_task_keys = emp->getEmployeeInfo().getAssignedTaskKeys();
                             
                             // 找到该组所有成员中最近结束的任务
-                            for (const string& assigned_task_id : assigned_task_ids) {
-                                auto assigned_task_it = task_ptr_map.find(assigned_task_id);
+                            for (int assigned_task_key : assigned_task_keys) {
+                                auto assigned_task_it = task_ptr_map.find(assigned_task_key);
                                 if (assigned_task_it == task_ptr_map.end() || assigned_task_it->second == nullptr) {
                                     continue;
                                 }
@@ -1096,8 +1193,8 @@ void LoadScheduler::assignTasksToEmployees(vector<LoadTask>& tasks,
                     // 如果任务会延误下班，增加当日工时较少的组的权重（优先选择）
                     long off_duty_penalty = 0;
                     if (task_delays_off_duty) {
-                        // 当日工时较少的组得分更低（更优先）
-                        off_duty_penalty = group_daily_task_time / 100;  // 工时越少，惩罚越小
+                        // 加班时长与连续工作时长同权重计入，同时当日工时较少的组得分更低（更优先）
+                        off_duty_penalty = overtime * 100 + group_daily_task_time / 100;  // 工时越少，惩罚越小
                     } else {
                         // 任务不会延误下班，优先选择当日工时较少的组（小组休息时优先分配）
                         off_duty_penalty = group_daily_task_time / 100;
@@ -1126,19 +1223,22 @@ void LoadScheduler::assignTasksToEmployees(vector<LoadTask>& tasks,
                         }
                     }
                 }
+                
+                for (const auto& group_pair : available_groups) {
+                    group_available[group_pair.first - 1] = 0;
+                }
             }
             
+            trace_.endRound(available_groups.size(), selected_group_id, forced_assignment);
+            any_forced = any_forced || forced_assignment;
+            
             if (selected_group_id < 0) {
-                if (task_index <= 10) {
-                    cerr << "DEBUG: Task " << task_id << " no available groups found, marking as short-staffed" << endl;
-                }
+                LOG_DEBUG("DEBUG: Task " << task_id << " no available groups found, marking as short-staffed");
                 task.setShortStaffed(true);
                 break;
             }
             
-            if (task_index <= 10) {
-                cerr << "DEBUG: Task " << task_id << " selected group " << selected_group_id << " with " << selected_group_members.size() << " members" << endl;
-            }
+            LOG_DEBUG("DEBUG: Task " << task_id << " selected group " << selected_group_id << " with " << selected_group_members->size() << " members");
             
             // 计算实际开始时间（使用最早开始时间）
             long actual_start = earliest_start;
@@ -1146,10 +1246,8 @@ void LoadScheduler::assignTasksToEmployees(vector<LoadTask>& tasks,
             
             // 检查约束：实际开始时间 + 时长 <= 最晚结束时间
             if (actual_end > latest_end) {
-                if (task_index <= 10) {
-                    cerr << "DEBUG: Task " << task_id << " cannot be scheduled: actual_end (" << actual_end 
-                         << ") > latest_end (" << latest_end << ")" << endl;
-                }
+                LOG_DEBUG("DEBUG: Task " << task_id << " cannot be scheduled: actual_end (" << actual_end 
+                          << ") > latest_end (" << latest_end << ")");
                 task.setShortStaffed(true);
                 break;
             }
@@ -1161,7 +1259,7 @@ void LoadScheduler::assignTasksToEmployees(vector<LoadTask>& tasks,
             
             // 分配该组的所有成员到任务
             int assigned_in_this_iteration = 0;  // 记录本次循环中实际分配的人数
-            for (const string& emp_id : selected_group_members) {
+            for (const string& emp_id : *selected_group_members) {
                 // 如果已经分配，跳过
                 if (task.isAssignedToEmployee(emp_id)) {
                     continue;
@@ -1181,6 +1279,11 @@ void LoadScheduler::assignTasksToEmployees(vector<LoadTask>& tasks,
                 assigned_in_this_iteration++;
             }
             
+            if (assigned_in_this_iteration > 0) {
+                work_tracker.addTask(selected_group_id - 1, actual_start, actual_end, task.isRemoteStand());
+                break_timeline.addWork(selected_group_id - 1, actual_start, actual_end);
+            }
+            
             // 防止死循环：如果本次循环中没有任何新的人员被分配（所有成员都已分配），
             // 说明无法继续分配，应该退出循环
             if (assigned_in_this_iteration == 0) {
@@ -1206,24 +1309,34 @@ void LoadScheduler::assignTasksToEmployees(vector<LoadTask>& tasks,
         // 更新任务状态
         if (assigned_count > 0) {
             task.setAssigned(true);
-            if (task_index <= 10) {
-                cerr << "DEBUG: Task " << task_id << " assigned " << assigned_count << " out of " << required_count << " required" << endl;
+            LOG_DEBUG("DEBUG: Task " << task_id << " assigned " << assigned_count << " out of " << required_count << " required");
+            LOG_DEBUG("任务 ID " << task_id 
+                      << " (名称: " << task.getTaskName() 
+                      << ") 已分配 " << assigned_count 
+                      << " 人，需求 " << required_count << " 人。");
+        } else {
+            LOG_DEBUG("DEBUG: Task " << task_id << " failed to assign any employees");
         }
-        cout << "任务 ID " << task_id 
-             << " (名称: " << task.getTaskName() 
-             << ") 已分配 " << assigned_count 
-             << " 人，需求 " << required_count << " 人。" << endl;
+        
+        // 记录派工结果
+        if (task.isShortStaffed()) {
+            trace_.endTask(TraceOutcome::SHORT_STAFFED);
+        } else if (any_forced) {
+            trace_.endTask(TraceOutcome::FORCED);
+        } else if (reused_previous) {
+            trace_.endTask(TraceOutcome::REUSED);
         } else {
-            if (task_index <= 10) {
-                cerr << "DEBUG: Task " << task_id << " failed to assign any employees" << endl;
-            }
+            trace_.endTask(TraceOutcome::ASSIGNED);
         }
         
         // 标记为已处理（无论是否成功分配，都标记为已处理，避免重复处理）
-        processed_task_ids.insert(task_id);
+        processed_task_keys.insert(task_key);
     }
     
-    cout << "装卸任务调度完成！" << endl;
+    // 休息的最终位置按员工展开
+    break_timeline.getPlacements(breaks_, break_ids, break_placements_);
+    
+    LOG_INFO("装卸任务调度完成！");
 }
 
 // 已废弃：scheduleLoadTasksFromCommon函数已删除，请直接使用loadLoadTasksFromCSV加载LoadTask，然后调用scheduleLoadTasks
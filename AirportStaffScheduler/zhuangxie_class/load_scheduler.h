@@ -11,6 +11,10 @@
 #include "load_employee_info.h"
 #include "load_task.h"
 #include "stand_distance.h"
+#include "assignment_trace.h"
+#include "group_work_state.h"
+#include "skill_tiers.h"
+#include "../BreakTimeline.h"
 #include "../vip_first_class_algo/shift.h"
 #include <vector>
 #include <string>
@@ -70,6 +74,50 @@ public:
                           const vector<LoadTask>* previous_tasks = nullptr,
                           const map<string, vector<string>>* group_name_to_employees = nullptr);
     
+    /**
+     * @brief 设置连续工作规则（默认不限制）
+     * @param rules 连续工作规则，一般由LoadModelView::buildWorkRules从parameter.csv生成
+     */
+    void setWorkRules(const LoadWorkRules& rules) { work_rules_ = rules; }
+    
+    /**
+     * @brief 设置员工班期（默认不限制班期）
+     * @param windows 班期列表，一般由LoadModelView::buildShiftWindows从shift.csv生成；
+     *                组员班期的交集是小组的硬边界，超出班期结束的加班（需组员都允许加班，
+     *                不超过最大加班时间）计入选组得分
+     */
+    void setShiftWindows(const vector<StaffShiftWindow>& windows) { shift_windows_ = windows; }
+    
+    /**
+     * @brief 设置员工休息（默认没有休息）
+     * @param breaks 休息列表，一般由LoadModelView::buildBreaks从break.csv生成；
+     *               组员的休息占用整个小组，未锁定的用餐在浮动窗口内随派工挪到空档
+     */
+    void setBreaks(const vector<AirportStaffScheduler::Breaks::StaffBreak>& breaks) { breaks_ = breaks; }
+    
+    /**
+     * @brief 设置熟练度规则（默认不限制熟练度、没有双机优先级）
+     * @param rules 熟练度规则，一般由LoadModelView::buildSkillRules从parameter.csv和skill.csv生成；
+     *              熟练度下限不满足的小组不参与派工，强制分配时双机优先级高的小组优先
+     */
+    void setSkillRules(const LoadSkillRules& rules) { skill_rules_ = rules; }
+    
+    /**
+     * @brief 设置员工资质熟练度（默认为空，即所有人熟练度为0）
+     * @param levels 熟练度列表，一般由LoadModelView::buildSkillLevels从qualLevel.csv生成
+     */
+    void setSkillLevels(const vector<EmployeeSkill>& levels) { skill_levels_ = levels; }
+    
+    /**
+     * @brief 获取最近一次调度后每名员工的休息位置（按setBreaks的顺序，不在完整小组中的员工保持原位）
+     */
+    const vector<AirportStaffScheduler::Breaks::BreakPlacement>& getBreakPlacements() const { return break_placements_; }
+    
+    /**
+     * @brief 获取最近一次调度的派工解释记录（每个任务的小组排除原因和派工结果）
+     */
+    const AssignmentTrace& getAssignmentTrace() const { return trace_; }
+    
 private:
     /**
      * @brief 按任务保障优先级排序任务
@@ -93,7 +141,13 @@ private:
                                 const vector<LoadTask>* previous_tasks,
                                 const map<string, vector<string>>& group_name_to_employees);
     
-    
+    AssignmentTrace trace_;  ///< 派工解释记录
+    LoadWorkRules work_rules_;  ///< 连续工作规则
+    vector<StaffShiftWindow> shift_windows_;  ///< 员工班期
+    vector<AirportStaffScheduler::Breaks::StaffBreak> breaks_;  ///< 员工休息
+    vector<AirportStaffScheduler::Breaks::BreakPlacement> break_placements_;  ///< 调度后的休息位置
+    LoadSkillRules skill_rules_;  ///< 熟练度规则
+    vector<EmployeeSkill> skill_levels_;  ///< 员工资质熟练度
 };
 
 }  // namespace zhuangxie_class
@@ -20,6 +20,7 @@ LoadTask::LoadTask()
     , actual_start_time_(0)
     , duration_(0)
     , flight_type_(0)
+    , body_type_(BodyType::UNKNOWN)
     , arrival_time_(0)
     , departure_time_(0)
     , travel_time_(DEFAULT_TRAVEL_TIME)
@@ -34,6 +35,7 @@ LoadTask::LoadTask()
     , required_qualification_(0)
     , can_new_employee_(false)
     , required_count_(0)
+    , required_vehicle_type_("")
     , is_assigned_(false)
     , is_short_staffed_(false)
 {
@@ -45,37 +47,27 @@ LoadTask::~LoadTask()
 
 void LoadTask::addAssignedEmployeeId(const string& employee_id)
 {
+    int key = AirportStaffScheduler::Ids::IdRegistry::intern(employee_id);
     // ǷѴ
-    for (const auto& id : assigned_employee_ids_) {
-        if (id == employee_id) {
-            return;  // Ѿڣظ
-        }
+    if (assigned_employee_ids_.contains(key)) {
+        return;  // Ѿڣظ
     }
-    assigned_employee_ids_.push_back(employee_id);
+    assigned_employee_ids_.push_back(key);
     is_assigned_ = !assigned_employee_ids_.empty();
 }
 
 void LoadTask::removeAssignedEmployeeId(const string& employee_id)
 {
-    auto it = assigned_employee_ids_.begin();
-    while (it != assigned_employee_ids_.end()) {
-        if (*it == employee_id) {
-            assigned_employee_ids_.erase(it);
-            break;
-        }
-        ++it;
+    int key = AirportStaffScheduler::Ids::IdRegistry::find(employee_id);
+    if (key >= 0) {
+        assigned_employee_ids_.remove(key);
     }
     is_assigned_ = !assigned_employee_ids_.empty();
 }
 
 bool LoadTask::isAssignedToEmployee(const string& employee_id) const
 {
-    for (const auto& id : assigned_employee_ids_) {
-        if (id == employee_id) {
-            return true;
-        }
-    }
-    return false;
+    return assigned_employee_ids_.containsName(employee_id);
 }
 
 void LoadTask::clearAssignedEmployees()
@@ -8,6 +8,7 @@
 #ifndef ZHUANGXIE_CLASS_LOAD_TASK_H
 #define ZHUANGXIE_CLASS_LOAD_TASK_H
 
+#include "../InternedIds.h"
 #include <string>
 #include <vector>
 
@@ -27,6 +28,15 @@ enum class FlightType {
     INTERNATIONAL_TRANSIT = 5  ///< ʹվ
 };
 
+/**
+ * @brief ö٣task.csv ͣ
+ */
+enum class BodyType {
+    UNKNOWN = 0,               ///< δ֪
+    NARROW = 1,                ///< խ
+    WIDE = 2                   ///< 
+};
+
 /**
  * @brief װж
  * 
@@ -160,6 +170,18 @@ public:
      */
     void setFlightTypeEnum(FlightType type) { flight_type_ = static_cast<int>(type); }
     
+    /**
+     * @brief ȡ
+     * @return öֵ
+     */
+    BodyType getBodyType() const { return body_type_; }
+    
+    /**
+     * @brief û
+     * @param type öֵ
+     */
+    void setBodyType(BodyType type) { body_type_ = type; }
+    
     /**
      * @brief ȡʱ
      * @return ʱ䣨202011000뿪ʼ
@@ -332,6 +354,18 @@ public:
      */
     void setRequiredCount(int count) { required_count_ = count; }
     
+    /**
+     * @brief ȡ賵
+     * @return ͣձʾҪ
+     */
+    const string& getRequiredVehicleType() const { return required_vehicle_type_; }
+    
+    /**
+     * @brief 賵
+     * @param vehicle_type 
+     */
+    void setRequiredVehicleType(const string& vehicle_type) { required_vehicle_type_ = vehicle_type; }
+    
     // ===== ״̬ =====
     
     /**
@@ -360,9 +394,14 @@ public:
     
     /**
      * @brief ȡѷԱIDб
-     * @return ѷԱIDб
+     * @return ѷԱIDбֻͼ˳޸ķʧЧ
      */
-    const vector<string>& getAssignedEmployeeIds() const { return assigned_employee_ids_; }
+    AirportStaffScheduler::Ids::IdNames getAssignedEmployeeIds() const { return assigned_employee_ids_.names(); }
+    
+    /**
+     * @brief ȡѷԱбIdRegistryţ
+     */
+    const AirportStaffScheduler::Ids::SmallIdList<6>& getAssignedEmployeeKeys() const { return assigned_employee_ids_; }
     
     /**
      * @brief ȡѷԱ
@@ -389,6 +428,13 @@ public:
      */
     bool isAssignedToEmployee(const string& employee_id) const;
     
+    /**
+     * @brief ǷѷָԱIdRegistryţȲ룩
+     * @param employee_key Ա
+     * @return trueʾѷ䣬falseʾδ
+     */
+    bool isAssignedToEmployee(int employee_key) const { return assigned_employee_ids_.contains(employee_key); }
+    
     /**
      * @brief ѷԱ
      */
@@ -408,6 +454,7 @@ private:
     
     // Ϣ
     int flight_type_;                   ///< ͣ0-5
+    BodyType body_type_;                ///< 
     long arrival_time_;                 ///< ʱ䣨202011000뿪ʼ
     long departure_time_;               ///< ʱ䣨202011000뿪ʼ
     long travel_time_;                   ///< ͨʱ䣨룬Ĭ8=480룩
@@ -424,11 +471,12 @@ private:
     int required_qualification_;         ///< Ҫͣλ룩
     bool can_new_employee_;             ///< ǷԱ
     int required_count_;                ///< ҪԱֱӴCSVȡٴӻ㣩
+    string required_vehicle_type_;      ///< 賵ͣձʾҪ
     
     // ״̬
     bool is_assigned_;                  ///< ǷѾ
     bool is_short_staffed_;             ///< Ƿȱ
-    vector<string> assigned_employee_ids_;  ///< ѷԱIDб
+    AirportStaffScheduler::Ids::SmallIdList<6> assigned_employee_ids_;  ///< ѷԱбͨΪ36ˣڴ棩
 };
 
 }  // namespace zhuangxie_class
@@ -0,0 +1,114 @@
+/**
+ * @file skill_tiers.cpp
+ * @brief 装卸小组的资质熟练度分层实现
+ */
+
+#include "skill_tiers.h"
+#include <unordered_map>
+#include <algorithm>
+#include <climits>
+
+namespace zhuangxie_class {
+
+using namespace std;
+
+SkillTiers::SkillTiers(const LoadSkillRules& rules)
+    : rules_(rules)
+{
+}
+
+SkillTiers::~SkillTiers()
+{
+}
+
+void SkillTiers::build(const AirportStaffScheduler::Ids::IdNames& members, size_t group_size,
+                       const vector<EmployeeSkill>& levels) {
+    // 资质编号：0号固定为熟练度限制针对的资质，其余按出现顺序编号
+    unordered_map<string, int> qualification_index;
+    qualification_index[rules_.qualification] = 0;
+    auto qualificationOf = [&](const string& name) {
+        auto it = qualification_index.find(name);
+        if (it != qualification_index.end()) {
+            return it->second;
+        }
+        int index = static_cast<int>(qualification_index.size());
+        qualification_index[name] = index;
+        return index;
+    };
+    for (const auto& item : rules_.priorities) {
+        qualificationOf(item.qualification);
+    }
+    for (const auto& item : levels) {
+        qualificationOf(item.qualification);
+    }
+    size_t qualification_count = qualification_index.size();
+
+    // 员工编号：按小组顺序依次编号
+    unordered_map<string, int> employee_index;
+    for (const string& employee_id : members) {
+        if (!employee_index.count(employee_id)) {
+            int index = static_cast<int>(employee_index.size());
+            employee_index[employee_id] = index;
+        }
+    }
+
+    employee_levels_.assign(employee_index.size() * qualification_count, 0);
+    for (const auto& item : levels) {
+        auto it = employee_index.find(item.employee_id);
+        if (it == employee_index.end() || item.level <= 0) {
+            continue;
+        }
+        uint8_t level = static_cast<uint8_t>(min(item.level, 255));
+        uint8_t& cell = employee_levels_[it->second * qualification_count + qualification_index[item.qualification]];
+        cell = max(cell, level);
+    }
+
+    // 资质的双机优先级（没有配置的资质为0）
+    vector<int> double_priority(qualification_count, 0);
+    vector<int> continuous_priority(qualification_count, 0);
+    for (const auto& item : rules_.priorities) {
+        int q = qualification_index[item.qualification];
+        double_priority[q] = item.double_priority;
+        continuous_priority[q] = item.continuous_double_priority;
+    }
+
+    size_t group_count = group_size == 0 ? 0 : members.size() / group_size;
+    min_level_.assign(group_count, 0);
+    level_sum_.assign(group_count, 0);
+    senior_count_.assign(group_count, 0);
+    double_priority_.assign(group_count, 0);
+    continuous_double_priority_.assign(group_count, 0);
+    for (size_t g = 0; g < group_count; ++g) {
+        size_t first = g * group_size;
+        int lowest = INT_MAX;
+        for (size_t m = first; m < first + group_size; ++m) {
+            int level = employee_levels_[employee_index[members[m]] * qualification_count];
+            lowest = min(lowest, level);
+            level_sum_[g] += level;
+            if (rules_.min_level > 0 && level >= rules_.min_level) {
+                senior_count_[g]++;
+            }
+        }
+        min_level_[g] = lowest;
+
+        // 全员都具备的资质才算小组资质，取其中最高的优先级
+        for (size_t q = 0; q < qualification_count; ++q) {
+            if (double_priority[q] == 0 && continuous_priority[q] == 0) {
+                continue;
+            }
+            bool all_qualified = true;
+            for (size_t m = first; m < first + group_size; ++m) {
+                if (employee_levels_[employee_index[members[m]] * qualification_count + q] == 0) {
+                    all_qualified = false;
+                    break;
+                }
+            }
+            if (all_qualified) {
+                double_priority_[g] = max(double_priority_[g], double_priority[q]);
+                continuous_double_priority_[g] = max(continuous_double_priority_[g], continuous_priority[q]);
+            }
+        }
+    }
+}
+
+}  // namespace zhuangxie_class
@@ -0,0 +1,122 @@
+/**
+ * @file skill_tiers.h
+ * @brief 装卸小组的资质熟练度分层（预先编译，O(1)查询熟练度限制和双机优先级）
+ *
+ * 小组按shift.csv的班组名3人一组切分，与资质无关；qualLevel.csv给出每名员工每项资质的熟练度，
+ * skill.csv给出每项资质的双机优先级。派工开始前一次性编译：
+ * - 员工 × 资质的熟练度压成一个紧凑的字节数组（没有该资质为0）；
+ * - 每个小组汇总规则资质的最低熟练度、熟练度之和、达到熟练度下限的人数，
+ *   以及全员都具备的资质中最高的双机优先级和连续双机优先级。
+ *
+ * 派工过滤和强制分配选组时只读小组汇总数组的一个元素，不再遍历成员和资质。
+ */
+
+#ifndef ZHUANGXIE_CLASS_SKILL_TIERS_H
+#define ZHUANGXIE_CLASS_SKILL_TIERS_H
+
+#include "../InternedIds.h"
+#include <vector>
+#include <string>
+#include <cstdint>
+
+namespace zhuangxie_class {
+
+using namespace std;
+
+/**
+ * @brief 员工资质熟练度（qualLevel.csv的一行）
+ */
+struct EmployeeSkill {
+    string employee_id;                ///< 人员ID
+    string qualification;              ///< 资质名称
+    int level = 0;                     ///< 熟练度
+};
+
+/**
+ * @brief 资质双机优先级（skill.csv的一行，数值越大越优先）
+ */
+struct QualificationPriority {
+    string qualification;              ///< 资质名称
+    int double_priority = 0;           ///< 双机优先级
+    int continuous_double_priority = 0;  ///< 连续双机优先级（小组已有双机作业时使用）
+};
+
+/**
+ * @brief 熟练度规则（parameter.csv的航班人员资质熟练度限制 + skill.csv）
+ *
+ * 航班人员资质熟练度限制为"装卸资质:3:2"时，qualification = "装卸资质"、min_level = 3、min_members = 2
+ */
+struct LoadSkillRules {
+    string qualification = "装卸资质";  ///< 熟练度限制针对的资质
+    int min_level = 0;                 ///< 熟练度下限（0表示不限制）
+    int min_members = 1;               ///< 小组中至少有几人达到熟练度下限
+    vector<QualificationPriority> priorities;  ///< 资质双机优先级
+};
+
+/**
+ * @brief 所有小组的资质熟练度分层
+ */
+class SkillTiers {
+public:
+    /**
+     * @brief 构造函数
+     * @param rules 熟练度规则
+     */
+    explicit SkillTiers(const LoadSkillRules& rules = LoadSkillRules());
+
+    /**
+     * @brief 析构函数
+     */
+    ~SkillTiers();
+
+    /**
+     * @brief 编译员工熟练度和小组汇总（清空之前的结果）
+     * @param members 所有小组的组员（按小组下标连续存放，每组group_size人）
+     * @param group_size 每组人数
+     * @param levels 员工资质熟练度（不在任何小组中的员工忽略，同一员工同一资质取最高熟练度）
+     */
+    void build(const AirportStaffScheduler::Ids::IdNames& members, size_t group_size,
+               const vector<EmployeeSkill>& levels);
+
+    /**
+     * @brief 小组是否满足熟练度限制（达到熟练度下限的人数不少于要求）
+     */
+    bool meetsProficiency(int group) const {
+        return rules_.min_level <= 0 || senior_count_[group] >= rules_.min_members;
+    }
+
+    /**
+     * @brief 小组规则资质的最低熟练度
+     */
+    int minLevel(int group) const { return min_level_[group]; }
+
+    /**
+     * @brief 小组规则资质的熟练度之和
+     */
+    int levelSum(int group) const { return level_sum_[group]; }
+
+    /**
+     * @brief 小组的双机优先级（小组已有双机作业时取连续双机优先级；没有配置时为0）
+     */
+    int doublePriority(int group, bool continuous) const {
+        return continuous ? continuous_double_priority_[group] : double_priority_[group];
+    }
+
+    /**
+     * @brief 获取熟练度规则
+     */
+    const LoadSkillRules& getRules() const { return rules_; }
+
+private:
+    LoadSkillRules rules_;                      ///< 熟练度规则
+    vector<uint8_t> employee_levels_;           ///< 员工 × 资质的熟练度（行主序，0表示没有该资质）
+    vector<int> min_level_;                     ///< 每个小组规则资质的最低熟练度
+    vector<int> level_sum_;                     ///< 每个小组规则资质的熟练度之和
+    vector<int> senior_count_;                  ///< 每个小组达到熟练度下限的人数
+    vector<int> double_priority_;               ///< 每个小组的双机优先级
+    vector<int> continuous_double_priority_;    ///< 每个小组的连续双机优先级
+};
+
+}  // namespace zhuangxie_class
+
+#endif  // ZHUANGXIE_CLASS_SKILL_TIERS_H
@@ -0,0 +1,492 @@
+/**
+ * @file stable_redispatch.cpp
+ * @brief 稳定性优先的装卸重新派工实现
+ */
+
+#include "stable_redispatch.h"
+#include "stand_distance.h"
+#include "connect_rule_table.h"
+#include "group_kernels.h"
+#include "../PlanDiff.h"
+#include "../Profiler.h"
+#include <algorithm>
+#include <climits>
+#include <unordered_map>
+
+namespace zhuangxie_class {
+
+using namespace std;
+
+namespace {
+
+/**
+ * @brief 员工时间线上的一段任务
+ */
+struct Slot {
+    long start;
+    long end;
+    const LoadTask* task;
+};
+
+/**
+ * @brief 派工过程中的员工时间线（按开始时间有序）
+ */
+class Timelines {
+public:
+    Timelines(vector<LoadEmployeeInfo>& employees)
+        : employees_(employees)
+        , slots_(employees.size())
+        , work_time_(employees.size(), 0)
+    {
+        for (size_t i = 0; i < employees.size(); ++i) {
+            index_[employees[i].getEmployeeId()] = static_cast<int>(i);
+        }
+    }
+
+    int find(const string& employee_id) const {
+        auto it = index_.find(employee_id);
+        return it == index_.end() ? -1 : it->second;
+    }
+
+    /**
+     * @brief 员工能否在start开始执行任务（不重叠，且与前后任务的路程和衔接间隔可行）
+     */
+    bool canPlace(int employee, const LoadTask& task, long start) const {
+        const vector<Slot>& slots = slots_[employee];
+        long end = start + task.getDuration();
+        auto next = lower_bound(slots.begin(), slots.end(), start,
+                                [](const Slot& slot, long value) { return slot.start < value; });
+        if (next != slots.end() && (next->start < end || end + gap(task, *next->task) > next->start)) {
+            return false;
+        }
+        if (next != slots.begin()) {
+            const Slot& prev = *(next - 1);
+            if (prev.end > start || prev.end + gap(*prev.task, task) > start) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief 把员工放到任务上
+     */
+    void place(int employee, LoadTask& task, long start) {
+        Slot slot;
+        slot.start = start;
+        slot.end = start + task.getDuration();
+        slot.task = &task;
+        vector<Slot>& slots = slots_[employee];
+        auto pos = lower_bound(slots.begin(), slots.end(), start,
+                               [](const Slot& s, long value) { return s.start < value; });
+        slots.insert(pos, slot);
+        work_time_[employee] += task.getDuration();
+        task.addAssignedEmployeeId(employees_[employee].getEmployeeId());
+        employees_[employee].getEmployeeInfo().addAssignedTaskId(task.getTaskId());
+    }
+
+    /**
+     * @brief 员工在start之前最后一个任务到本任务的路程时间（没有前序任务或机位未知为0）
+     */
+    long travelBefore(int employee, const LoadTask& task, long start) const {
+        const vector<Slot>& slots = slots_[employee];
+        auto next = lower_bound(slots.begin(), slots.end(), start,
+                                [](const Slot& slot, long value) { return slot.start < value; });
+        if (next == slots.begin()) {
+            return 0;
+        }
+        int prev_stand = (next - 1)->task->getStand();
+        if (prev_stand <= 0 || task.getStand() <= 0) {
+            return 0;
+        }
+        return StandDistance::getInstance().getTravelTime(prev_stand, task.getStand());
+    }
+
+    long workTime(int employee) const { return work_time_[employee]; }
+
+    /**
+     * @brief 员工已有任务的最晚结束时间（没有任务为0）
+     */
+    long lastEnd(int employee) const {
+        long last_end = 0;
+        for (const auto& slot : slots_[employee]) {
+            last_end = max(last_end, slot.end);
+        }
+        return last_end;
+    }
+
+private:
+    // 辅助函数：两个相邻任务之间需要的间隔（路程时间 + 衔接规则间隔，任一机位未知时只要求不重叠）
+    static long gap(const LoadTask& prev, const LoadTask& next) {
+        if (prev.getStand() <= 0 || next.getStand() <= 0) {
+            return 0;
+        }
+        return StandDistance::getInstance().getTravelTime(prev.getStand(), next.getStand()) +
+               ConnectRuleTable::getInstance().getMinInterval(prev, next);
+    }
+
+    vector<LoadEmployeeInfo>& employees_;
+    vector<vector<Slot>> slots_;
+    vector<long> work_time_;
+    unordered_map<string, int> index_;
+};
+
+/**
+ * @brief 派工小组（成员为员工下标）
+ */
+struct Group {
+    vector<int> members;
+};
+
+// 辅助函数：任务时间是否有效（与LoadScheduler的检查一致）
+bool hasValidTime(const LoadTask& task) {
+    long start = task.getEarliestStartTime();
+    long duration = task.getDuration();
+    return start > 0 && task.getLatestEndTime() > 0 && duration > 0 && start + duration <= task.getLatestEndTime();
+}
+
+}  // namespace
+
+StableRedispatcher::StableRedispatcher(const StabilityOptions& options)
+    : options_(options)
+{
+}
+
+StableRedispatcher::~StableRedispatcher()
+{
+}
+
+long StableRedispatcher::changeWeight(long start_time, long now) const {
+    long lead = start_time - now;
+    if (lead <= 0 || options_.horizon <= 0) {
+        return options_.near_weight;
+    }
+    if (lead >= options_.horizon) {
+        return options_.far_weight;
+    }
+    return options_.far_weight + (options_.near_weight - options_.far_weight) * (options_.horizon - lead) / options_.horizon;
+}
+
+RedispatchSummary StableRedispatcher::redispatch(vector<LoadEmployeeInfo>& employees,
+                                                 vector<LoadTask>& tasks,
+                                                 const map<string, vector<string>>& reference,
+                                                 const map<string, vector<string>>& group_name_to_employees)
+{
+    PROFILE_SCOPE("load.stable_redispatch");
+    RedispatchSummary summary;
+    Timelines timelines(employees);
+
+    // 小组：与LoadScheduler相同，按班组名3人一组切分，不完整或有成员缺勤的组不参与派工
+    vector<Group> groups;
+    unordered_map<int, int> employee_group;  // 员工下标 -> 小组下标
+    for (const auto& g_pair : group_name_to_employees) {
+        const vector<string>& emp_list = g_pair.second;
+        for (size_t i = 0; i + GROUP_SIZE <= emp_list.size(); i += GROUP_SIZE) {
+            Group group;
+            for (size_t j = i; j < i + GROUP_SIZE; ++j) {
+                int employee = timelines.find(emp_list[j]);
+                if (employee >= 0) {
+                    group.members.push_back(employee);
+                }
+            }
+            if (group.members.size() == GROUP_SIZE) {
+                for (int employee : group.members) {
+                    employee_group[employee] = static_cast<int>(groups.size());
+                }
+                groups.push_back(group);
+            }
+        }
+    }
+
+    GroupWorkTracker work_tracker(work_rules_);
+    work_tracker.reset(groups.size());
+    for (const auto& window : shift_windows_) {
+        auto group_it = employee_group.find(timelines.find(window.employee_id));
+        if (group_it != employee_group.end()) {
+            work_tracker.addMemberShift(group_it->second, window);
+        }
+    }
+    vector<int> group_member_keys;  // 组员的IdRegistry编号，按小组下标连续存放
+    group_member_keys.reserve(groups.size() * GROUP_SIZE);
+    for (const auto& group : groups) {
+        for (int employee : group.members) {
+            group_member_keys.push_back(AirportStaffScheduler::Ids::IdRegistry::intern(employees[employee].getEmployeeId()));
+        }
+    }
+    SkillTiers skill_tiers(skill_rules_);
+    skill_tiers.build(AirportStaffScheduler::Ids::IdNames(group_member_keys.data(),
+                                                          group_member_keys.data() + group_member_keys.size()),
+                      GROUP_SIZE, skill_levels_);
+    AirportStaffScheduler::Breaks::BreakTimeline break_timeline;
+    break_timeline.reset(groups.size());
+    vector<int> break_ids = break_timeline.addStaffBreaks(breaks_, [&](const string& employee_id) {
+        auto group_it = employee_group.find(timelines.find(employee_id));
+        return group_it == employee_group.end() ? -1 : group_it->second;
+    });
+
+    // 已分配的任务视为锁定，先写入时间线
+    long now = options_.now;
+    bool auto_now = now < 0;
+    vector<size_t> order;
+    for (size_t i = 0; i < tasks.size(); ++i) {
+        LoadTask& task = tasks[i];
+        if (auto_now && hasValidTime(task) && (now < 0 || task.getEarliestStartTime() < now)) {
+            now = task.getEarliestStartTime();
+        }
+        if (task.isAssigned() && task.getAssignedEmployeeCount() > 0) {
+            vector<string> staff = task.getAssignedEmployeeIds();
+            task.clearAssignedEmployees();
+            vector<int> tracked_groups;
+            for (const auto& employee_id : staff) {
+                int employee = timelines.find(employee_id);
+                if (employee >= 0) {
+                    timelines.place(employee, task, task.getActualStartTime());
+                    auto group_it = employee_group.find(employee);
+                    if (group_it != employee_group.end() &&
+                        find(tracked_groups.begin(), tracked_groups.end(), group_it->second) == tracked_groups.end()) {
+                        tracked_groups.push_back(group_it->second);
+                        work_tracker.addTask(group_it->second, task.getActualStartTime(), task.getActualEndTime(),
+                                             task.isRemoteStand());
+                        break_timeline.addWork(group_it->second, task.getActualStartTime(), task.getActualEndTime());
+                    }
+                } else {
+                    task.addAssignedEmployeeId(employee_id);
+                }
+            }
+            summary.fixed_tasks++;
+        } else if (hasValidTime(task)) {
+            order.push_back(i);
+        }
+    }
+
+    // 改动代价高（开始得早）的任务先落位
+    vector<long> weights(tasks.size(), 0);
+    for (size_t index : order) {
+        weights[index] = changeWeight(tasks[index].getEarliestStartTime(), now);
+    }
+    sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        if (weights[a] != weights[b]) {
+            return weights[a] > weights[b];
+        }
+        if (tasks[a].getEarliestStartTime() != tasks[b].getEarliestStartTime()) {
+            return tasks[a].getEarliestStartTime() < tasks[b].getEarliestStartTime();
+        }
+        return tasks[a].getTaskId() < tasks[b].getTaskId();
+    });
+
+    auto groupFits = [&](int group_index, const LoadTask& task, long start) {
+        const Group& group = groups[group_index];
+        long end = start + task.getDuration();
+        if (!work_tracker.inShift(group_index, start, end) ||
+            !skill_tiers.meetsProficiency(group_index) ||
+            !work_tracker.canWork(group_index, start, end) ||
+            !work_tracker.canWorkRemote(group_index, start, end, task.isRemoteStand()) ||
+            !break_timeline.canWork(group_index, start, end)) {
+            return false;
+        }
+        for (int employee : group.members) {
+            if (!timelines.canPlace(employee, task, start)) {
+                return false;
+            }
+        }
+        return true;
+    };
+    auto placeGroup = [&](int group_index, LoadTask& task, long start) {
+        for (int employee : groups[group_index].members) {
+            timelines.place(employee, task, start);
+        }
+        work_tracker.addTask(group_index, start, start + task.getDuration(), task.isRemoteStand());
+        break_timeline.addWork(group_index, start, start + task.getDuration());
+    };
+
+    // 小组接手任务的改动代价：成员中每个不在参考分配里的人计一次（参考方案中没有的任务代价为0）
+    auto changeCost = [&](const Group& group, size_t index) {
+        auto ref = reference.find(tasks[index].getTaskId());
+        if (ref == reference.end()) {
+            return 0L;
+        }
+        long cost = 0;
+        for (int employee : group.members) {
+            const string& employee_id = employees[employee].getEmployeeId();
+            if (find(ref->second.begin(), ref->second.end(), employee_id) == ref->second.end()) {
+                cost += weights[index];
+            }
+        }
+        return cost;
+    };
+
+    // 1. 热启动：参考方案中仍然可行的小组原样放回
+    vector<size_t> pending;
+    vector<vector<int>> used_groups(tasks.size());
+    for (size_t index : order) {
+        LoadTask& task = tasks[index];
+        long start = task.getEarliestStartTime();
+        int required_groups = (task.getRequiredCount() + GROUP_SIZE - 1) / GROUP_SIZE;
+        task.setActualStartTime(start);
+
+        auto ref = reference.find(task.getTaskId());
+        if (ref != reference.end()) {
+            for (const auto& employee_id : ref->second) {
+                if (static_cast<int>(used_groups[index].size()) >= required_groups) {
+                    break;
+                }
+                int employee = timelines.find(employee_id);
+                auto group_it = employee_group.find(employee);
+                if (group_it == employee_group.end()) {
+                    continue;
+                }
+                int group_index = group_it->second;
+                const Group& group = groups[group_index];
+                // 小组的全部成员都在参考分配中才整组放回
+                bool keep = find(used_groups[index].begin(), used_groups[index].end(), group_index) ==
+                            used_groups[index].end();
+                for (int member : group.members) {
+                    const string& member_id = employees[member].getEmployeeId();
+                    keep = keep && find(ref->second.begin(), ref->second.end(), member_id) != ref->second.end();
+                }
+                if (keep && groupFits(group_index, task, start)) {
+                    placeGroup(group_index, task, start);
+                    used_groups[index].push_back(group_index);
+                }
+            }
+        }
+        if (static_cast<int>(used_groups[index].size()) >= required_groups) {
+            task.setAssigned(true);
+            summary.kept_tasks++;
+        } else {
+            pending.push_back(index);
+        }
+    }
+
+    // 2. 修复：其余任务在可行小组中选改动代价最小的
+    for (size_t index : pending) {
+        LoadTask& task = tasks[index];
+        long start = task.getEarliestStartTime();
+        int required_groups = (task.getRequiredCount() + GROUP_SIZE - 1) / GROUP_SIZE;
+        auto ref = reference.find(task.getTaskId());
+        bool forced = false;
+
+        while (static_cast<int>(used_groups[index].size()) < required_groups) {
+            int best_group = -1;
+            long best_cost = LONG_MAX;
+            long best_overtime = LONG_MAX;
+            long best_travel = LONG_MAX;
+            long best_work = LONG_MAX;
+            for (size_t g = 0; g < groups.size(); ++g) {
+                const vector<int>& used = used_groups[index];
+                if (find(used.begin(), used.end(), static_cast<int>(g)) != used.end() ||
+                    !groupFits(static_cast<int>(g), task, start)) {
+                    continue;
+                }
+                long cost = changeCost(groups[g], index);
+                long overtime = work_tracker.overtime(static_cast<int>(g), start, start + task.getDuration());
+                long travel = 0;
+                long work = 0;
+                for (int employee : groups[g].members) {
+                    travel = max(travel, timelines.travelBefore(employee, task, start));
+                    work += timelines.workTime(employee);
+                }
+                if (cost < best_cost || (cost == best_cost && (overtime < best_overtime ||
+                    (overtime == best_overtime && (travel < best_travel ||
+                    (travel == best_travel && work < best_work)))))) {
+                    best_group = static_cast<int>(g);
+                    best_cost = cost;
+                    best_overtime = overtime;
+                    best_travel = travel;
+                    best_work = work;
+                }
+            }
+            if (best_group < 0) {
+                // 没有可行小组时与LoadScheduler一致强制分配：改动代价最小的小组优先（参考方案本身是
+                // 强制分配时原样保留），其次双机优先级高的小组，再次选最先结束任务的小组
+                long earliest_end = LONG_MAX;
+                int best_priority = INT_MIN;
+                for (size_t g = 0; g < groups.size(); ++g) {
+                    const vector<int>& used = used_groups[index];
+                    if (find(used.begin(), used.end(), static_cast<int>(g)) != used.end() ||
+                        !work_tracker.inShift(static_cast<int>(g), start, start + task.getDuration()) ||
+                        !skill_tiers.meetsProficiency(static_cast<int>(g)) ||
+                        !work_tracker.canDoubleOperate(static_cast<int>(g), start, start + task.getDuration()) ||
+                        !work_tracker.canWork(static_cast<int>(g), start, start + task.getDuration()) ||
+                        !work_tracker.canWorkRemote(static_cast<int>(g), start, start + task.getDuration(),
+                                                    task.isRemoteStand()) ||
+                        break_timeline.hitsLockedBreak(static_cast<int>(g), start, start + task.getDuration())) {
+                        continue;
+                    }
+                    long cost = changeCost(groups[g], index);
+                    long group_end = 0;
+                    for (int employee : groups[g].members) {
+                        group_end = max(group_end, timelines.lastEnd(employee));
+                    }
+                    int priority = skill_tiers.doublePriority(static_cast<int>(g), work_tracker.doubleCount(static_cast<int>(g)) > 0);
+                    if (cost < best_cost || (cost == best_cost && (priority > best_priority ||
+                        (priority == best_priority && group_end < earliest_end)))) {
+                        best_cost = cost;
+                        best_priority = priority;
+                        earliest_end = group_end;
+                        best_group = static_cast<int>(g);
+                    }
+                }
+                if (best_group < 0) {
+                    task.setShortStaffed(true);
+                    break;
+                }
+                forced = true;
+            }
+            placeGroup(best_group, task, start);
+            used_groups[index].push_back(best_group);
+        }
+
+        // 相对参考方案换掉的员工：参考中有、现在没有的人
+        if (ref != reference.end()) {
+            for (const auto& employee_id : ref->second) {
+                if (!task.isAssignedToEmployee(employee_id)) {
+                    summary.changed_staff++;
+                    summary.total_penalty += weights[index];
+                }
+            }
+        }
+        if (!used_groups[index].empty()) {
+            task.setAssigned(true);
+        } else {
+            task.setActualStartTime(0);
+        }
+        if (forced) {
+            summary.forced_tasks++;
+        }
+        if (task.isShortStaffed()) {
+            summary.short_staffed_tasks++;
+        } else {
+            summary.repaired_tasks++;
+        }
+    }
+
+    // 休息的最终位置按员工展开
+    break_timeline.getPlacements(breaks_, break_ids, break_placements_);
+    return summary;
+}
+
+map<string, vector<string>> StableRedispatcher::referenceFromTasks(const vector<LoadTask>& tasks) {
+    map<string, vector<string>> reference;
+    for (const auto& task : tasks) {
+        if (task.isAssigned() && task.getAssignedEmployeeCount() > 0) {
+            reference[task.getTaskId()] = task.getAssignedEmployeeIds();
+        }
+    }
+    return reference;
+}
+
+bool StableRedispatcher::loadReferenceSchedule(const string& filename, map<string, vector<string>>& reference) {
+    reference.clear();
+    AirportStaffScheduler::Output::PlanDiff parser;
+    AirportStaffScheduler::Output::PlanTable plan;
+    if (!parser.addReferscheduleCSV(plan, filename)) {
+        return false;
+    }
+    for (const auto& row : plan.getRows()) {
+        reference[parser.getIds().get(row.task)].push_back(parser.getIds().get(row.staff));
+    }
+    return true;
+}
+
+}  // namespace zhuangxie_class
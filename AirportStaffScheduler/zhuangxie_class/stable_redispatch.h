@@ -0,0 +1,149 @@
+/**
+ * @file stable_redispatch.h
+ * @brief 稳定性优先的装卸重新派工（以参考方案热启动，只修复冲突）
+ *
+ * LoadScheduler的预排方案沿用逻辑只能整组沿用或整体放弃，放弃后从头贪心选组，
+ * 与员工手上已有的方案可能相差很大。这里的目标函数是"改动代价"：任务每换掉一名
+ * 参考方案中的员工计一次代价，代价按任务开始时间的远近加权（马上开始的任务改动
+ * 代价最高，超过horizon之后开始的任务代价最低）。求解分两步：
+ * 1. 热启动：按改动代价从高到低，把参考方案中仍然完整、仍然空闲、路程衔接可行
+ *    且不超过最大连续工作时长的小组原样放回；
+ * 2. 修复：其余任务（参考小组冲突、人员缺勤或参考方案中没有的新任务）按同样顺序
+ *    在可行小组中选改动代价最小的，相同代价时选路程最短、当日工时最少的小组；
+ *    没有可行小组时与LoadScheduler一样强制分配给最先结束任务的小组。
+ *
+ * 员工时间线按开始时间有序保存，可行性检查是一次二分查找加前后两个邻居的比较，
+ * 大部分任务在热启动阶段直接落位，因此比从头派工快。
+ */
+
+#ifndef ZHUANGXIE_CLASS_STABLE_REDISPATCH_H
+#define ZHUANGXIE_CLASS_STABLE_REDISPATCH_H
+
+#include "load_employee_info.h"
+#include "load_task.h"
+#include "group_work_state.h"
+#include "skill_tiers.h"
+#include "../BreakTimeline.h"
+#include <vector>
+#include <string>
+#include <map>
+
+namespace zhuangxie_class {
+
+using namespace std;
+
+/**
+ * @brief 改动代价参数
+ */
+struct StabilityOptions {
+    long now = -1;                 ///< 当前时刻（当天秒数），小于0时取最早任务的开始时间
+    long horizon = 4 * 3600;       ///< 距开始时间超过该时长的任务按最低代价计
+    long near_weight = 100;        ///< 即将开始（或已开始）的任务每换一人的代价
+    long far_weight = 10;          ///< horizon之后开始的任务每换一人的代价
+};
+
+/**
+ * @brief 重新派工结果统计
+ */
+struct RedispatchSummary {
+    int fixed_tasks = 0;           ///< 调用前已分配（锁定）的任务数
+    int kept_tasks = 0;            ///< 参考分配完整保留的任务数
+    int repaired_tasks = 0;        ///< 经修复重新选组的任务数
+    int forced_tasks = 0;          ///< 没有可行小组、强制分配的任务数（含在repaired_tasks中）
+    int short_staffed_tasks = 0;   ///< 小组总数不足的任务数
+    int changed_staff = 0;         ///< 相对参考方案换掉的员工人次
+    long total_penalty = 0;        ///< 改动代价总和
+};
+
+/**
+ * @brief 稳定性优先的重新派工
+ */
+class StableRedispatcher {
+public:
+    /**
+     * @brief 构造函数
+     * @param options 改动代价参数
+     */
+    explicit StableRedispatcher(const StabilityOptions& options = StabilityOptions());
+
+    /**
+     * @brief 析构函数
+     */
+    ~StableRedispatcher();
+
+    /**
+     * @brief 设置连续工作规则（默认不限制，与LoadScheduler::setWorkRules相同）
+     */
+    void setWorkRules(const LoadWorkRules& rules) { work_rules_ = rules; }
+
+    /**
+     * @brief 设置员工班期（默认不限制，与LoadScheduler::setShiftWindows相同）
+     */
+    void setShiftWindows(const vector<StaffShiftWindow>& windows) { shift_windows_ = windows; }
+
+    /**
+     * @brief 设置员工休息（默认没有休息，与LoadScheduler::setBreaks相同）
+     */
+    void setBreaks(const vector<AirportStaffScheduler::Breaks::StaffBreak>& breaks) { breaks_ = breaks; }
+
+    /**
+     * @brief 设置熟练度规则（默认不限制，与LoadScheduler::setSkillRules相同）
+     */
+    void setSkillRules(const LoadSkillRules& rules) { skill_rules_ = rules; }
+
+    /**
+     * @brief 设置员工资质熟练度（默认为空，与LoadScheduler::setSkillLevels相同）
+     */
+    void setSkillLevels(const vector<EmployeeSkill>& levels) { skill_levels_ = levels; }
+
+    /**
+     * @brief 获取最近一次重新派工后每名员工的休息位置（与LoadScheduler::getBreakPlacements相同）
+     */
+    const vector<AirportStaffScheduler::Breaks::BreakPlacement>& getBreakPlacements() const { return break_placements_; }
+
+    /**
+     * @brief 重新派工
+     * @param employees 员工列表（输入输出参数，写入已分配任务ID）
+     * @param tasks 任务列表（输入输出参数；已分配且有员工的任务视为锁定，原样保留）
+     * @param reference 参考方案：任务ID -> 员工ID列表
+     * @param group_name_to_employees 班组名到员工ID列表的映射（与LoadScheduler相同，按3人一组切分）
+     * @return 结果统计
+     */
+    RedispatchSummary redispatch(vector<LoadEmployeeInfo>& employees,
+                                 vector<LoadTask>& tasks,
+                                 const map<string, vector<string>>& reference,
+                                 const map<string, vector<string>>& group_name_to_employees);
+
+    /**
+     * @brief 从调度后的任务列表生成参考方案
+     */
+    static map<string, vector<string>> referenceFromTasks(const vector<LoadTask>& tasks);
+
+    /**
+     * @brief 从referschedule.csv读取参考方案（员工编号为空的任务不计入）
+     * @param filename 文件路径
+     * @param reference 输出参数，参考方案
+     * @return 文件可读且包含任务ID、员工编号列返回true
+     */
+    static bool loadReferenceSchedule(const string& filename, map<string, vector<string>>& reference);
+
+    /**
+     * @brief 任务在当前参数下每换一人的改动代价
+     * @param start_time 任务开始时间
+     * @param now 当前时刻
+     */
+    long changeWeight(long start_time, long now) const;
+
+private:
+    StabilityOptions options_;     ///< 改动代价参数
+    LoadWorkRules work_rules_;     ///< 连续工作规则
+    vector<StaffShiftWindow> shift_windows_;  ///< 员工班期
+    vector<AirportStaffScheduler::Breaks::StaffBreak> breaks_;                ///< 员工休息
+    vector<AirportStaffScheduler::Breaks::BreakPlacement> break_placements_;  ///< 重新派工后的休息位置
+    LoadSkillRules skill_rules_;   ///< 熟练度规则
+    vector<EmployeeSkill> skill_levels_;  ///< 员工资质熟练度
+};
+
+}  // namespace zhuangxie_class
+
+#endif  // ZHUANGXIE_CLASS_STABLE_REDISPATCH_H
@@ -62,6 +62,15 @@ void StandDistance::setTravelTime(int stand1, int stand2, long time) {
     distance_map_[key] = time;
 }
 
+long StandDistance::getMaxTravelTime() const {
+    // 无效机位和未设置的机位对返回默认值，默认值也是可能的路程时间
+    long max_time = DEFAULT_TRAVEL_TIME;
+    for (const auto& pair : distance_map_) {
+        max_time = max(max_time, pair.second);
+    }
+    return max_time;
+}
+
 void StandDistance::initializeDefaultDistances() {
     // 初始化默认距离矩阵
     // 相邻机位：3分钟（180秒）
@@ -43,6 +43,12 @@ public:
      */
     void setTravelTime(int stand1, int stand2, long time);
     
+    /**
+     * @brief 获取任意两个机位之间路程时间的最大值（含未设置时的默认值）
+     * @return 最长路程时间（秒）
+     */
+    long getMaxTravelTime() const;
+    
     /**
      * @brief 初始化默认距离矩阵（可根据实际需求调整）
      */
@@ -8,8 +8,20 @@
 #include "load_scheduler.h"
 #include "load_employee_info.h"
 #include "load_task.h"
+#include "load_model_view.h"
+#include "connect_rule_table.h"
+#include "load_plan_export.h"
+#include "stable_redispatch.h"
+#include "vehicle_pool.h"
+#include "capacity_sweep.h"
+#include "stand_distance.h"
+#include "skill_tiers.h"
 #include "../vip_first_class_algo/shift.h"
 #include "../CSVDataLoader.h"
+#include "../DayModelSnapshot.h"
+#include "../PlanDiff.h"
+#include "../Profiler.h"
+#include "../Logger.h"
 #include <iostream>
 #include <fstream>
 #include <sstream>
@@ -57,108 +69,9 @@ static string formatTime(int64_t seconds) {
     return oss.str();
 }
 
-// 辅助函数：将秒数和任务日期转换为日期时间字符串（YYYY-MM-DD HH:MM:SS格式）
-// 注意：seconds 是从当天00:00:00开始的秒数（parseDateTimeString返回的值）
-// 基准日期：2020-01-01 00:00:00
-static string formatDateTime(int64_t seconds, const string& task_date = "") {
-    if (seconds <= 0) {
-        return "";
-    }
-    
-    // 如果提供了任务日期，使用任务日期作为日期部分
-    if (!task_date.empty()) {
-        // 从任务日期中提取日期部分（YYYY-MM-DD）
-        string date_part = task_date;
-        // 移除可能的引号
-        if (date_part.length() >= 2 && date_part.front() == '"' && date_part.back() == '"') {
-            date_part = date_part.substr(1, date_part.length() - 2);
-        }
-        
-        // seconds 是从当天00:00:00开始的秒数（parseDateTimeString返回的值）
-        // 直接计算时间部分
-        int64_t total_seconds = seconds;
-        
-        // 处理跨天的情况：如果秒数超过一天，需要调整日期
-        int64_t days = total_seconds / 86400;
-        int64_t remaining_seconds = total_seconds % 86400;
-        
-        // 如果跨天了，需要调整日期（简化处理：直接加天数）
-        if (days > 0) {
-            // 解析任务日期
-            size_t dash1 = date_part.find('-');
-            size_t dash2 = date_part.find('-', dash1 + 1);
-            if (dash1 != string::npos && dash2 != string::npos) {
-                int year = stoi(date_part.substr(0, dash1));
-                int month = stoi(date_part.substr(dash1 + 1, dash2 - dash1 - 1));
-                int day = stoi(date_part.substr(dash2 + 1));
-                
-                // 累加天数（简化处理，每月30天）
-                day += static_cast<int>(days);
-                while (day > 30) {
-                    day -= 30;
-                    month++;
-                    if (month > 12) {
-                        month = 1;
-                        year++;
-                    }
-                }
-                
-                ostringstream date_oss;
-                date_oss << year << "-"
-                         << setfill('0') << setw(2) << month << "-"
-                         << setfill('0') << setw(2) << day;
-                date_part = date_oss.str();
-            }
-        }
-        
-        int hours = static_cast<int>(remaining_seconds / 3600);
-        int minutes = static_cast<int>((remaining_seconds % 3600) / 60);
-        int secs = static_cast<int>(remaining_seconds % 60);
-        
-        ostringstream oss;
-        oss << date_part << " "
-            << setfill('0') << setw(2) << hours << ":"
-            << setfill('0') << setw(2) << minutes << ":"
-            << setfill('0') << setw(2) << secs;
-        return oss.str();
-    }
-    
-    // 如果没有提供任务日期，使用基准日期计算
-    int64_t days = seconds / 86400;
-    int64_t remaining_seconds = seconds % 86400;
-    
-    // 使用基准日期2020-01-01
-    int year = 2020;
-    int month = 1;
-    int day = 1;
-    
-    // 累加天数（简化处理，每月30天）
-    day += days;
-    while (day > 30) {
-        day -= 30;
-        month++;
-        if (month > 12) {
-            month = 1;
-            year++;
-        }
-    }
-    
-    int hours = remaining_seconds / 3600;
-    int minutes = (remaining_seconds % 3600) / 60;
-    int secs = remaining_seconds % 60;
-    
-    ostringstream oss;
-    oss << year << "-" 
-        << setfill('0') << setw(2) << month << "-"
-        << setfill('0') << setw(2) << day << " "
-        << setfill('0') << setw(2) << hours << ":"
-        << setfill('0') << setw(2) << minutes << ":"
-        << setfill('0') << setw(2) << secs;
-    return oss.str();
-}
-
 // 辅助函数：导出任务分配结果到CSV文件
 static void exportToCSV(const vector<LoadTask>& tasks, const string& filename) {
+    PROFILE_SCOPE_DETAIL("output.write", filename);
     ofstream file(filename);
     if (!file.is_open()) {
         cerr << "错误：无法创建CSV文件 " << filename << endl;
@@ -202,180 +115,282 @@ static void exportToCSV(const vector<LoadTask>& tasks, const string& filename) {
 static void exportEmployeeScheduleToCSV(const vector<LoadTask>& tasks,
                                        const vector<LoadEmployeeInfo>& employees,
                                        const vector<vip_first_class::Shift>& shifts,
-                                       const string& filename) {
-    // 尝试以二进制模式打开文件，避免Windows下的换行符问题
-    ofstream file(filename, ios::out | ios::trunc);
-    if (!file.is_open()) {
-        cerr << "错误：无法创建CSV文件 " << filename << endl;
+                                       const string& filename,
+                                       const VehiclePool* vehicles,
+                                       const vector<AirportStaffScheduler::Breaks::BreakPlacement>* breaks) {
+    PROFILE_SCOPE_DETAIL("output.write", filename);
+    if (!exportLoadPlan(tasks, employees, filename, vehicles, breaks)) {
+        cerr << "错误：无法写入CSV文件 " << filename << endl;
         cerr << "请检查文件路径和权限" << endl;
         return;
     }
-    
-    // 写入CSV表头（按照soln_shift.csv格式）
-    file << "班期日期,班期开始时间,班期结束时间,人员编号,人员姓名,车辆（车牌号）,车辆类型,任务ID,任务名称,任务日期,任务开始时间,任务结束时间,到达航班ID,出发航班ID,到达航班号,出发航班号,航站楼,区域,机位,其他位置,双机航班号,是否加班\n";
-    
-    // 创建任务ID到任务的映射
-    map<string, const LoadTask*> task_map;
-    for (const auto& task : tasks) {
-        task_map[task.getTaskId()] = &task;
+    cout << "员工任务时间表已导出到: " << filename << endl;
+}
+
+// 自检用的小组：班组名group_name，组员为prefix1 ~ prefix3
+static void addCheckCrew(const string& group_name, const string& prefix,
+                         vector<LoadEmployeeInfo>& employees, map<string, vector<string>>& group_name_to_employees) {
+    for (int pos = 1; pos <= 3; ++pos) {
+        LoadEmployeeInfo emp;
+        emp.setEmployeeId(prefix + to_string(pos));
+        emp.setEmployeeName(group_name + "-" + to_string(pos));
+        emp.setQualificationMask(15);  // 所有资质
+        employees.push_back(emp);
+        group_name_to_employees[group_name].push_back(emp.getEmployeeId());
     }
-    
-    // 遍历所有员工
-    for (const auto& emp : employees) {
-        const auto& assigned_task_ids = emp.getEmployeeInfo().getAssignedTaskIds();
-        
-        if (assigned_task_ids.empty()) {
-            // 如果没有分配任务（休息），不输出或输出空行
-            // 根据用户要求：如果是休息就不输出
-            continue;
+}
+
+// 自检用的任务：固定在[start, start + duration)，需要一个小组
+static LoadTask makeCheckTask(const string& task_id, int64_t start, long duration) {
+    LoadTask task;
+    task.setTaskId(task_id);
+    task.setTaskName(task_id);
+    task.setEarliestStartTime(start);
+    task.setLatestEndTime(start + duration);
+    task.setDuration(duration);
+    task.setRequiredCount(3);
+    return task;
+}
+
+// 自检：连续工作规则下blocked_task不能派给唯一的小组（正常派工和强制分配都不行），
+// 其余任务都派给该小组；LoadScheduler和StableRedispatcher（没有参考方案）各跑一遍
+static bool checkWorkRuleCase(const string& prefix, const LoadWorkRules& rules,
+                              const vector<LoadTask>& tasks, const string& blocked_task) {
+    vector<LoadEmployeeInfo> employees;
+    map<string, vector<string>> group_name_to_employees;
+    addCheckCrew("9.1", prefix, employees, group_name_to_employees);
+
+    bool ok = true;
+    for (int pass = 0; pass < 2; ++pass) {
+        vector<LoadTask> result = tasks;
+        vector<LoadEmployeeInfo> staff = employees;
+        if (pass == 0) {
+            LoadScheduler scheduler;
+            scheduler.setWorkRules(rules);
+            scheduler.scheduleLoadTasks(staff, result, vector<vip_first_class::Shift>(),
+                                        vector<LoadScheduler::ShiftBlockPeriod>(), nullptr, &group_name_to_employees);
+        } else {
+            StableRedispatcher redispatcher;
+            redispatcher.setWorkRules(rules);
+            redispatcher.redispatch(staff, result, map<string, vector<string>>(), group_name_to_employees);
         }
-        
-            // 按任务开始时间排序
-        vector<pair<string, long>> task_times;  // {task_id, start_time}
-        for (const string& task_id : assigned_task_ids) {
-                auto it = task_map.find(task_id);
-                if (it != task_map.end() && it->second != nullptr) {
-                long start_time = it->second->getActualStartTime();
-                if (start_time > 0) {
-                    task_times.push_back({task_id, start_time});
-                }
+        for (const auto& task : result) {
+            bool on_crew = task.getAssignedEmployeeCount() > 0;
+            if (task.getTaskId() == blocked_task ? on_crew : !on_crew) {
+                cerr << "ERROR: " << (pass == 0 ? "派工" : "稳定重新派工") << "自检任务分配不符合预期: "
+                     << task.getTaskId() << endl;
+                ok = false;
             }
         }
-        
-        if (task_times.empty()) {
-            continue;
-            }
-            
-            sort(task_times.begin(), task_times.end(), 
-             [](const pair<string, long>& a, const pair<string, long>& b) {
-                     return a.second < b.second;
-                 });
-            
-        // 计算班期开始时间和结束时间
-        long shift_start_time = task_times.front().second;  // 第一个任务的开始时间
-        long shift_end_time = 0;
-        
-        // 遍历所有任务，找到最晚的结束时间（确保是那个人最晚的任务的结束时间）
-        for (const auto& task_time : task_times) {
-            auto it = task_map.find(task_time.first);
-            if (it != task_map.end() && it->second != nullptr) {
-                long end_time = it->second->getActualEndTime();
-                // 如果实际结束时间为0，尝试使用实际开始时间 + 时长
-                if (end_time == 0) {
-                    long actual_start = it->second->getActualStartTime();
-                    long duration = it->second->getDuration();
-                    if (actual_start > 0 && duration > 0) {
-                        end_time = actual_start + duration;
-                    }
-                }
-                // 更新最晚的结束时间
-                if (end_time > shift_end_time) {
-                    shift_end_time = end_time;
-                }
-            }
+    }
+    return ok;
+}
+
+// 自检：最大连续工作时长2小时，09:00-11:00之后10:30-12:30的任务会连成3.5小时，强制分配也不能派
+static bool checkContinuousWork() {
+    LoadWorkRules rules;
+    rules.max_continuous_work = 2 * 3600;
+    vector<LoadTask> tasks;
+    tasks.push_back(makeCheckTask("work_check_a", parseTimeString("09:00"), 2 * 3600));
+    tasks.push_back(makeCheckTask("work_check_b", parseTimeString("10:30"), 2 * 3600));
+    return checkWorkRuleCase("work_check_", rules, tasks, "work_check_b");
+}
+
+// 自检：最大连续远机位任务个数为1，首尾相接的两个远机位任务（间隔短于远机位最小间隔）不能派给同一小组
+static bool checkRemoteStreak() {
+    LoadWorkRules rules;
+    rules.max_remote_streak = 1;
+    rules.min_remote_rest = 30 * 60;
+    vector<LoadTask> tasks;
+    tasks.push_back(makeCheckTask("remote_check_a", parseTimeString("09:00"), 3600));
+    tasks.push_back(makeCheckTask("remote_check_b", parseTimeString("10:00"), 3600));
+    for (auto& task : tasks) {
+        task.setRemoteStand(true);
+    }
+    return checkWorkRuleCase("remote_check_", rules, tasks, "remote_check_b");
+}
+
+// 自检：任务占用用餐时挪到下一个空档，锁定休息即使强制分配也不占用
+static bool checkMealRelocation() {
+    vector<LoadEmployeeInfo> employees;
+    map<string, vector<string>> group_name_to_employees;
+    addCheckCrew("9.1", "meal_check_", employees, group_name_to_employees);
+
+    // 10:00-11:00的任务压住10:45-11:15的用餐，11:00-11:30是锁定休息，
+    // 浮动窗口内只有锁定休息之后的11:30能放下用餐；11:00的任务只能落在锁定休息上
+    vector<LoadTask> tasks;
+    tasks.push_back(makeCheckTask("meal_check_work", parseTimeString("10:00"), 3600));
+    tasks.push_back(makeCheckTask("meal_check_locked", parseTimeString("11:00"), 1800));
+    vector<AirportStaffScheduler::Breaks::StaffBreak> breaks;
+    for (const auto& emp : employees) {
+        AirportStaffScheduler::Breaks::StaffBreak rest;
+        rest.staff_id = emp.getEmployeeId();
+        rest.name = "休息";
+        rest.start = parseTimeString("11:00");
+        rest.end = parseTimeString("11:30");
+        rest.locked = true;
+        breaks.push_back(rest);
+        AirportStaffScheduler::Breaks::StaffBreak meal = rest;
+        meal.name = "吃饭";
+        meal.start = parseTimeString("10:45");
+        meal.end = parseTimeString("11:15");
+        meal.locked = false;
+        breaks.push_back(meal);
+    }
+
+    LoadScheduler scheduler;
+    scheduler.setBreaks(breaks);
+    scheduler.scheduleLoadTasks(employees, tasks, vector<vip_first_class::Shift>(),
+                                vector<LoadScheduler::ShiftBlockPeriod>(), nullptr, &group_name_to_employees);
+
+    bool ok = true;
+    for (const auto& task : tasks) {
+        bool on_crew = task.getAssignedEmployeeCount() > 0;
+        if (task.getTaskId() == "meal_check_work" ? !on_crew : on_crew) {
+            cerr << "ERROR: 用餐自检任务分配不符合预期: " << task.getTaskId() << endl;
+            ok = false;
         }
-        
-        // 获取第一个任务的日期（用于班期日期）
-        string first_task_date = "";
-        auto first_task_it = task_map.find(task_times.front().first);
-        if (first_task_it != task_map.end() && first_task_it->second != nullptr) {
-            first_task_date = first_task_it->second->getTaskDate();
+    }
+    const auto& placements = scheduler.getBreakPlacements();
+    for (size_t i = 0; i < placements.size(); ++i) {
+        long expected = breaks[i].locked ? parseTimeString("11:00") : parseTimeString("11:30");
+        if (placements[i].start != expected || placements[i].conflict) {
+            cerr << "ERROR: 用餐自检休息位置不符合预期: " << placements[i].staff_id << " " << placements[i].name
+                 << " " << formatTime(placements[i].start) << endl;
+            ok = false;
         }
-        
-            // 输出每个任务
-            for (const auto& task_time : task_times) {
-            const string& task_id = task_time.first;
-                auto it = task_map.find(task_id);
-                if (it != task_map.end() && it->second != nullptr) {
-                const LoadTask& task = *(it->second);
-                
-                // 班期日期（使用第一个任务的日期）
-                file << "\"" << first_task_date << "\",";
-                
-                // 班期开始时间（第一个任务的开始时间）
-                string shift_start_str = formatDateTime(shift_start_time, first_task_date);
-                file << "\"" << shift_start_str << "\",";
-                
-                // 班期结束时间（最后一个任务的结束时间）
-                string shift_end_str = formatDateTime(shift_end_time, first_task_date);
-                file << "\"" << shift_end_str << "\",";
-                
-                // 人员编号
-                file << "\"" << emp.getEmployeeId() << "\",";
-                
-                // 人员姓名
-                file << "\"" << emp.getEmployeeName() << "\",";
-                
-                // 车辆（车牌号）- 不输出
-                file << "\"\",";
-                
-                // 车辆类型 - 不输出
-                file << "\"\",";
-                
-                // 任务ID
-                file << "\"" << task.getTaskId() << "\",";
-                
-                // 任务名称
-                file << "\"" << task.getTaskName() << "\",";
-                
-                // 任务日期
-                file << "\"" << task.getTaskDate() << "\",";
-                
-                // 任务开始时间（实际开始时间）
-                string task_start_str = formatDateTime(task.getActualStartTime(), task.getTaskDate());
-                file << "\"" << task_start_str << "\",";
-                
-                // 任务结束时间（实际开始时间 + 时长）
-                string task_end_str = formatDateTime(task.getActualEndTime(), task.getTaskDate());
-                file << "\"" << task_end_str << "\",";
-                
-                // 到达航班ID（如果无就不输出）
-                string arrival_flight_id = task.getArrivalFlightId();
-                file << "\"" << (arrival_flight_id.empty() ? "" : arrival_flight_id) << "\",";
-                
-                // 出发航班ID（如果无就不输出）
-                string departure_flight_id = task.getDepartureFlightId();
-                file << "\"" << (departure_flight_id.empty() ? "" : departure_flight_id) << "\",";
-                
-                // 到达航班号（如果无就不输出）
-                string arrival_flight_number = task.getArrivalFlightNumber();
-                file << "\"" << (arrival_flight_number.empty() ? "" : arrival_flight_number) << "\",";
-                
-                // 出发航班号（如果无就不输出）
-                string departure_flight_number = task.getDepartureFlightNumber();
-                file << "\"" << (departure_flight_number.empty() ? "" : departure_flight_number) << "\",";
-                
-                // 航站楼（如果无就不输出）
-                string terminal = task.getTerminal();
-                file << "\"" << (terminal.empty() ? "" : terminal) << "\",";
-                
-                // 区域 - 不输出
-                file << "\"\",";
-                
-                // 机位（如果无就不输出）
-                int stand = task.getStand();
-                if (stand > 0) {
-                    file << "\"" << stand << "\",";
-                } else {
-                    file << "\"\",";
-                }
-                
-                // 其他位置 - 不输出
-                file << "\"\",";
-                
-                // 双机航班号 - 不输出
-                file << "\"\",";
-                
-                // 是否加班 - 全部都是否
-                file << "\"否\",";
-                
-                file << "\n";
+    }
+    return ok && placements.size() == breaks.size();
+}
+
+// 自检：达不到熟练度限制的小组不参与派工（强制分配也不选），双机优先级按全员具备的资质编译
+static bool checkProficiencyLimit() {
+    vector<LoadEmployeeInfo> employees;
+    map<string, vector<string>> group_name_to_employees;
+    addCheckCrew("9.1", "skill_check_junior_", employees, group_name_to_employees);
+    addCheckCrew("9.2", "skill_check_senior_", employees, group_name_to_employees);
+
+    // parameter.csv的航班人员资质熟练度限制："装卸资质:3:2"表示装卸资质至少2人达到3级
+    // （只写"3"时资质为装卸资质、人数为1）
+    AirportStaffScheduler::Model::DayModel model;
+    model.rules.parameters["航班人员资质熟练度限制"] = "装卸资质:3:2";
+    LoadSkillRules skill_rules;
+    LoadModelView(model).buildSkillRules(skill_rules);
+    QualificationPriority priority;  // skill.csv的一行
+    priority.qualification = "行李车资质";
+    priority.double_priority = 5;
+    priority.continuous_double_priority = 2;
+    skill_rules.priorities.push_back(priority);
+
+    // 9.1组全员1级；9.2组两人3级，且全员有行李车资质
+    vector<EmployeeSkill> skill_levels;
+    for (const auto& emp : employees) {
+        bool senior = emp.getEmployeeId().find("senior") != string::npos;
+        EmployeeSkill level;
+        level.employee_id = emp.getEmployeeId();
+        level.qualification = "装卸资质";
+        level.level = senior && emp.getEmployeeId().back() != '3' ? 3 : 1;
+        skill_levels.push_back(level);
+        if (senior) {
+            level.qualification = priority.qualification;
+            level.level = 1;
+            skill_levels.push_back(level);
+        }
+    }
+
+    // 两个同时进行的任务：第一个只能派给9.2组；第二个时9.2组已占用，强制分配也不选熟练度不够的9.1组
+    vector<LoadTask> tasks;
+    tasks.push_back(makeCheckTask("skill_check_1", parseTimeString("09:00"), 3600));
+    tasks.push_back(makeCheckTask("skill_check_2", parseTimeString("09:00"), 3600));
+    LoadScheduler scheduler;
+    scheduler.setSkillRules(skill_rules);
+    scheduler.setSkillLevels(skill_levels);
+    scheduler.scheduleLoadTasks(employees, tasks, vector<vip_first_class::Shift>(),
+                                vector<LoadScheduler::ShiftBlockPeriod>(), nullptr, &group_name_to_employees);
+
+    bool ok = skill_rules.min_level == 3 && skill_rules.min_members == 2;
+    for (const auto& task : tasks) {
+        for (const auto& emp_id : task.getAssignedEmployeeIds()) {
+            if (emp_id.find("junior") != string::npos) {
+                cerr << "ERROR: 熟练度自检任务派给了未达到熟练度限制的小组: " << task.getTaskId() << endl;
+                ok = false;
+                break;
             }
         }
+        if (task.getTaskId() == "skill_check_1" && task.getAssignedEmployeeCount() == 0) {
+            cerr << "ERROR: 熟练度自检任务未分配: " << task.getTaskId() << endl;
+            ok = false;
+        }
     }
-    
-    file.close();
-    cout << "员工任务时间表已导出到: " << filename << endl;
+    if (scheduler.getAssignmentTrace().getRejectTotal(RejectReason::PROFICIENCY) == 0) {
+        cerr << "ERROR: 熟练度自检没有记录熟练度不足的小组" << endl;
+        ok = false;
+    }
+
+    vector<int> member_keys;
+    for (const auto& g_pair : group_name_to_employees) {
+        for (const auto& emp_id : g_pair.second) {
+            member_keys.push_back(AirportStaffScheduler::Ids::IdRegistry::intern(emp_id));
+        }
+    }
+    SkillTiers skill_tiers(skill_rules);
+    skill_tiers.build(AirportStaffScheduler::Ids::IdNames(member_keys.data(), member_keys.data() + member_keys.size()),
+                      3, skill_levels);
+    if (skill_tiers.meetsProficiency(0) || !skill_tiers.meetsProficiency(1) ||
+        skill_tiers.doublePriority(0, false) != 0 || skill_tiers.doublePriority(1, false) != 5 ||
+        skill_tiers.doublePriority(1, true) != 2) {
+        cerr << "ERROR: 熟练度自检小组分层不符合预期" << endl;
+        ok = false;
+    }
+    return ok;
+}
+
+// 自检：邻近的车辆都来不及时，按机位间最长路程时间跳到一定来得及的车辆
+static bool checkVehicleReposition() {
+    // 1号到24号机位改为20分钟（超过默认矩阵的最长12分钟），自检结束后恢复
+    StandDistance& distance = StandDistance::getInstance();
+    long saved_travel = distance.getTravelTime(1, 24);
+    distance.setTravelTime(1, 24, 20 * 60);
+
+    // 10辆车先在24号机位各跑一个任务：第1个任务的车07:35空闲，第2个07:46空闲，其余8个07:50之后空闲；
+    // 08:00在1号机位的任务只有第1个任务的车来得及（其余都晚于07:40空闲）
+    vector<LoadVehicle> vehicles;
+    vector<LoadTask> tasks;
+    const long ends[] = {35, 46, 50, 51, 52, 53, 54, 55, 56, 57};
+    for (int i = 0; i < 10; ++i) {
+        LoadVehicle vehicle;
+        vehicle.plate = "vehicle_check_" + to_string(i);
+        vehicle.vehicle_type = "行李牵引车";
+        vehicles.push_back(vehicle);
+        // 07:0i开始，07:ends[i]结束
+        LoadTask task = makeCheckTask("vehicle_check_" + to_string(i), parseTimeString("07:00") + i * 60,
+                                      (ends[i] - i) * 60);
+        task.setActualStartTime(task.getEarliestStartTime());
+        task.setStand(24);
+        task.setRequiredVehicleType("行李牵引车");
+        task.addAssignedEmployeeId("vehicle_check_crew_" + to_string(i));
+        tasks.push_back(task);
+    }
+    LoadTask task = makeCheckTask("vehicle_check_far", parseTimeString("08:00"), 1800);
+    task.setActualStartTime(task.getEarliestStartTime());
+    task.setStand(1);
+    task.setRequiredVehicleType("行李牵引车");
+    task.addAssignedEmployeeId("vehicle_check_crew_far");
+    tasks.push_back(task);
+
+    VehicleRules rules;
+    rules.follow_crew = false;
+    VehiclePool pool(rules);
+    pool.setVehicles(vehicles);
+    VehicleSummary summary = pool.assignVehicles(tasks);
+    distance.setTravelTime(1, 24, saved_travel);
+
+    const LoadVehicle* vehicle = pool.getTaskVehicle("vehicle_check_far");
+    if (summary.missing_tasks != 0 || vehicle == nullptr || vehicle != pool.getTaskVehicle("vehicle_check_0")) {
+        cerr << "ERROR: 派车自检不符合预期：" << (vehicle == nullptr ? "没有派到车辆" : vehicle->plate) << endl;
+        return false;
+    }
+    return true;
 }
 
 int main(int argc, char* argv[]) {
@@ -387,10 +402,16 @@ int main(int argc, char* argv[]) {
     cout << "Starting load scheduler test..." << endl;
     cout.flush();
     
-    // 确定CSV文件路径
+    // 确定CSV文件路径（--stable：以referschedule.csv为参考方案做稳定性优先的重新派工）
     std::string input_dir = "../input/";
-    if (argc > 1) {
-        input_dir = argv[1];
+    bool stable_mode = false;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--stable") {
+            stable_mode = true;
+            continue;
+        }
+        input_dir = arg;
         if (input_dir.back() != '/' && input_dir.back() != '\\') {
             input_dir += "/";
         }
@@ -400,6 +421,25 @@ int main(int argc, char* argv[]) {
     std::string shift_csv = input_dir + "shift.csv";
     std::string task_csv = input_dir + "task.csv";
     
+    // 0. 加载单日模型（每个输入文件只读取一次；输入未变化时直接读取上次写下的二进制快照）
+    AirportStaffScheduler::Model::DayModel model;
+    bool model_loaded = AirportStaffScheduler::Model::loadDayModelCached(input_dir, model);
+    LoadModelView model_view(model);
+    if (model_loaded) {
+        int rule_count = model_view.buildConnectRules(ConnectRuleTable::getInstance());
+        cout << "Loaded " << rule_count << " connect rules" << endl;
+    }
+    LoadWorkRules work_rules;
+    model_view.buildWorkRules(work_rules);
+    vector<StaffShiftWindow> shift_windows;
+    model_view.buildShiftWindows(shift_windows);
+    vector<AirportStaffScheduler::Breaks::StaffBreak> breaks;
+    model_view.buildBreaks(breaks);
+    LoadSkillRules skill_rules;
+    model_view.buildSkillRules(skill_rules);
+    vector<EmployeeSkill> skill_levels;
+    model_view.buildSkillLevels(skill_levels);
+    
     // 1. 从shift.csv加载班次列表和员工信息
     cout << "Step 1: Loading shifts and employees from CSV..." << endl;
     cout << "CSV file path: " << shift_csv << endl;
@@ -410,14 +450,16 @@ int main(int argc, char* argv[]) {
     map<string, vector<string>> group_name_to_employees;
     
     try {
-        shifts = AirportStaffScheduler::CSVLoader::loadShiftsFromCSV(shift_csv);
+        if (!model_loaded) {
+            throw std::runtime_error("Failed to load day model");
+        }
+        model_view.buildShifts(shifts);
         if (shifts.empty()) {
             throw std::runtime_error("CSV file contains no valid shift data");
         }
         
-        // 从shift.csv中读取员工信息和班组信息
-        bool success = AirportStaffScheduler::CSVLoader::loadEmployeesFromShiftCSV(
-            shift_csv, employees, group_name_to_employees);
+        // 从模型中读取员工信息和班组信息
+        bool success = model_view.buildEmployees(employees, group_name_to_employees);
         if (!success || employees.empty()) {
             throw std::runtime_error("Failed to load employees from shift.csv");
         }
@@ -475,9 +517,8 @@ int main(int argc, char* argv[]) {
     cout.flush();
     
     vector<LoadTask> tasks;
-    std::string stand_pos_csv = input_dir + "stand_pos.csv";
     try {
-        bool success = AirportStaffScheduler::CSVLoader::loadLoadTasksFromCSV(task_csv, tasks, stand_pos_csv);
+        bool success = model_loaded && model_view.buildTasks(tasks);
         if (!success || tasks.empty()) {
             throw std::runtime_error("CSV file contains no valid task data");
         }
@@ -490,7 +531,20 @@ int main(int argc, char* argv[]) {
     
     cout << "Total tasks: " << tasks.size() << endl;
     cout.flush();
-    
+
+    // 派工前预判：每15分钟的需求峰值与在班小组数，列出人手不足的时段
+    CapacitySweep capacity_sweep;
+    capacity_sweep.analyze(tasks, group_name_to_employees, shift_windows);
+    cout << "Capacity forecast: peak demand " << capacity_sweep.getPeakDemand() << " groups, "
+         << capacity_sweep.getGroupCount() << " groups on roster, "
+         << capacity_sweep.getShortfalls().size() << " short windows" << endl;
+    for (const auto& window : capacity_sweep.getShortfalls()) {
+        cout << "  " << formatTime(window.start) << "-" << formatTime(window.end)
+             << ": peak demand " << window.peak_demand << ", short " << window.max_shortfall << " groups" << endl;
+    }
+    capacity_sweep.exportCurve("capacity_curve.csv");
+    AirportStaffScheduler::Logging::flush();
+
     // 4. 创建班次占位时间段（疲劳度控制测试）
     vector<LoadScheduler::ShiftBlockPeriod> block_periods;
     LoadScheduler::ShiftBlockPeriod block1;
@@ -507,7 +561,37 @@ int main(int argc, char* argv[]) {
     cout.flush();
     
     LoadScheduler scheduler;
-    scheduler.scheduleLoadTasks(employees, tasks, shifts, block_periods, nullptr, &group_name_to_employees);
+    scheduler.setWorkRules(work_rules);
+    scheduler.setShiftWindows(shift_windows);
+    scheduler.setBreaks(breaks);
+    scheduler.setSkillRules(skill_rules);
+    scheduler.setSkillLevels(skill_levels);
+    vector<AirportStaffScheduler::Breaks::BreakPlacement> break_placements;
+    if (stable_mode) {
+        map<string, vector<string>> reference;
+        if (!StableRedispatcher::loadReferenceSchedule(input_dir + "referschedule.csv", reference)) {
+            cerr << "WARNING: Failed to read referschedule.csv, re-dispatching without reference" << endl;
+        }
+        StableRedispatcher redispatcher;
+        redispatcher.setWorkRules(work_rules);
+        redispatcher.setShiftWindows(shift_windows);
+        redispatcher.setBreaks(breaks);
+        redispatcher.setSkillRules(skill_rules);
+        redispatcher.setSkillLevels(skill_levels);
+        RedispatchSummary summary = redispatcher.redispatch(employees, tasks, reference, group_name_to_employees);
+        break_placements = redispatcher.getBreakPlacements();
+        cout << "Stable re-dispatch: " << reference.size() << " reference tasks, kept " << summary.kept_tasks
+             << ", repaired " << summary.repaired_tasks << " (forced " << summary.forced_tasks
+             << "), short-staffed " << summary.short_staffed_tasks
+             << ", changed staff " << summary.changed_staff << ", penalty " << summary.total_penalty << endl;
+    } else {
+        scheduler.scheduleLoadTasks(employees, tasks, shifts, block_periods, nullptr, &group_name_to_employees);
+        break_placements = scheduler.getBreakPlacements();
+    }
+    AirportStaffScheduler::Logging::flush();
+    if (model_loaded) {
+        model_view.commitAssignments(tasks);
+    }
     
     // 6. 输出统计信息
     int total_tasks = tasks.size();
@@ -540,15 +624,109 @@ int main(int argc, char* argv[]) {
     cout << "Assignment rate: " << (total_required > 0 ? (total_assigned * 100.0 / total_required) : 0) << "%" << endl;
     cout.flush();
     
+    // 派车（有vehicle.csv时，按时间顺序给需要车辆的任务派车，车辆优先跟随小组）
+    vector<LoadVehicle> vehicles;
+    model_view.buildVehicles(vehicles);
+    VehicleRules vehicle_rules;
+    model_view.buildVehicleRules(vehicle_rules);
+    VehiclePool vehicle_pool(vehicle_rules);
+    if (!vehicles.empty()) {
+        vehicle_pool.setVehicles(vehicles);
+        VehicleSummary vehicle_summary = vehicle_pool.assignVehicles(tasks);
+        cout << "Vehicles: " << vehicles.size() << " in pool, " << vehicle_summary.used_vehicles << " used; "
+             << vehicle_summary.assigned_tasks << "/" << vehicle_summary.required_tasks << " tasks assigned ("
+             << vehicle_summary.followed_tasks << " followed crew), " << vehicle_summary.missing_tasks
+             << " without vehicle" << endl;
+    }
+    
+    // 休息（有break.csv时）：未锁定的用餐随派工挪到空档
+    if (!break_placements.empty()) {
+        int moved = 0;
+        int conflicts = 0;
+        for (size_t i = 0; i < break_placements.size(); ++i) {
+            if (break_placements[i].start != breaks[i].start) {
+                moved++;
+            }
+            if (break_placements[i].conflict) {
+                conflicts++;
+            }
+        }
+        cout << "Breaks: " << break_placements.size() << " rows, " << moved << " meals moved, "
+             << conflicts << " overlapping tasks" << endl;
+    }
+    
     // 7. 导出结果到CSV（只输出一个文件，格式与soln_shift.csv一致）
     cout << "\nStep 5: Exporting results to CSV file..." << endl;
     cout.flush();
     
-    exportEmployeeScheduleToCSV(tasks, employees, shifts, "result.csv");
+    exportEmployeeScheduleToCSV(tasks, employees, shifts, "result.csv", vehicles.empty() ? nullptr : &vehicle_pool,
+                                break_placements.empty() ? nullptr : &break_placements);
+    
+    // 7. 与预排方案（referschedule.csv）的差异，供手持终端只下发变化
+    AirportStaffScheduler::Output::PlanDiff plan_diff;
+    AirportStaffScheduler::Output::PlanTable reference_plan;
+    AirportStaffScheduler::Output::PlanTable new_plan;
+    bool has_diff = plan_diff.addReferscheduleCSV(reference_plan, input_dir + "referschedule.csv");
+    if (has_diff) {
+        plan_diff.addTasks(new_plan, tasks);
+        plan_diff.compare(reference_plan, new_plan);
+        has_diff = plan_diff.writeCompact("plan_diff.csv");
+    }
+    if (has_diff) {
+        using AirportStaffScheduler::Output::PlanChangeKind;
+        cout << "Plan diff vs referschedule.csv: +" << plan_diff.count(PlanChangeKind::ADDED)
+             << " -" << plan_diff.count(PlanChangeKind::REMOVED)
+             << " ~" << plan_diff.count(PlanChangeKind::RETIMED)
+             << " >" << plan_diff.count(PlanChangeKind::REASSIGNED)
+             << ", " << plan_diff.getAffectedStaff().size() << " staff affected" << endl;
+    }
+    
+    // 8. 派工解释记录（用assignment_trace_decoder解码）
+    if (scheduler.getAssignmentTrace().writeToFile("load_assignment_trace.bin", tasks)) {
+        cout << "\n=== Group Rejection Summary ===" << endl;
+        AssignmentTrace::printTotals(scheduler.getAssignmentTrace().getTotals(), cout);
+    }
+    
+    // 9. 休息、熟练度、派车、连续工作和连续远机位自检（input/break.csv、skill.csv没有数据行，没有vehicle.csv，
+    //    parameter.csv也没有设置连续工作和连续远机位限制，用内置的小例子验证）
+    if (!checkMealRelocation()) {
+        return 1;
+    }
+    cout << "Break check: meal moved past the locked break, locked break kept free" << endl;
+    if (!checkProficiencyLimit()) {
+        return 1;
+    }
+    cout << "Skill check: crew below the proficiency limit rejected" << endl;
+    if (!checkVehicleReposition()) {
+        return 1;
+    }
+    cout << "Vehicle check: reposition bound follows the longest stand-to-stand travel time" << endl;
+    if (!checkContinuousWork()) {
+        return 1;
+    }
+    cout << "Work check: forced assignment keeps the continuous work limit" << endl;
+    if (!checkRemoteStreak()) {
+        return 1;
+    }
+    cout << "Remote check: forced assignment keeps the remote stand streak limit" << endl;
     
+    AirportStaffScheduler::Logging::flush();
     cout << "\n=== Test Completed Successfully ===" << endl;
     cout << "Generated file:" << endl;
     cout << "  result.csv - Employee schedule (soln_shift.csv format)" << endl;
+    cout << "  capacity_curve.csv - Pre-dispatch demand vs. on-duty groups per 15 minutes" << endl;
+    if (has_diff) {
+        cout << "  plan_diff.csv - Changes against referschedule.csv (added/removed/retimed/reassigned)" << endl;
+    }
+    cout << "  load_assignment_trace.bin - Per-task assignment trace (decode with assignment_trace_decoder)" << endl;
+    
+    // 10. 性能剖析结果（以-DAIRPORT_SCHEDULER_PROFILING编译时）
+    if (AirportStaffScheduler::Profiling::isEnabled()) {
+        AirportStaffScheduler::Profiling::writeChromeTrace("load_profile_trace.json");
+        cout << "  load_profile_trace.json - Phase timings (Chrome trace format)" << endl;
+        cout << "\n=== Phase Timings ===" << endl;
+        AirportStaffScheduler::Profiling::printSummary(cout);
+    }
     cout.flush();
     
     return 0;
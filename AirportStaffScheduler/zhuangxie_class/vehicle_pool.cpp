@@ -0,0 +1,184 @@
+/**
+ * @file vehicle_pool.cpp
+ * @brief 装卸车辆池实现
+ */
+
+#include "vehicle_pool.h"
+#include "stand_distance.h"
+#include <algorithm>
+#include <climits>
+
+namespace zhuangxie_class {
+
+using namespace std;
+
+namespace {
+
+const long NEVER_USED = LONG_MIN / 2;  ///< 还没出车的车辆的空闲时刻
+const int PROBE_LIMIT = 8;             ///< 最佳适配时向前检查的车辆数上限
+
+}  // namespace
+
+VehiclePool::VehiclePool(const VehicleRules& rules)
+    : rules_(rules), max_reposition_(0)
+{
+}
+
+VehiclePool::~VehiclePool()
+{
+}
+
+void VehiclePool::setVehicles(const vector<LoadVehicle>& vehicles) {
+    vehicles_ = vehicles;
+    type_timeline_.clear();
+    for (const auto& vehicle : vehicles_) {
+        if (vehicle.available && !vehicle.vehicle_type.empty() && !type_timeline_.count(vehicle.vehicle_type)) {
+            int index = static_cast<int>(type_timeline_.size());
+            type_timeline_[vehicle.vehicle_type] = index;
+        }
+    }
+    resetState();
+}
+
+void VehiclePool::resetState() {
+    max_reposition_ = StandDistance::getInstance().getMaxTravelTime();
+    timelines_.assign(type_timeline_.size(), Timeline());
+    states_.assign(vehicles_.size(), VehicleState());
+    employee_vehicle_.clear();
+    task_vehicle_.clear();
+    for (size_t i = 0; i < vehicles_.size(); ++i) {
+        const LoadVehicle& vehicle = vehicles_[i];
+        VehicleState& state = states_[i];
+        state.free_time = NEVER_USED;
+        state.stand = 0;
+        state.timeline = -1;
+        if (!vehicle.available || vehicle.vehicle_type.empty()) {
+            continue;
+        }
+        state.timeline = type_timeline_[vehicle.vehicle_type];
+        timelines_[state.timeline].insert(make_pair(state.free_time, static_cast<int>(i)));
+        if (!vehicle.bound_employee_id.empty()) {
+            employee_vehicle_[vehicle.bound_employee_id] = static_cast<int>(i);
+        }
+    }
+}
+
+bool VehiclePool::canReach(int vehicle, long start, int stand) const {
+    const VehicleState& state = states_[vehicle];
+    if (state.free_time == NEVER_USED) {
+        return true;
+    }
+    long travel = state.stand == stand ? 0 : StandDistance::getInstance().getTravelTime(state.stand, stand);
+    return state.free_time + travel <= start;
+}
+
+int VehiclePool::findCrewVehicle(const LoadTask& task, int timeline) const {
+    int best = -1;
+    for (const string& employee_id : task.getAssignedEmployeeIds()) {
+        auto it = employee_vehicle_.find(employee_id);
+        if (it == employee_vehicle_.end() || it->second == best) {
+            continue;
+        }
+        int vehicle = it->second;
+        if (states_[vehicle].timeline != timeline || !canReach(vehicle, task.getActualStartTime(), task.getStand())) {
+            continue;
+        }
+        // 多名成员带着不同的车时，沿用最近刚用过的那辆
+        if (best < 0 || states_[vehicle].free_time > states_[best].free_time) {
+            best = vehicle;
+        }
+    }
+    return best;
+}
+
+int VehiclePool::findBestFit(int timeline, long start, int stand) const {
+    const Timeline& line = timelines_[timeline];
+    auto it = line.upper_bound(make_pair(start, INT_MAX));
+    for (int probes = 0; it != line.begin() && probes < PROBE_LIMIT; ++probes) {
+        --it;
+        if (canReach(it->second, start, stand)) {
+            return it->second;
+        }
+    }
+    if (it == line.begin()) {
+        return -1;
+    }
+    // 邻近的车辆都来不及，直接跳到空闲时刻足够早、从任何机位开过来都来得及的车辆
+    auto safe = line.upper_bound(make_pair(start - max_reposition_, INT_MAX));
+    if (safe == line.begin()) {
+        return -1;
+    }
+    --safe;
+    if (!(*safe < *it)) {
+        safe = it;
+        --safe;
+    }
+    return canReach(safe->second, start, stand) ? safe->second : -1;
+}
+
+void VehiclePool::occupy(int vehicle, const LoadTask& task) {
+    VehicleState& state = states_[vehicle];
+    Timeline& line = timelines_[state.timeline];
+    line.erase(make_pair(state.free_time, vehicle));
+    state.free_time = task.getActualEndTime();
+    state.stand = task.getStand();
+    line.insert(make_pair(state.free_time, vehicle));
+    for (const string& employee_id : task.getAssignedEmployeeIds()) {
+        employee_vehicle_[employee_id] = vehicle;
+    }
+    task_vehicle_[task.getTaskId()] = vehicle;
+}
+
+VehicleSummary VehiclePool::assignVehicles(const vector<LoadTask>& tasks) {
+    resetState();
+    VehicleSummary summary;
+
+    // 按实际开始时间顺序派车（调度顺序是进港在前、出港在后，不是时间顺序）
+    vector<int> order;
+    for (size_t i = 0; i < tasks.size(); ++i) {
+        const LoadTask& task = tasks[i];
+        if (!task.getRequiredVehicleType().empty() && task.getActualStartTime() > 0 &&
+            !task.getAssignedEmployeeIds().empty()) {
+            order.push_back(static_cast<int>(i));
+        }
+    }
+    sort(order.begin(), order.end(), [&tasks](int a, int b) {
+        if (tasks[a].getActualStartTime() != tasks[b].getActualStartTime()) {
+            return tasks[a].getActualStartTime() < tasks[b].getActualStartTime();
+        }
+        return a < b;
+    });
+
+    for (int index : order) {
+        const LoadTask& task = tasks[index];
+        summary.required_tasks++;
+        auto type_it = type_timeline_.find(task.getRequiredVehicleType());
+        if (type_it == type_timeline_.end()) {
+            summary.missing_tasks++;
+            continue;
+        }
+        int vehicle = rules_.follow_crew ? findCrewVehicle(task, type_it->second) : -1;
+        if (vehicle >= 0) {
+            summary.followed_tasks++;
+        } else {
+            vehicle = findBestFit(type_it->second, task.getActualStartTime(), task.getStand());
+        }
+        if (vehicle < 0) {
+            summary.missing_tasks++;
+            continue;
+        }
+        if (states_[vehicle].free_time == NEVER_USED) {
+            summary.used_vehicles++;
+        }
+        occupy(vehicle, task);
+        summary.assigned_tasks++;
+    }
+    return summary;
+}
+
+const LoadVehicle* VehiclePool::getTaskVehicle(const string& task_id) const {
+    auto it = task_vehicle_.find(task_id);
+    return it == task_vehicle_.end() ? nullptr : &vehicles_[it->second];
+}
+
+}  // namespace zhuangxie_class
@@ -0,0 +1,147 @@
+/**
+ * @file vehicle_pool.h
+ * @brief 装卸车辆池（按车辆类型维护时间线，随小组派车）
+ *
+ * 小组派工完成后，按实际开始时间顺序给需要车辆（任务所需车辆类型不为空）的任务派车：
+ * 1. 车辆衔接：小组成员上一个任务用过的车辆（或绑定给成员的车辆）类型相同且来得及时，
+ *    继续跟着小组走，车辆随人员从上一个机位到下一个机位，不需要单独调度空车；
+ * 2. 否则在同类型车辆中选最晚空闲、且从所在机位开过来来得及的车辆（最佳适配，
+ *    尽量少动用新车）。
+ *
+ * 每种车辆类型一条时间线：按空闲时刻排序的有序集合。任务按时间顺序处理，车辆的占用
+ * 区间只需记录空闲时刻和所在机位；选车是一次二分查找加常数个邻居检查，
+ * 更新是一次删除和插入，每个任务O(log n)。
+ */
+
+#ifndef ZHUANGXIE_CLASS_VEHICLE_POOL_H
+#define ZHUANGXIE_CLASS_VEHICLE_POOL_H
+
+#include "load_task.h"
+#include <vector>
+#include <string>
+#include <set>
+#include <unordered_map>
+
+namespace zhuangxie_class {
+
+using namespace std;
+
+/**
+ * @brief 车辆（来自vehicle.csv）
+ */
+struct LoadVehicle {
+    string plate;                      ///< 车牌号
+    string vehicle_type;               ///< 车辆类型
+    bool available = true;             ///< 车辆状态（不可用的车辆不参与派车）
+    string bound_employee_id;          ///< 绑定人员编号（该人员所在小组优先使用）
+};
+
+/**
+ * @brief 派车规则
+ */
+struct VehicleRules {
+    bool follow_crew = true;           ///< 车辆衔接偏好：优先沿用小组上一个任务的车辆
+};
+
+/**
+ * @brief 派车结果统计
+ */
+struct VehicleSummary {
+    int required_tasks = 0;            ///< 需要车辆的已分配任务数
+    int assigned_tasks = 0;            ///< 派到车辆的任务数
+    int followed_tasks = 0;            ///< 沿用小组车辆的任务数（含在assigned_tasks中）
+    int missing_tasks = 0;             ///< 没有可用车辆的任务数
+    int used_vehicles = 0;             ///< 用到的车辆数
+};
+
+/**
+ * @brief 装卸车辆池
+ */
+class VehiclePool {
+public:
+    /**
+     * @brief 构造函数
+     * @param rules 派车规则
+     */
+    explicit VehiclePool(const VehicleRules& rules = VehicleRules());
+
+    /**
+     * @brief 析构函数
+     */
+    ~VehiclePool();
+
+    /**
+     * @brief 设置车辆列表（清空之前的派车结果）
+     */
+    void setVehicles(const vector<LoadVehicle>& vehicles);
+
+    /**
+     * @brief 给已分配小组的任务派车（先清空之前的派车结果）
+     * @param tasks 调度后的任务列表
+     * @return 结果统计
+     */
+    VehicleSummary assignVehicles(const vector<LoadTask>& tasks);
+
+    /**
+     * @brief 获取任务派到的车辆
+     * @return 车辆，没有派车返回nullptr
+     */
+    const LoadVehicle* getTaskVehicle(const string& task_id) const;
+
+    /**
+     * @brief 获取车辆列表
+     */
+    const vector<LoadVehicle>& getVehicles() const { return vehicles_; }
+
+private:
+    /**
+     * @brief 单辆车的当前状态
+     */
+    struct VehicleState {
+        long free_time;                ///< 空闲时刻（上一个任务结束时间）
+        int stand;                     ///< 所在机位（0表示还没出车）
+        int timeline;                  ///< 所属时间线（车辆类型）下标，-1表示不可用
+    };
+
+    typedef set<pair<long, int>> Timeline;  ///< {空闲时刻, 车辆下标}
+
+    /**
+     * @brief 清空派车状态，所有可用车辆回到各自类型的时间线
+     */
+    void resetState();
+
+    /**
+     * @brief 车辆能否在start之前到达stand
+     */
+    bool canReach(int vehicle, long start, int stand) const;
+
+    /**
+     * @brief 在小组成员上一次用过的车辆中选车
+     * @return 车辆下标，没有合适的车辆返回-1
+     */
+    int findCrewVehicle(const LoadTask& task, int timeline) const;
+
+    /**
+     * @brief 在同类型车辆中选最晚空闲且来得及的车辆
+     * @return 车辆下标，没有合适的车辆返回-1
+     */
+    int findBestFit(int timeline, long start, int stand) const;
+
+    /**
+     * @brief 占用车辆到任务结束
+     */
+    void occupy(int vehicle, const LoadTask& task);
+
+    VehicleRules rules_;                                  ///< 派车规则
+    long max_reposition_;                                 ///< 空车调度的最长路程时间（秒，取机位间最长路程时间），空闲早于开始时间该时长的车辆一定来得及
+    vector<LoadVehicle> vehicles_;                        ///< 车辆列表
+    vector<VehicleState> states_;                         ///< 车辆状态
+    unordered_map<string, int> type_timeline_;            ///< 车辆类型 -> 时间线下标
+    vector<Timeline> timelines_;                          ///< 每种车辆类型的时间线
+    unordered_map<string, int> employee_vehicle_;         ///< 员工编号 -> 上一次用的车辆
+    unordered_map<string, int> task_vehicle_;             ///< 任务ID -> 派到的车辆
+};
+
+}  // namespace zhuangxie_class
+
+#endif  // ZHUANGXIE_CLASS_VEHICLE_POOL_H